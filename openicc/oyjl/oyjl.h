@@ -138,6 +138,10 @@ OYJL_API oyjl_val oyjlTreeParse  ( const char *input,
  */
 OYJL_API void oyjlTreeFree ( oyjl_val v );
 
+OYJL_API oyjl_val oyjlTreeParseArena ( const char *input,
+                                   char *error_buffer, size_t error_buffer_size);
+OYJL_API void oyjlTreeFreeArena ( oyjl_val root );
+
 /**
  * @internal
  * Access a nested value inside a tree.
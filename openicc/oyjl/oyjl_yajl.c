@@ -46,15 +46,49 @@ struct stack_elem_s
 {
     char * key;
     oyjl_val value;
+    size_t first; /* position of the first child in context_t::values */
     stack_elem_t *next;
 };
 
+/*
+ * The arena keeps all nodes, strings and child arrays of one tree in a few
+ * large blocks. The root node is embedded in the arena header, so
+ * oyjlTreeFreeArena() finds the blocks from the root pointer.
+ */
+struct arena_block_s;
+typedef struct arena_block_s arena_block_t;
+struct arena_block_s
+{
+    arena_block_t * next;
+    size_t size;
+    size_t used;
+};
+#define ARENA_ALIGN(n) (((n) + 7) & ~((size_t)7))
+#define ARENA_BLOCK_HEADER ARENA_ALIGN(sizeof(arena_block_t))
+#define ARENA_BLOCK_MIN 4096
+#define ARENA_BLOCK_MAX (1024*1024)
+
+typedef struct
+{
+    struct oyjl_val_s root; /* must stay the first member */
+    arena_block_t * blocks;
+    size_t block_size;
+    int root_used;
+} arena_t;
+
 struct context_s
 {
     stack_elem_t *stack;
+    stack_elem_t *unused; /* popped stack elements for reuse */
     oyjl_val root;
     char *errbuf;
     size_t errbuf_size;
+    arena_t * arena;
+    /* children of all open objects and arrays; keys stay NULL for arrays */
+    oyjl_val * values;
+    char ** keys;
+    size_t values_n;
+    size_t values_reserved;
 };
 typedef struct context_s context_t;
 
@@ -64,11 +98,81 @@ typedef struct context_s context_t;
         return (retval);                                                \
     }
 
-static oyjl_val value_alloc (oyjl_type type)
+static void * arena_alloc (arena_t * arena, size_t size)
+{
+    arena_block_t * b = arena->blocks;
+    void * ptr;
+
+    size = ARENA_ALIGN(size);
+    if (b == NULL || b->used + size > b->size)
+    {
+        size_t block_size = arena->block_size;
+
+        /* grow geometrically to keep the number of blocks small */
+        if (arena->block_size < ARENA_BLOCK_MAX)
+            arena->block_size *= 2;
+        if (block_size < size)
+            block_size = size;
+
+        b = malloc (ARENA_BLOCK_HEADER + block_size);
+        if (b == NULL) return (NULL);
+        b->size = block_size;
+        b->used = 0;
+        b->next = arena->blocks;
+        arena->blocks = b;
+    }
+
+    ptr = (char*)b + ARENA_BLOCK_HEADER + b->used;
+    b->used += size;
+
+    return (ptr);
+}
+
+static arena_t * arena_new (void)
+{
+    arena_t * arena = malloc (sizeof (*arena));
+    if (arena == NULL) return (NULL);
+    memset (arena, 0, sizeof (*arena));
+    arena->block_size = ARENA_BLOCK_MIN;
+    return (arena);
+}
+
+static void arena_free (arena_t * arena)
+{
+    while (arena->blocks)
+    {
+        arena_block_t * b = arena->blocks;
+        arena->blocks = b->next;
+        free (b);
+    }
+    free (arena);
+}
+
+static void * context_alloc (context_t * ctx, size_t size)
+{
+    if (ctx->arena)
+        return (arena_alloc (ctx->arena, size));
+    return (malloc (size));
+}
+
+static void context_free (context_t * ctx, void * ptr)
+{
+    if (ctx->arena == NULL)
+        free (ptr);
+}
+
+static oyjl_val value_alloc (context_t * ctx, oyjl_type type)
 {
     oyjl_val v;
 
-    v = malloc (sizeof (*v));
+    /* the first value of a document is always its root */
+    if (ctx->arena && !ctx->arena->root_used)
+    {
+        v = &ctx->arena->root;
+        ctx->arena->root_used = 1;
+    }
+    else
+        v = context_alloc (ctx, sizeof (*v));
     if (v == NULL) return (NULL);
     memset (v, 0, sizeof (*v));
     v->type = type;
@@ -76,18 +180,36 @@ static oyjl_val value_alloc (oyjl_type type)
     return (v);
 }
 
+static char * string_alloc (context_t * ctx,
+                            const char * string, size_t string_length)
+{
+    char * s = context_alloc (ctx, string_length + 1);
+    if (s == NULL) return (NULL);
+    memcpy (s, string, string_length);
+    s[string_length] = 0;
+    return (s);
+}
+
 /*
  * Parsing nested objects and arrays is implemented using a stack. When a new
  * object or array starts (a curly or a square opening bracket is read), an
- * appropriate value is pushed on the stack. When the end of the object is
- * reached (an appropriate closing bracket has been read), the value is popped
- * off the stack and added to the enclosing object using "context_add_value".
+ * appropriate value is pushed on the stack. Its children are collected in
+ * the context wide values array. When the end of the object is reached (an
+ * appropriate closing bracket has been read), the children are moved into an
+ * array of exact size, the value is popped off the stack and added to the
+ * enclosing object using "context_add_value".
  */
 static int context_push(context_t *ctx, oyjl_val v)
 {
     stack_elem_t *stack;
 
-    stack = malloc (sizeof (*stack));
+    if (ctx->unused)
+    {
+        stack = ctx->unused;
+        ctx->unused = stack->next;
+    }
+    else
+        stack = malloc (sizeof (*stack));
     if (stack == NULL)
         RETURN_ERROR (ctx, ENOMEM, "Out of memory");
     memset (stack, 0, sizeof (*stack));
@@ -97,6 +219,7 @@ static int context_push(context_t *ctx, oyjl_val v)
             || OYJL_IS_ARRAY (v));
 
     stack->value = v;
+    stack->first = ctx->values_n;
     stack->next = ctx->stack;
     ctx->stack = stack;
 
@@ -107,76 +230,89 @@ static oyjl_val context_pop(context_t *ctx)
 {
     stack_elem_t *stack;
     oyjl_val v;
+    size_t n;
 
     if (ctx->stack == NULL)
         RETURN_ERROR (ctx, NULL, "context_pop: "
                       "Bottom of stack reached prematurely");
 
     stack = ctx->stack;
-    ctx->stack = stack->next;
-
     v = stack->value;
+    n = ctx->values_n - stack->first;
 
-    free (stack);
+    if (n)
+    {
+        oyjl_val * values = context_alloc (ctx, sizeof (*values) * n);
+        char ** keys = NULL;
+
+        if (values)
+            memcpy (values, &ctx->values[stack->first], sizeof (*values) * n);
+        if (values && OYJL_IS_OBJECT (v))
+        {
+            keys = context_alloc (ctx, sizeof (*keys) * n);
+            if (keys)
+                memcpy (keys, &ctx->keys[stack->first], sizeof (*keys) * n);
+            else
+            {
+                context_free (ctx, values);
+                values = NULL;
+            }
+        }
+        /* on error the children stay in ctx->values for the clean up */
+        if (values == NULL)
+            RETURN_ERROR (ctx, NULL, "Out of memory");
+
+        if (OYJL_IS_OBJECT (v))
+        {
+            v->u.object.keys = keys;
+            v->u.object.values = values;
+            v->u.object.len = n;
+        }
+        else
+        {
+            v->u.array.values = values;
+            v->u.array.len = n;
+        }
+        ctx->values_n = stack->first;
+    }
+
+    ctx->stack = stack->next;
+    stack->next = ctx->unused;
+    ctx->unused = stack;
 
     return (v);
 }
 
-static int object_add_keyval(context_t *ctx,
-                             oyjl_val obj, char *key, oyjl_val value)
+static int context_add_child (context_t *ctx, char *key, oyjl_val value)
 {
-    char **tmpk;
-    oyjl_val *tmpv;
-
     /* We're checking for NULL in "context_add_value" or its callers. */
     assert (ctx != NULL);
-    assert (obj != NULL);
-    assert (key != NULL);
     assert (value != NULL);
 
-    /* We're assuring that "obj" is an object in "context_add_value". */
-    assert(OYJL_IS_OBJECT(obj));
-
-    tmpk = realloc((void *) obj->u.object.keys, sizeof(*(obj->u.object.keys)) * (obj->u.object.len + 1));
-    if (tmpk == NULL)
-        RETURN_ERROR(ctx, ENOMEM, "Out of memory");
-    obj->u.object.keys = tmpk;
-
-    tmpv = realloc(obj->u.object.values, sizeof (*obj->u.object.values) * (obj->u.object.len + 1));
-    if (tmpv == NULL)
-        RETURN_ERROR(ctx, ENOMEM, "Out of memory");
-    obj->u.object.values = tmpv;
+    if (ctx->values_n >= ctx->values_reserved)
+    {
+        size_t n = ctx->values_reserved ? ctx->values_reserved * 2 : 64;
+        oyjl_val * tmpv;
+        char ** tmpk;
 
-    obj->u.object.keys[obj->u.object.len] = key;
-    obj->u.object.values[obj->u.object.len] = value;
-    obj->u.object.len++;
+        tmpv = realloc (ctx->values, sizeof (*ctx->values) * n);
+        if (tmpv == NULL)
+            RETURN_ERROR (ctx, ENOMEM, "Out of memory");
+        ctx->values = tmpv;
 
-    return (0);
-}
+        tmpk = realloc (ctx->keys, sizeof (*ctx->keys) * n);
+        if (tmpk == NULL)
+            RETURN_ERROR (ctx, ENOMEM, "Out of memory");
+        ctx->keys = tmpk;
 
-static int array_add_value (context_t *ctx,
-                            oyjl_val array, oyjl_val value)
-{
-    oyjl_val *tmp;
+        ctx->values_reserved = n;
+    }
 
-    /* We're checking for NULL pointers in "context_add_value" or its
-     * callers. */
-    assert (ctx != NULL);
-    assert (array != NULL);
-    assert (value != NULL);
+    ctx->keys[ctx->values_n] = key;
+    ctx->values[ctx->values_n] = value;
+    ctx->values_n++;
 
-    /* "context_add_value" will only call us with array values. */
-    assert(OYJL_IS_ARRAY(array));
-    
-    tmp = realloc(array->u.array.values,
-                  sizeof(*(array->u.array.values)) * (array->u.array.len + 1));
-    if (tmp == NULL)
-        RETURN_ERROR(ctx, ENOMEM, "Out of memory");
-    array->u.array.values = tmp;
-    array->u.array.values[array->u.array.len] = value;
-    array->u.array.len++;
-
-    return 0;
+    return (0);
 }
 
 /*
@@ -194,9 +330,8 @@ static int context_add_value (context_t *ctx, oyjl_val v)
      *   - There is no value on the stack => This is the only value. This is the
      *     last step done when parsing a document. We assign the value to the
      *     "root" member and return.
-     *   - The value on the stack is an object. In this case store the key on the
-     *     stack or, if the key has already been read, add key and value to the
-     *     object.
+     *   - The value on the stack is an object. In this case the key was stored
+     *     on the stack by "handle_map_key". Add key and value to the object.
      *   - The value on the stack is an array. In this case simply add the value
      *     and return.
      */
@@ -208,30 +343,25 @@ static int context_add_value (context_t *ctx, oyjl_val v)
     }
     else if (OYJL_IS_OBJECT (ctx->stack->value))
     {
-        if (ctx->stack->key == NULL)
-        {
-            if (!OYJL_IS_STRING (v))
-                RETURN_ERROR (ctx, EINVAL, "context_add_value: "
-                              "Object key is not a string (%#04x)",
-                              v->type);
-
-            ctx->stack->key = v->u.string;
-            v->u.string = NULL;
-            free(v);
-            return (0);
-        }
-        else /* if (ctx->key != NULL) */
-        {
-            char * key;
+        char * key;
 
-            key = ctx->stack->key;
-            ctx->stack->key = NULL;
-            return (object_add_keyval (ctx, ctx->stack->value, key, v));
-        }
+        int error;
+
+        if (ctx->stack->key == NULL)
+            RETURN_ERROR (ctx, EINVAL, "context_add_value: "
+                          "Object key is missing (%#04x)",
+                          v->type);
+
+        key = ctx->stack->key;
+        ctx->stack->key = NULL;
+        error = context_add_child (ctx, key, v);
+        if (error)
+            ctx->stack->key = key;
+        return (error);
     }
     else if (OYJL_IS_ARRAY (ctx->stack->value))
     {
-        return (array_add_value (ctx, ctx->stack->value, v));
+        return (context_add_child (ctx, NULL, v));
     }
     else
     {
@@ -241,25 +371,175 @@ static int context_add_value (context_t *ctx, oyjl_val v)
     }
 }
 
+/* free all values, which are not yet linked into the tree */
+static void context_clear (context_t *ctx)
+{
+    size_t i;
+
+    if (ctx->arena == NULL)
+        for (i = 0; i < ctx->values_n; ++i)
+        {
+            if (ctx->keys[i]) free (ctx->keys[i]);
+            oyjlTreeFree (ctx->values[i]);
+        }
+    ctx->values_n = 0;
+
+    while (ctx->stack)
+    {
+        stack_elem_t * stack = ctx->stack;
+        if (ctx->arena == NULL)
+        {
+            if (stack->key) free (stack->key);
+            oyjlTreeFree (stack->value);
+        }
+        ctx->stack = stack->next;
+        stack->next = ctx->unused;
+        ctx->unused = stack;
+    }
+}
+
+static int context_add_value_or_free (context_t *ctx, oyjl_val v)
+{
+    if (context_add_value (ctx, v) == 0)
+        return (STATUS_CONTINUE);
+    if (ctx->arena == NULL)
+        oyjlTreeFree (v);
+    return (STATUS_ABORT);
+}
+
 static int handle_string (void *ctx,
                           const unsigned char *string, unsigned int string_length)
 {
     oyjl_val v;
 
-    v = value_alloc (oyjl_t_string);
+    v = value_alloc (ctx, oyjl_t_string);
     if (v == NULL)
         RETURN_ERROR ((context_t *) ctx, STATUS_ABORT, "Out of memory");
 
-    v->u.string = malloc (string_length + 1);
+    v->u.string = string_alloc (ctx, (const char *) string, string_length);
     if (v->u.string == NULL)
     {
-        free (v);
+        context_free (ctx, v);
         RETURN_ERROR ((context_t *) ctx, STATUS_ABORT, "Out of memory");
     }
-    memcpy(v->u.string, string, string_length);
-    v->u.string[string_length] = 0;
 
-    return ((context_add_value (ctx, v) == 0) ? STATUS_CONTINUE : STATUS_ABORT);
+    return (context_add_value_or_free (ctx, v));
+}
+
+static int handle_map_key (void *ctx_,
+                           const unsigned char *string, unsigned int string_length)
+{
+    context_t * ctx = ctx_;
+
+    if (ctx->stack == NULL || !OYJL_IS_OBJECT (ctx->stack->value) ||
+        ctx->stack->key != NULL)
+        RETURN_ERROR (ctx, STATUS_ABORT, "handle_map_key: "
+                      "Object key outside of a object");
+
+    ctx->stack->key = string_alloc (ctx, (const char *) string, string_length);
+    if (ctx->stack->key == NULL)
+        RETURN_ERROR (ctx, STATUS_ABORT, "Out of memory");
+
+    return (STATUS_CONTINUE);
+}
+
+/*
+ * Convert a JSON number independent of the LC_NUMERIC locale and without
+ * touching the global locale. Short numbers with small exponents are
+ * exactly representable and are computed directly. Other numbers are handed
+ * to strtod() with the decimal point of the current locale.
+ */
+static int number_to_double (const char * string, size_t len, double * d)
+{
+    static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+      1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+      1e20, 1e21, 1e22 };
+    const char * p = string, * end = string + len;
+    unsigned long long mantissa = 0;
+    int negative = 0, digits = 0, exponent = 0, exp_sign = 1, exp_value = 0;
+    char * endptr = NULL, * t;
+    const char * decimal_point = ".";
+    size_t dp_len, i, j;
+
+    if (p < end && *p == '-') { negative = 1; ++p; }
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+        if (mantissa || *p != '0') ++digits;
+        mantissa = mantissa * 10 + (unsigned)(*p - '0');
+        ++p;
+        if (digits > 18) goto slow;
+    }
+    if (p < end && *p == '.')
+    {
+        ++p;
+        while (p < end && *p >= '0' && *p <= '9')
+        {
+            if (mantissa || *p != '0') ++digits;
+            mantissa = mantissa * 10 + (unsigned)(*p - '0');
+            --exponent;
+            ++p;
+            if (digits > 18) goto slow;
+        }
+    }
+    if (p < end && (*p == 'e' || *p == 'E'))
+    {
+        ++p;
+        if (p < end && (*p == '-' || *p == '+'))
+        {
+            if (*p == '-') exp_sign = -1;
+            ++p;
+        }
+        while (p < end && *p >= '0' && *p <= '9')
+        {
+            exp_value = exp_value * 10 + (*p - '0');
+            ++p;
+            if (exp_value > 1000) goto slow;
+        }
+        exponent += exp_sign * exp_value;
+    }
+    if (p != end)
+        return (1);
+
+    if (mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22)
+    {
+        double v = (double) mantissa;
+        if (exponent < 0)
+            v /= pow10[-exponent];
+        else
+            v *= pow10[exponent];
+        *d = negative ? -v : v;
+        return (0);
+    }
+
+slow:
+#ifdef HAVE_LOCALE_H
+    {
+        struct lconv * lc = localeconv ();
+        if (lc && lc->decimal_point && lc->decimal_point[0])
+            decimal_point = lc->decimal_point;
+    }
+#endif
+    dp_len = strlen (decimal_point);
+    t = malloc (len + dp_len + 1);
+    if (t == NULL) return (1);
+    for (i = 0, j = 0; i < len; ++i)
+    {
+        if (string[i] == '.')
+        {
+            memcpy (&t[j], decimal_point, dp_len);
+            j += dp_len;
+        }
+        else
+            t[j++] = string[i];
+    }
+    t[j] = 0;
+
+    errno = 0;
+    *d = strtod (t, &endptr);
+    i = (errno == 0) && (endptr != NULL) && (*endptr == 0);
+    free (t);
+
+    return (i ? 0 : 1);
 }
 
 #if (YAJL_VERSION) > 20000
@@ -269,20 +549,17 @@ static int handle_number (void *ctx, const char *string, unsigned int string_len
 #endif
 {
     oyjl_val v;
-    char *endptr;
 
-    v = value_alloc(oyjl_t_number);
+    v = value_alloc(ctx, oyjl_t_number);
     if (v == NULL)
         RETURN_ERROR((context_t *) ctx, STATUS_ABORT, "Out of memory");
 
-    v->u.number.r = malloc(string_length + 1);
+    v->u.number.r = string_alloc (ctx, string, string_length);
     if (v->u.number.r == NULL)
     {
-        free(v);
+        context_free(ctx, v);
         RETURN_ERROR((context_t *) ctx, STATUS_ABORT, "Out of memory");
     }
-    memcpy(v->u.number.r, string, string_length);
-    v->u.number.r[string_length] = 0;
 
     v->u.number.flags = 0;
 
@@ -293,29 +570,17 @@ static int handle_number (void *ctx, const char *string, unsigned int string_len
     if (errno == 0)
         v->u.number.flags |= OYJL_NUMBER_INT_VALID;
 
-    endptr = NULL;
-    errno = 0;
-#ifdef HAVE_LOCALE_H
-    char * save_locale = oyjlStringCopy( setlocale(LC_NUMERIC, 0 ), malloc );
-    setlocale(LC_NUMERIC, "C");
-#endif
-    v->u.number.d = strtod(v->u.number.r, &endptr);
-#ifdef HAVE_LOCALE_H
-    setlocale(LC_NUMERIC, save_locale);
-    if(save_locale)
-      free( save_locale );
-#endif
-    if ((errno == 0) && (endptr != NULL) && (*endptr == 0))
+    if (number_to_double (string, string_length, &v->u.number.d) == 0)
         v->u.number.flags |= OYJL_NUMBER_DOUBLE_VALID;
 
-    return ((context_add_value(ctx, v) == 0) ? STATUS_CONTINUE : STATUS_ABORT);
+    return (context_add_value_or_free (ctx, v));
 }
 
 static int handle_start_map (void *ctx)
 {
     oyjl_val v;
 
-    v = value_alloc(oyjl_t_object);
+    v = value_alloc(ctx, oyjl_t_object);
     if (v == NULL)
         RETURN_ERROR ((context_t *) ctx, STATUS_ABORT, "Out of memory");
 
@@ -323,7 +588,10 @@ static int handle_start_map (void *ctx)
     v->u.object.values = NULL;
     v->u.object.len = 0;
 
-    return ((context_push (ctx, v) == 0) ? STATUS_CONTINUE : STATUS_ABORT);
+    if (context_push (ctx, v) == 0)
+        return (STATUS_CONTINUE);
+    context_free (ctx, v);
+    return (STATUS_ABORT);
 }
 
 static int handle_end_map (void *ctx)
@@ -334,21 +602,24 @@ static int handle_end_map (void *ctx)
     if (v == NULL)
         return (STATUS_ABORT);
 
-    return ((context_add_value (ctx, v) == 0) ? STATUS_CONTINUE : STATUS_ABORT);
+    return (context_add_value_or_free (ctx, v));
 }
 
 static int handle_start_array (void *ctx)
 {
     oyjl_val v;
 
-    v = value_alloc(oyjl_t_array);
+    v = value_alloc(ctx, oyjl_t_array);
     if (v == NULL)
         RETURN_ERROR ((context_t *) ctx, STATUS_ABORT, "Out of memory");
 
     v->u.array.values = NULL;
     v->u.array.len = 0;
 
-    return ((context_push (ctx, v) == 0) ? STATUS_CONTINUE : STATUS_ABORT);
+    if (context_push (ctx, v) == 0)
+        return (STATUS_CONTINUE);
+    context_free (ctx, v);
+    return (STATUS_ABORT);
 }
 
 static int handle_end_array (void *ctx)
@@ -359,82 +630,31 @@ static int handle_end_array (void *ctx)
     if (v == NULL)
         return (STATUS_ABORT);
 
-    return ((context_add_value (ctx, v) == 0) ? STATUS_CONTINUE : STATUS_ABORT);
+    return (context_add_value_or_free (ctx, v));
 }
 
 static int handle_boolean (void *ctx, int boolean_value)
 {
     oyjl_val v;
 
-    v = value_alloc (boolean_value ? oyjl_t_true : oyjl_t_false);
+    v = value_alloc (ctx, boolean_value ? oyjl_t_true : oyjl_t_false);
     if (v == NULL)
         RETURN_ERROR ((context_t *) ctx, STATUS_ABORT, "Out of memory");
 
-    return ((context_add_value (ctx, v) == 0) ? STATUS_CONTINUE : STATUS_ABORT);
+    return (context_add_value_or_free (ctx, v));
 }
 
 static int handle_null (void *ctx)
 {
     oyjl_val v;
 
-    v = value_alloc (oyjl_t_null);
+    v = value_alloc (ctx, oyjl_t_null);
     if (v == NULL)
         RETURN_ERROR ((context_t *) ctx, STATUS_ABORT, "Out of memory");
 
-    return ((context_add_value (ctx, v) == 0) ? STATUS_CONTINUE : STATUS_ABORT);
+    return (context_add_value_or_free (ctx, v));
 }
 
-/*
- * Public functions
- */
-
-/** \addtogroup misc
- *  @{ *//* misc */
-/** \addtogroup oyjl Oyjl JSON Parsing
- *  @brief   Easy to use JSON API
- *
- *  The API is designed to be easily useable without much boilerplate.
- *  It includes a xpath alike syntax to obtain or create nodes inside
- *  a tree. A path string is constructed of terms and the slash 
- *  delimiter '/'. Understood terms are object names or the squared 
- *  brackets index operator [].
- *
- *  \b Path \b Example:
- *
- *  "foo/[3]/bar" will return the "bar" node with the "found" string.
- *  @verbatim
-    {
-      "foo": [
-        { "ignore": 0 },
-        { "ignore_too": 0 },
-        { "ignore_it": 0 },
-        { "bar": "found" }
-      ]
-    }
-    @endverbatim
- *  Some API's accept extended paths expressions. Those can contain empty
- *  terms, like "//", which matches all keys in the above example. Those
- *  are oyjl_tree_to_paths() and oyjl_path_match(). oyjl_tree_to_paths()
- *  works on the whole tree to match a extended xpath.
- *
- *  \b Programming \b Tutorial
- *
- *  The following code examples come from @ref tutorial_json_options.c . 
- *  @dontinclude tutorial_json_options.c
- *  @skip testOyjl(void)
- *  @until oyjlTreeFree(
- *  @{ *//* oyjl */
-
-/** @brief read a json text string into a C data structure
- *
- *  @dontinclude tutorial_json_options.c
- *  @skipline text
- *  @skip error_buffer
- *  @until oyjl_tree_parse
- */
-oyjl_val oyjlTreeParse   (const char *input,
-                          char *error_buffer, size_t error_buffer_size)
-{
 #if (YAJL_VERSION) > 20000
 static yajl_callbacks oyjl_tree_callbacks = {
   handle_null,
@@ -444,7 +664,7 @@ static yajl_callbacks oyjl_tree_callbacks = {
   handle_number,
   (int(*)(void*,const unsigned char*,size_t))handle_string,
   handle_start_map,
-  (int(*)(void*,const unsigned char*,size_t))handle_string,
+  (int(*)(void*,const unsigned char*,size_t))handle_map_key,
   handle_end_map,
   handle_start_array,
   handle_end_array
@@ -458,44 +678,41 @@ static yajl_callbacks oyjl_tree_callbacks = {
   handle_number,
   handle_string,
   handle_start_map,
-  handle_string,
+  handle_map_key,
   handle_end_map,
   handle_start_array,
   handle_end_array
 };
 #endif
-#if 0
-    static const yajl_callbacks callbacks =
-        {
-            /* null        = */ handle_null,
-            /* boolean     = */ handle_boolean,
-            /* integer     = */ NULL,
-            /* double      = */ NULL,
-            /* number      = */ handle_number,
-            /* string      = */ handle_string,
-            /* start map   = */ handle_start_map,
-            /* map key     = */ handle_string,
-            /* end map     = */ handle_end_map,
-            /* start array = */ handle_start_array,
-            /* end array   = */ handle_end_array
-        };
-#endif
+
+static oyjl_val tree_parse (const char *input, int use_arena,
+                            char *error_buffer, size_t error_buffer_size)
+{
     yajl_handle handle;
 #if YAJL_VERSION < 20000
     yajl_parser_config yconfig = { 1, 1 };
 #endif
     yajl_status status;
     char * internal_err_str;
-	context_t ctx = { NULL, NULL, NULL, 0 };
+    context_t ctx;
+    oyjl_val root;
 
   if(!input) return NULL;
 
+  memset (&ctx, 0, sizeof (ctx));
   ctx.errbuf = error_buffer;
 	ctx.errbuf_size = error_buffer_size;
 
     if (error_buffer != NULL)
         memset (error_buffer, 0, error_buffer_size);
 
+    if (use_arena)
+    {
+        ctx.arena = arena_new ();
+        if (ctx.arena == NULL)
+            RETURN_ERROR (&ctx, NULL, "Out of memory");
+    }
+
     handle = yajl_alloc( &oyjl_tree_callbacks,
 #if YAJL_VERSION < 20000
                                                 &yconfig,
@@ -522,14 +739,126 @@ static yajl_callbacks oyjl_tree_callbacks = {
         status = yajl_complete_parse (handle);
 #endif
         yajl_free (handle);
-        return NULL;
-    }
-
+        context_clear (&ctx);
+        if (ctx.arena == NULL)
+            oyjlTreeFree (ctx.root);
+        ctx.root = NULL;
+    } else
+    {
 #if YAJL_VERSION > 19999
-    status = yajl_complete_parse (handle);
+        status = yajl_complete_parse (handle);
 #endif
-    yajl_free (handle);
-    return (ctx.root);
+        yajl_free (handle);
+        /* incomplete documents leave values behind */
+        context_clear (&ctx);
+    }
+
+    while (ctx.unused)
+    {
+        stack_elem_t * stack = ctx.unused;
+        ctx.unused = stack->next;
+        free (stack);
+    }
+    free (ctx.values);
+    free (ctx.keys);
+
+    root = ctx.root;
+    if (ctx.arena && root == NULL)
+        arena_free (ctx.arena);
+
+    return (root);
+}
+
+/*
+ * Public functions
+ */
+
+/** \addtogroup misc
+ *  @{ *//* misc */
+/** \addtogroup oyjl Oyjl JSON Parsing
+ *  @brief   Easy to use JSON API
+ *
+ *  The API is designed to be easily useable without much boilerplate.
+ *  It includes a xpath alike syntax to obtain or create nodes inside
+ *  a tree. A path string is constructed of terms and the slash 
+ *  delimiter '/'. Understood terms are object names or the squared 
+ *  brackets index operator [].
+ *
+ *  \b Path \b Example:
+ *
+ *  "foo/[3]/bar" will return the "bar" node with the "found" string.
+ *  @verbatim
+    {
+      "foo": [
+        { "ignore": 0 },
+        { "ignore_too": 0 },
+        { "ignore_it": 0 },
+        { "bar": "found" }
+      ]
+    }
+    @endverbatim
+ *  Some API's accept extended paths expressions. Those can contain empty
+ *  terms, like "//", which matches all keys in the above example. Those
+ *  are oyjl_tree_to_paths() and oyjl_path_match(). oyjl_tree_to_paths()
+ *  works on the whole tree to match a extended xpath.
+ *
+ *  \b Programming \b Tutorial
+ *
+ *  The following code examples come from @ref tutorial_json_options.c . 
+ *  @dontinclude tutorial_json_options.c
+ *  @skip testOyjl(void)
+ *  @until oyjlTreeFree(
+ *  @{ *//* oyjl */
+
+/** @brief read a json text string into a C data structure
+ *
+ *  @dontinclude tutorial_json_options.c
+ *  @skipline text
+ *  @skip error_buffer
+ *  @until oyjl_tree_parse
+ */
+oyjl_val oyjlTreeParse   (const char *input,
+                          char *error_buffer, size_t error_buffer_size)
+{
+  return tree_parse( input, 0, error_buffer, error_buffer_size );
+}
+
+/** @brief read a json text string into a read only C data structure
+ *
+ *  All nodes, strings and child arrays are placed in a few large blocks.
+ *  Parsing needs this way much less allocations than oyjlTreeParse() and
+ *  the tree is released in one call to oyjlTreeFreeArena(). The tree must
+ *  not be modified, e.g. through oyjlTreeGetValue( OYJL_CREATE_NEW ),
+ *  oyjlValueSetString() or oyjlTreeClearValue(), and not be released with
+ *  oyjlTreeFree().
+ *
+ *  @param[in]     input               the JSON text
+ *  @param[out]    error_buffer        optional error message buffer
+ *  @param[in]     error_buffer_size   size of error_buffer
+ *  @return                            the root node or NULL on error
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2018/03/14
+ *  @since   2018/03/14 (Oyjl: 1.0.0)
+ */
+oyjl_val oyjlTreeParseArena (const char *input,
+                             char *error_buffer, size_t error_buffer_size)
+{
+  return tree_parse( input, 1, error_buffer, error_buffer_size );
+}
+
+/** @brief release a tree from oyjlTreeParseArena()
+ *
+ *  @param[in]     root                the root node; NULL is a no-op
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2018/03/14
+ *  @since   2018/03/14 (Oyjl: 1.0.0)
+ */
+void     oyjlTreeFreeArena  (oyjl_val root)
+{
+  if(root)
+    arena_free( (arena_t*) root );
 }
 
 
@@ -14,7 +14,9 @@
 
 #define TESTS_RUN \
   TEST_RUN( testVersion, "Version matching", 1 ); \
-  TEST_RUN( testJson, "JSON handling", 1 );
+  TEST_RUN( testJson, "JSON handling", 1 ); \
+  TEST_RUN( testJsonArena, "JSON arena parsing", 1 ); \
+  TEST_RUN( testJsonThreads, "JSON parsing in threads", 1 );
 
 #include "oyjl_test.h"
 #include "oyjl.h"
@@ -22,6 +24,7 @@
 #ifdef HAVE_LOCALE_H
 #include <locale.h>
 #endif
+#include <pthread.h>
 
 
 /* --- actual tests --- */
@@ -212,6 +215,197 @@ oyjlTESTRESULT_e testJson ()
 }
 
 
+/* a device DB alike the taxi DB with n entries */
+static char * testJsonDB( int n )
+{
+  char * json = NULL;
+  int i;
+
+  oyjlStringAdd( &json, 0,0, "{\"org\":{\"freedesktop\":{\"openicc\":{\"device\":[[" );
+  for(i = 0; i < n; ++i)
+    oyjlStringAdd( &json, 0,0, "%s\n{\"_id\":{\"$oid\":\"5a6f%08d\"},\"manufacturer\":\"Maker %d\",\"model\":\"Model %d\",\"profile_description\":[\"Model %d sRGB\",\"Model %d AdobeRGB\"],\"gamma\":%d.%d,\"count\":%d,\"flag\":true,\"none\":null}",
+                   i ? "," : "", i, i%50, i, i, i, 1+i%3, i%10, i );
+  oyjlStringAdd( &json, 0,0, "]]}}}}" );
+
+  return json;
+}
+
+oyjlTESTRESULT_e testJsonArena ()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  int i, n = 10, count = 2000, level = 0;
+  char * json = testJsonDB( count ), * text = NULL, * text_arena = NULL;
+  oyjl_val root, root_arena, v;
+  char error_buffer[128];
+  double clck;
+  const char * numbers[] = { "0.5", "-1.25e-3", "3.14159265358979", "1e300",
+                             "123456789012345678901234", "2.2250738585072014e-308",
+                             "-0", "7E+2", NULL };
+
+  fprintf(stdout, "\n" );
+
+  root = oyjlTreeParse( json, error_buffer, 128 );
+  root_arena = oyjlTreeParseArena( json, error_buffer, 128 );
+  oyjlTreeToJson( root, &level, &text ); level = 0;
+  oyjlTreeToJson( root_arena, &level, &text_arena ); level = 0;
+  v = oyjlTreeGetValue( root_arena, 0, "org/freedesktop/openicc/device/[0]" );
+  if(text && text_arena && strcmp(text, text_arena) == 0 &&
+     oyjlValueCount( v ) == count)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyjlTreeParseArena() == oyjlTreeParse() %d", oyjlValueCount( v ) );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyjlTreeParseArena() == oyjlTreeParse() %d", oyjlValueCount( v ) );
+  }
+  myDeAllocFunc( text ); text = NULL;
+  myDeAllocFunc( text_arena ); text_arena = NULL;
+  oyjlTreeFree( root );
+  oyjlTreeFreeArena( root_arena );
+
+  for(i = 0; numbers[i]; ++i)
+  {
+    double d = strtod( numbers[i], NULL );
+    oyjlStringAdd( &text, 0,0, "[%s]", numbers[i] );
+    root = oyjlTreeParse( text, NULL, 0 );
+    free( text ); text = NULL;
+    v = oyjlTreeGetValue( root, 0, "[0]" );
+    if(!OYJL_IS_DOUBLE(v) || OYJL_GET_DOUBLE(v) != d)
+      break;
+    oyjlTreeFree( root );
+  }
+  if(!numbers[i])
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "number parsing == strtod()              %d", i );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "number parsing == strtod()              %s", numbers[i] );
+    oyjlTreeFree( root );
+  }
+
+#ifdef HAVE_LOCALE_H
+  if(setlocale( LC_NUMERIC, "de_DE.UTF-8" ))
+  {
+    char * locale = oyjlStringCopy( setlocale( LC_NUMERIC, NULL ), malloc );
+    root = oyjlTreeParse( "[2.5,1.0e-30]", NULL, 0 );
+    v = oyjlTreeGetValue( root, 0, "[0]" );
+    if(OYJL_IS_DOUBLE(v) && OYJL_GET_DOUBLE(v) == 2.5 &&
+       OYJL_IS_DOUBLE(oyjlTreeGetValue( root, 0, "[1]" )) &&
+       strcmp( locale, setlocale( LC_NUMERIC, NULL ) ) == 0)
+    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+      "number parsing in %s             ", locale );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "number parsing in %s             ", locale );
+    }
+    oyjlTreeFree( root );
+    free( locale );
+    setlocale( LC_NUMERIC, "C" );
+  } else
+    fprintf( zout, "de_DE.UTF-8 locale not available - skip\n" );
+#endif
+
+  root = oyjlTreeParse( "{\"a\":[1,2,{\"b\":", error_buffer, 128 );
+  root_arena = oyjlTreeParseArena( "{\"a\":[1,2,{\"b\":", error_buffer, 128 );
+  if(!root && !root_arena)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "incomplete JSON                         " );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "incomplete JSON                         " );
+  }
+  oyjlTreeFree( root );
+  oyjlTreeFreeArena( root_arena );
+
+  clck = oyjlClock();
+  for(i = 0; i < n; ++i)
+  {
+    root = oyjlTreeParse( json, NULL, 0 );
+    oyjlTreeFree( root );
+  }
+  clck = oyjlClock() - clck;
+  PRINT_SUB( root ? oyjlTESTRESULT_SUCCESS : oyjlTESTRESULT_FAIL,
+    "oyjlTreeParse()      %s", oyProfilingToString(n*count,clck/(double)CLOCKS_PER_SEC,"dev"));
+
+  clck = oyjlClock();
+  for(i = 0; i < n; ++i)
+  {
+    root_arena = oyjlTreeParseArena( json, NULL, 0 );
+    oyjlTreeFreeArena( root_arena );
+  }
+  clck = oyjlClock() - clck;
+  PRINT_SUB( root_arena ? oyjlTESTRESULT_SUCCESS : oyjlTESTRESULT_FAIL,
+    "oyjlTreeParseArena() %s", oyProfilingToString(n*count,clck/(double)CLOCKS_PER_SEC,"dev"));
+
+  free( json );
+
+  return result;
+}
+
+#define TEST_THREADS 4
+#define TEST_THREAD_DEVICES 500
+static const char * test_thread_json = NULL;
+static void * testJsonThread( void * arg )
+{
+  int i, * errors = (int*) arg;
+
+  for(i = 0; i < 20; ++i)
+  {
+    int arena = i%2;
+    oyjl_val root = arena ? oyjlTreeParseArena( test_thread_json, NULL, 0 ) :
+                            oyjlTreeParse( test_thread_json, NULL, 0 );
+    oyjl_val v = oyjlTreeGetValue( root, 0, "org/freedesktop/openicc/device/[0]" ),
+             gamma = oyjlTreeGetValue( v, 0, "[12]/gamma" );
+    if(oyjlValueCount( v ) != TEST_THREAD_DEVICES ||
+       !OYJL_IS_DOUBLE(gamma) || OYJL_GET_DOUBLE(gamma) != 1.2)
+      ++(*errors);
+    if(arena)
+      oyjlTreeFreeArena( root );
+    else
+      oyjlTreeFree( root );
+  }
+
+  return NULL;
+}
+
+oyjlTESTRESULT_e testJsonThreads ()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  pthread_t threads[TEST_THREADS];
+  int errors[TEST_THREADS], i, started = 0, failed = 0;
+  char * json = testJsonDB( TEST_THREAD_DEVICES );
+
+  fprintf(stdout, "\n" );
+
+  test_thread_json = json;
+  for(i = 0; i < TEST_THREADS; ++i)
+  {
+    errors[i] = 0;
+    if(pthread_create( &threads[i], NULL, testJsonThread, &errors[i] ) == 0)
+      ++started;
+    else
+      break;
+  }
+  for(i = 0; i < started; ++i)
+  {
+    pthread_join( threads[i], NULL );
+    failed += errors[i];
+  }
+
+  if(started == TEST_THREADS && failed == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "parsed in %d threads                    ", started );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "parsed in %d threads errors: %d         ", started, failed );
+  }
+
+  free( json );
+  test_thread_json = NULL;
+
+  return result;
+}
+
+
 
 /* --- end actual tests --- */
 
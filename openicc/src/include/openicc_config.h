@@ -56,6 +56,7 @@ typedef enum {
   openiccOBJECT_NONE,
   openiccOBJECT_CONFIG = 312,
   openiccOBJECT_DB,
+  openiccOBJECT_DB_TRANSACTION,
   openiccOBJECT_OPTION = 1769433455,   /**< @brief openiccOption_s */
   openiccOBJECT_OPTION_GROUP = 1735879023, /**< @brief openiccOptionGroup_s */
   openiccOBJECT_OPTIONS = 1937205615,  /**< @brief openiccOptions_s */
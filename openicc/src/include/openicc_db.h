@@ -55,6 +55,17 @@ char*    openiccDBSearchEmptyKeyname ( const char        * keyParentName,
 int      openiccDBEraseKey_          ( const char        * key_name,
                                        openiccSCOPE_e      scope );
 
+/* batched DB writes */
+typedef struct openiccDBTransaction_s openiccDBTransaction_s;
+openiccDBTransaction_s * openiccDBTransactionBegin (
+                                       openiccSCOPE_e      scope );
+int      openiccDBTransactionSetString(openiccDBTransaction_s * tr,
+                                       const char        * keyName,
+                                       const char        * value,
+                                       const char        * comment );
+int      openiccDBTransactionCommit  ( openiccDBTransaction_s * tr );
+void     openiccDBTransactionRelease ( openiccDBTransaction_s ** tr );
+
 /** 
  *  @} *//*OpenICC_config
  */
@@ -87,6 +87,15 @@ struct openiccDB_s {
   int ks_array_reserved_n;
 };
 
+struct openiccDBTransaction_s {
+  openiccOBJECT_e  type;
+  openiccSCOPE_e   scope;
+  struct openiccDB_s * db;             /* owns root, if the file exists */
+  oyjl_val         root;
+  char           * file_name;
+  int              changes_n;
+};
+
 typedef struct openiccArray_s openiccArray_s;
 int      openiccArray_Count          ( openiccArray_s    * array );
 int      openiccArray_Push           ( openiccArray_s    * array );
@@ -114,6 +123,9 @@ char * openiccOpenFile( const char * file_name,
 int    openiccWriteFile(const char * file_name,
                         void       * ptr,
                         int          size );
+int    openiccWriteFileAtomic_(const char * file_name,
+                        void       * ptr,
+                        int          size );
 int openiccIsFileFull_ (const char* fullFileName, const char * read_mode);
 char * openiccExtractPathFromFileName_(const char        * file_name );
 int    openiccIsDirFull_             ( const char        * name );
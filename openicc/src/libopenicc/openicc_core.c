@@ -55,6 +55,7 @@ const char *       openiccObjectTypeToString (
     case openiccOBJECT_NONE: type_name = ""; break;
     case openiccOBJECT_CONFIG: type_name = "openiccConfig_s"; break;
     case openiccOBJECT_DB: type_name = "openiccDB_s"; break;
+    case openiccOBJECT_DB_TRANSACTION: type_name = "openiccDBTransaction_s"; break;
     case openiccOBJECT_OPTION: type_name = "openiccOption_s"; break;
     case openiccOBJECT_OPTION_GROUP: type_name = "openiccOptionGroup_s"; break;
     case openiccOBJECT_OPTIONS: type_name = "openiccOptions_s"; break;
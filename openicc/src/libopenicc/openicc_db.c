@@ -386,125 +386,203 @@ const char * openiccGetShortKeyFromFullKeyPath( const char * key, char ** temp )
 }
 
 /**
- *  @brief    set a key name to a value
+ *  @brief    start a batch of DB writes
+ *
+ *  The DB file of the scope is parsed once. Keys set through
+ *  openiccDBTransactionSetString() change only the memory copy until
+ *  openiccDBTransactionCommit().
  *
- *  @param[in]     keyName             a key name string
  *  @param[in]     scope               specify to intended user or system scope
+ *  @return                            the transaction or NULL on error;
+ *                                     release with openiccDBTransactionRelease()
+ */
+openiccDBTransaction_s * openiccDBTransactionBegin (
+                                       openiccSCOPE_e      scope )
+{
+  openiccDBTransaction_s * tr = NULL;
+
+  oyjlAllocHelper_m_( tr, openiccDBTransaction_s, 1, malloc, return tr );
+  tr->type = openiccOBJECT_DB_TRANSACTION;
+  tr->scope = scope;
+
+  tr->db = openiccDB_NewFrom( "", scope );
+  if(!tr->db)
+  {
+    ERRc_S( "%s [%s]",
+            _("Could not create a intermediate db object for"),
+            openiccScopeGetString(scope) );
+    openiccDBTransactionRelease( &tr );
+    return tr;
+  }
+
+  if(openiccArray_Count( (openiccArray_s*)&tr->db->ks ))
+  {
+    tr->root = tr->db->ks[0]->oyjl;
+    tr->file_name = oyjlStringCopy( tr->db->ks[0]->info, malloc );
+  }
+  else
+  {
+    openiccDB_Release( &tr->db );
+    tr->root = (oyjl_val) calloc( sizeof(struct oyjl_val_s), 1 );
+    tr->file_name = openiccDBGetJSONFile( scope );
+  }
+
+  if(!tr->root || !tr->file_name)
+  {
+    ERRc_S("%s", _("Could not alloc memory"));
+    openiccDBTransactionRelease( &tr );
+  }
+
+  return tr;
+}
+
+/**
+ *  @brief    set a key name to a value inside a transaction
+ *
+ *  @param[in]     tr                  the transaction
+ *  @param[in]     keyName             a key name string
  *  @param[in]     value               a value string
  *  @param[in]     comment             a comment string;
  *                                     The keyName will be deleted with
  *                                     value=NULL and comment="delete".
  *  @return                            0 - success, >=1 - error, <0 - issue
  */
-int      openiccDBSetString          ( const char        * keyName,
-                                       openiccSCOPE_e      scope,
+int      openiccDBTransactionSetString(openiccDBTransaction_s * tr,
+                                       const char        * keyName,
                                        const char        * value,
                                        const char        * comment )
 {
-  const char * xpath = keyName;
-  openiccDB_s * db = openiccDB_NewFrom( keyName, scope );
   int error = keyName ? 0 : -1;
+  oyjl_val o;
+
+  if(!tr)
+    return 1;
+  if(error)
+    return error;
 
-  if(!db)
+  if(value == NULL && comment && strcmp(comment,"delete") == 0)
   {
-    error = 1;
-    ERRcc_S( db, "%s [%s]/%s",
-             _("Could not create a intermediate db object for"),
-             openiccScopeGetString(scope), keyName?keyName:"" );
+    oyjlTreeClearValue( tr->root, keyName );
+    ++tr->changes_n;
+    return error;
   }
 
-  if(!error)
-  {
-    oyjl_val root;
-    char * file_name;
+  o = oyjlTreeGetValue( tr->root, OYJL_CREATE_NEW, keyName );
+  if(o)
+    error = oyjlValueSetString( o, value );
+  else
+    error = 1;
 
-    if(openiccArray_Count( (openiccArray_s*)&db->ks ))
-    {
-      root = db->ks[0]->oyjl;
-      file_name = oyjlStringCopy( db->ks[0]->info, malloc );
-    }
-    else
-    {
-      openiccDB_Release( &db );
-      root = (oyjl_val) calloc( sizeof(struct oyjl_val_s), 1 );
-      file_name = openiccDBGetJSONFile( scope );
-    }
-    if(!file_name)
-    {
-      ERRc_S("%s", _("Could not alloc memory"));
-      error = 1;
-    }
+  if(error)
+    ERRcc_S( tr, "%s [%s]/%s",
+             _("Could not set JSON string for"),
+             openiccScopeGetString(tr->scope), keyName );
+  else
+    ++tr->changes_n;
 
-    if(!error && root)
-    {
-      oyjl_val o = oyjlTreeGetValue( root, OYJL_CREATE_NEW, xpath );
-      if(o)
-      { 
-        if(value == NULL && comment && strcmp(comment,"delete") == 0)
-        {
-          oyjlTreeClearValue( root, keyName );
-        } else
-          error = oyjlValueSetString( o, value );
-        if(error)
-        {
-          ERRcc_S( db, "%s [%s]/%s",
-                   _("Could not set JSON string for"),
-                   openiccScopeGetString(scope), keyName?keyName:"" );
-        } else
-        {
-          char * json = NULL;
-          int size = 0, result = 0;
-          int level = 0;
-
-          oyjlTreeToJson( root, &level, &json );
-          if(json)
-          {
-            size = strlen(json);
-            if(size)
-            {
-              result = openiccWriteFile( file_name, json, size );
-              if(result != size)
-              { error = 1;
-                ERRcc_S( db, "%s [%s]/%s",
-                         _("Writing failed for"), file_name,
-                         openiccScopeGetString(scope), keyName?keyName:"" );
-              }
-            }
-            else
-            { error = 1;
-              ERRcc_S( db, "%s [%s]/%s",
-                       _("No JSON content obtained for"),
-                       openiccScopeGetString(scope), keyName?keyName:"" );
-            }
-
-            free( json ); json = NULL;
-          }
-          else
-          { error = 1;
-            ERRcc_S( db, "%s [%s]/%s",
-                     _("No JSON obtained for"),
-                     openiccScopeGetString(scope), keyName?keyName:"" );
-          }
-        }
-      }
-      else
-      { error = 1;
-        ERRcc_S( db, "%s [%s]/%s",
-                 _("Could not obtain JSON node for"),
-                 openiccScopeGetString(scope), keyName?keyName:"" );
-      }
+  return error;
+}
 
-    } else
-    { error = 1;
-      ERRcc_S( db, "%s [%s]/%s",
-               _("Could not create root JSON node for"),
-               openiccScopeGetString(scope), keyName?keyName:"" );
-    }
-    if(root && !db) oyjlTreeFree(root);
-    openiccDB_Release( &db );
-    if(file_name) free(file_name);
+/**
+ *  @brief    write all changes of a transaction
+ *
+ *  The tree is serialised once and replaces the DB file atomically. A
+ *  transaction without changes does not touch the file.
+ *
+ *  @param[in]     tr                  the transaction
+ *  @return                            0 - success, >=1 - error
+ */
+int      openiccDBTransactionCommit  ( openiccDBTransaction_s * tr )
+{
+  char * json = NULL;
+  int level = 0, error = 0;
+
+  if(!tr)
+    return 1;
+  if(!tr->changes_n)
+    return 0;
+
+  oyjlTreeToJson( tr->root, &level, &json );
+  if(json && strlen(json))
+  {
+    error = openiccWriteFileAtomic_( tr->file_name, json, strlen(json) );
+    if(error)
+      ERRcc_S( tr, "%s %s [%s]",
+               _("Writing failed for"), tr->file_name,
+               openiccScopeGetString(tr->scope) );
+    else
+      tr->changes_n = 0;
+  }
+  else
+  { error = 1;
+    ERRcc_S( tr, "%s %s [%s]",
+             _("No JSON content obtained for"), tr->file_name,
+             openiccScopeGetString(tr->scope) );
   }
 
+  if(json) free( json );
+
+  return error;
+}
+
+/**
+ *  @brief    release a transaction
+ *
+ *  Uncommitted changes are dropped.
+ */
+void     openiccDBTransactionRelease ( openiccDBTransaction_s ** tr )
+{
+  openiccDBTransaction_s * s;
+
+  if(!tr || !*tr)
+    return;
+
+  s = *tr;
+  if(s->db)
+    openiccDB_Release( &s->db );
+  else if(s->root)
+    oyjlTreeFree( s->root );
+  if(s->file_name)
+    free( s->file_name );
+  free( s );
+  *tr = NULL;
+}
+
+/**
+ *  @brief    set a key name to a value
+ *
+ *  This is a transaction with a single key. Use openiccDBTransactionBegin()
+ *  for writing many keys.
+ *
+ *  @param[in]     keyName             a key name string
+ *  @param[in]     scope               specify to intended user or system scope
+ *  @param[in]     value               a value string
+ *  @param[in]     comment             a comment string;
+ *                                     The keyName will be deleted with
+ *                                     value=NULL and comment="delete".
+ *  @return                            0 - success, >=1 - error, <0 - issue
+ */
+int      openiccDBSetString          ( const char        * keyName,
+                                       openiccSCOPE_e      scope,
+                                       const char        * value,
+                                       const char        * comment )
+{
+  openiccDBTransaction_s * tr;
+  int error = keyName ? 0 : -1;
+
+  if(error)
+    return error;
+
+  tr = openiccDBTransactionBegin( scope );
+  if(!tr)
+    return 1;
+
+  error = openiccDBTransactionSetString( tr, keyName, value, comment );
+  if(!error)
+    error = openiccDBTransactionCommit( tr );
+
+  openiccDBTransactionRelease( &tr );
+
   return error;
 }
 
@@ -124,6 +124,9 @@ int          openiccReadFileSToMem   ( FILE              * fp,
 
 #include <errno.h>
 #include <sys/stat.h> /* mkdir() */
+#ifdef HAVE_POSIX
+#include <fcntl.h>    /* open() */
+#endif
 char* openiccExtractPathFromFileName_ (const char* file_name)
 {
   char * path_name = NULL;
@@ -356,3 +359,88 @@ int  openiccWriteFile ( const char * filename,
 
   return written_n;
 }
+
+/** @internal
+ *  @brief    replace a file in one step
+ *
+ *  The data goes into a temporary file beside the target, is flushed to
+ *  disk and is then renamed over the target. Readers see either the old
+ *  or the new content, even after a crash in between.
+ *
+ *  @return                            0 - success, >=1 - error
+ */
+int  openiccWriteFileAtomic_ ( const char * file_name,
+                               void       * mem,
+                               int          size )
+{
+  FILE * fp = NULL;
+  char * path = NULL,
+       * tmp_name = NULL;
+  int r = !file_name || !mem || size <= 0;
+
+  if(r)
+  {
+    WARNc_S("no data to write into: \"%s\"", openiccNoEmptyString_m_(file_name) );
+    return r;
+  }
+
+  path = openiccExtractPathFromFileName_( file_name );
+  r = openiccMakeDir_( path );
+
+  if(!r)
+  {
+#ifdef HAVE_POSIX
+    oyjlStringAdd( &tmp_name, 0,0, "%s.tmp-%d", file_name, (int)getpid() );
+#else
+    oyjlStringAdd( &tmp_name, 0,0, "%s.tmp", file_name );
+#endif
+    fp = tmp_name ? fopen( tmp_name, "wb" ) : NULL;
+    if(!fp)
+      r = errno ? errno : 1;
+  }
+
+  if(fp)
+  {
+    if((int)fwrite( mem, 1, size, fp ) != size)
+      r = errno ? errno : 1;
+    if(!r && fflush( fp ) != 0)
+      r = errno ? errno : 1;
+#ifdef HAVE_POSIX
+    if(!r && fsync( fileno( fp ) ) != 0)
+      r = errno ? errno : 1;
+#endif
+    if(fclose( fp ) != 0 && !r)
+      r = errno ? errno : 1;
+
+#ifndef HAVE_POSIX
+    /* rename() does not replace on all systems */
+    if(!r)
+      remove( file_name );
+#endif
+    if(!r && rename( tmp_name, file_name ) != 0)
+      r = errno ? errno : 1;
+
+    if(r)
+      remove( tmp_name );
+#ifdef HAVE_POSIX
+    else
+    {
+      /* make the new directory entry durable */
+      int fd = open( path, O_RDONLY );
+      if(fd >= 0)
+      {
+        fsync( fd );
+        close( fd );
+      }
+    }
+#endif
+  }
+
+  if(r)
+    WARNc_S( "%s: \"%s\" %s", _("Writing failed for"), file_name, strerror(r) );
+
+  if(tmp_name) free( tmp_name );
+  if(path) free( path );
+
+  return r;
+}
@@ -32,6 +32,7 @@
   TEST_RUN( testPaths, "Paths", 1 ); \
   TEST_RUN( testXDG, "XDG", 1 ); \
   TEST_RUN( testODB, "ODB", 1 ); \
+  TEST_RUN( testODBTransaction, "ODB transactions", 1 ); \
   //TEST_RUN( testDB, "DB" );
 
 #include "oyjl_test.h"
@@ -1144,6 +1145,141 @@ oyjlTESTRESULT_e testODB()
   return result;
 }
 
+#ifdef HAVE_POSIX
+#include <signal.h>
+#include <sys/wait.h>
+#endif
+oyjlTESTRESULT_e testODBTransaction()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  const char * base = "org/freedesktop/openicc/tests/transaction";
+  openiccDBTransaction_s * tr;
+  openiccDB_s * db;
+  char * key = NULL;
+  const char * value = NULL;
+  int i, n = 50, error = 0, count = 0;
+  double clck, single, batch;
+
+  fprintf(stdout, "\n" );
+
+  /* one file write per key */
+  clck = oyjlSeconds();
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyjlStringAdd( &key, 0,0, "%s/key_%d", base, i );
+    error = openiccDBSetString( key, openiccSCOPE_USER, "single", NULL );
+    free_m_(key);
+  }
+  single = oyjlSeconds() - clck;
+
+  /* one file write for all keys */
+  clck = oyjlSeconds();
+  tr = openiccDBTransactionBegin( openiccSCOPE_USER );
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyjlStringAdd( &key, 0,0, "%s/key_%d", base, i );
+    error = openiccDBTransactionSetString( tr, key, "batch", NULL );
+    free_m_(key);
+  }
+  if(!error)
+    error = openiccDBTransactionCommit( tr );
+  openiccDBTransactionRelease( &tr );
+  batch = oyjlSeconds() - clck;
+
+  db = openiccDB_NewFrom( base, openiccSCOPE_USER );
+  for(i = 0; i < n; ++i)
+  {
+    oyjlStringAdd( &key, 0,0, "%s/key_%d", base, i );
+    if(openiccDB_GetString( db, key, &value ) == 0 &&
+       value && strcmp(value, "batch") == 0)
+      ++count;
+    free_m_(key);
+  }
+  openiccDB_Release( &db );
+  if(!error && count == n)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "openiccDBTransactionCommit() %d keys             ", count );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "openiccDBTransactionCommit() %d keys error: %d   ", count, error );
+  }
+  if(single > 0.0 && batch > 0.0)
+  {
+    PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "openiccDBSetString()         %s", oyProfilingToString(n,single,"key") );
+    PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "openiccDBTransaction*()      %s", oyProfilingToString(n,batch,"key") );
+  }
+
+  /* a released transaction drops its changes */
+  tr = openiccDBTransactionBegin( openiccSCOPE_USER );
+  openiccDBTransactionSetString( tr, base, NULL, "delete" );
+  openiccDBTransactionRelease( &tr );
+  db = openiccDB_NewFrom( base, openiccSCOPE_USER );
+  oyjlStringAdd( &key, 0,0, "%s/key_0", base );
+  error = openiccDB_GetString( db, key, &value );
+  free_m_(key);
+  openiccDB_Release( &db );
+  if(!error)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "openiccDBTransactionRelease() without commit     " );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "openiccDBTransactionRelease() without commit     " );
+  }
+
+  error = openiccDBSetString( base, openiccSCOPE_USER, NULL, "delete" );
+
+#ifdef HAVE_POSIX
+  /* kill a writer at random times; the file must hold one complete version */
+  {
+    const char * file_name = "test_openicc_atomic.json";
+    int size = 1 << 20, intact = 0, runs = 8, run;
+    char * a = malloc( size ), * b = malloc( size );
+
+    memset( a, 'a', size );
+    memset( b, 'b', size );
+    openiccWriteFileAtomic_( file_name, a, size );
+
+    for(run = 0; run < runs; ++run)
+    {
+      pid_t pid = fork();
+      if(pid == 0)
+      {
+        for(i = 0; ; ++i)
+          openiccWriteFileAtomic_( file_name, i%2 ? a : b, size );
+      }
+      else if(pid > 0)
+      {
+        char * text;
+        int text_size = 0;
+        usleep( 20000 + rand() % 30000 );
+        kill( pid, SIGKILL );
+        waitpid( pid, NULL, 0 );
+        text = openiccOpenFile( file_name, &text_size );
+        if(text && text_size == size &&
+           (memcmp( text, a, size ) == 0 || memcmp( text, b, size ) == 0))
+          ++intact;
+        free_m_(text);
+      }
+    }
+
+    if(intact == runs)
+    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+      "openiccWriteFileAtomic_() killed writer %d/%d intact", intact, runs );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "openiccWriteFileAtomic_() killed writer %d/%d intact", intact, runs );
+    }
+
+    remove( file_name );
+    free( a );
+    free( b );
+  }
+#endif
+
+  return result;
+}
 
 /* --- end actual tests --- */
 
@@ -347,7 +347,7 @@ oyArray2d_s_ * oyArray2d_Copy_ ( oyArray2d_s_ *array2d, oyObject_s object )
     
     if(oy_debug_objects >= 0 && s->oy_)
     {
-      const char * t = getenv(OY_DEBUG_OBJECTS);
+      const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
       int id_ = -1;
 
       if(t)
@@ -461,7 +461,7 @@ int oyArray2d_Release_( oyArray2d_s_ **array2d )
 
   if(oy_debug_objects >= 0 && s->oy_)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -545,7 +545,7 @@ int oyArray2d_Release_( oyArray2d_s_ **array2d )
 
   if(oy_debug_objects >= 0)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -359,7 +359,7 @@ oyBlob_s_ * oyBlob_Copy_ ( oyBlob_s_ *blob, oyObject_s object )
     
     if(oy_debug_objects >= 0 && s->oy_)
     {
-      const char * t = getenv(OY_DEBUG_OBJECTS);
+      const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
       int id_ = -1;
 
       if(t)
@@ -473,7 +473,7 @@ int oyBlob_Release_( oyBlob_s_ **blob )
 
   if(oy_debug_objects >= 0 && s->oy_)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -557,7 +557,7 @@ int oyBlob_Release_( oyBlob_s_ **blob )
 
   if(oy_debug_objects >= 0)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
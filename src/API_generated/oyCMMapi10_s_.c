@@ -348,7 +348,7 @@ oyCMMapi10_s_ * oyCMMapi10_Copy_ ( oyCMMapi10_s_ *cmmapi10, oyObject_s object )
     
     if(oy_debug_objects >= 0 && s->oy_)
     {
-      const char * t = getenv(OY_DEBUG_OBJECTS);
+      const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
       int id_ = -1;
 
       if(t)
@@ -462,7 +462,7 @@ int oyCMMapi10_Release_( oyCMMapi10_s_ **cmmapi10 )
 
   if(oy_debug_objects >= 0 && s->oy_)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -546,7 +546,7 @@ int oyCMMapi10_Release_( oyCMMapi10_s_ **cmmapi10 )
 
   if(oy_debug_objects >= 0)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -92,6 +92,23 @@ typedef int  (*oyMOptions_Handle_f)  ( oyOptions_s       * options,
                                        const char        * command,
                                        oyOptions_s      ** result );
 
+/** @struct  oyCMMapi10Command_s
+ *  @brief   a command with its direct handler
+ *  @ingroup module_api
+ *  @memberof oyCMMapi10_s
+ *
+ *  oyOptions_Handle() calls the handler of a declared command without the
+ *  "can_handle" probe. The handler checks the options itself.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2018/04/08 (Oyranos: 0.9.7)
+ *  @date    2018/04/08
+ */
+typedef struct {
+  const char        * command;         /**< e.g. "saturation_line" */
+  oyMOptions_Handle_f handler;         /**< the command handler */
+} oyCMMapi10Command_s;
+
 /* } Include "CMMapi10.private.h" */
 
 /** @internal
@@ -155,6 +172,10 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
   char          ** texts;              /**< zero terminated list for getText */
 
   oyMOptions_Handle_f oyMOptions_Handle; /**< @memberof oyCMMapi10_s */
+  /** zero terminated list of commands for direct dispatch; optional
+   *  Commands not listed here go through the "can_handle" probe.
+   */
+  oyCMMapi10Command_s * commands;
 
 /* } Include "CMMapi10.members.h" */
 
@@ -330,7 +330,7 @@ oyCMMapi3_s_ * oyCMMapi3_Copy_ ( oyCMMapi3_s_ *cmmapi3, oyObject_s object )
     
     if(oy_debug_objects >= 0 && s->oy_)
     {
-      const char * t = getenv(OY_DEBUG_OBJECTS);
+      const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
       int id_ = -1;
 
       if(t)
@@ -444,7 +444,7 @@ int oyCMMapi3_Release_( oyCMMapi3_s_ **cmmapi3 )
 
   if(oy_debug_objects >= 0 && s->oy_)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -528,7 +528,7 @@ int oyCMMapi3_Release_( oyCMMapi3_s_ **cmmapi3 )
 
   if(oy_debug_objects >= 0)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -386,7 +386,7 @@ oyCMMapi4_s_ * oyCMMapi4_Copy_ ( oyCMMapi4_s_ *cmmapi4, oyObject_s object )
     
     if(oy_debug_objects >= 0 && s->oy_)
     {
-      const char * t = getenv(OY_DEBUG_OBJECTS);
+      const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
       int id_ = -1;
 
       if(t)
@@ -500,7 +500,7 @@ int oyCMMapi4_Release_( oyCMMapi4_s_ **cmmapi4 )
 
   if(oy_debug_objects >= 0 && s->oy_)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -584,7 +584,7 @@ int oyCMMapi4_Release_( oyCMMapi4_s_ **cmmapi4 )
 
   if(oy_debug_objects >= 0)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
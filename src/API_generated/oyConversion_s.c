@@ -523,9 +523,9 @@ oyFilterGraph_s  * oyConversion_GetGraph (
  *  @param[in]     flags               OY_INPUT or OY_OUTPUT
  *  @return                            the image
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
  *  @since   2009/02/19 (Oyranos: 0.1.10)
- *  @date    2009/02/19
+ *  @date    2018/03/22
  */
 oyImage_s        * oyConversion_GetImage (
                                        oyConversion_s    * conversion,
@@ -573,8 +573,8 @@ oyImage_s        * oyConversion_GetImage (
           /* Run the graph to set up processing image data. */
           plug = (oyFilterPlug_s_*) oyFilterNode_GetPlug(
                                                   (oyFilterNode_s*)s->out_, 0 );
-          pixel_access = oyPixelAccess_Create( 0,0, (oyFilterPlug_s*)plug,
-                                               oyPIXEL_ACCESS_IMAGE, 0 );
+          pixel_access = oyConversion_GetTicket( conversion, 0,0,
+                                                 oyPIXEL_ACCESS_IMAGE );
           s->out_->api7_->oyCMMFilterPlug_Run( (oyFilterPlug_s*)plug,
                                                pixel_access );
 
@@ -582,7 +582,7 @@ oyImage_s        * oyConversion_GetImage (
           /* error = oyFilterNode_SetData( s->out_,
                                         (oyStruct_s*)pixel_access->output_image,
                                         0, 0 ); */
-          oyPixelAccess_Release( &pixel_access );
+          oyConversion_RecycleTicket( conversion, &pixel_access );
 
           image = oyImage_Copy( (oyImage_s*) plug->remote_socket_->data, 0 );
         }
@@ -668,6 +668,128 @@ int          oyConversion_GetOnePixel( oyConversion_s    * conversion,
   return error;
 }
 
+/** Function  oyConversion_GetTicket
+ *  @memberof oyConversion_s
+ *  @brief    Get a pixel access ticket for repeated requests
+ *
+ *  The graph of the conversion is compiled on first call. Tickets reference
+ *  its nodes and edges and hold only own options, ROI and array. Tickets
+ *  from oyConversion_RecycleTicket() are reused. The result is otherwise
+ *  the same as from oyPixelAccess_Create() for the output plug.
+ *
+ *  @code
+  ticket = oyConversion_GetTicket( conversion, 0,0, oyPIXEL_ACCESS_IMAGE );
+  oyPixelAccess_ChangeRectangle( ticket, 0,0, tile );
+  error = oyConversion_RunPixels( conversion, ticket );
+  oyConversion_RecycleTicket( conversion, &ticket );
+    @endcode
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in]     start_x             x position relative to virtual source
+ *                                     image
+ *  @param[in]     start_y             y position relative to virtual source
+ *                                     image
+ *  @param[in]     type                the pixel access type
+ *  @return                            the ticket
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/22
+ *  @since   2018/03/22 (Oyranos: 0.9.7)
+ */
+oyPixelAccess_s  * oyConversion_GetTicket (
+                                       oyConversion_s    * conversion,
+                                       int32_t             start_x,
+                                       int32_t             start_y,
+                                       oyPIXEL_ACCESS_TYPE_e type )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  oyFilterPlug_s * plug = 0;
+  oyFilterGraph_s * graph = 0;
+  oyPixelAccess_s_ * ticket = 0;
+  int error = 0;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return NULL )
+
+  /* conversion->out_ has to be linear, so we access only the first plug */
+  plug = oyFilterNode_GetPlug( (oyFilterNode_s*)s->out_, 0 );
+  if(!plug || !((oyFilterPlug_s_*)plug)->remote_socket_)
+  {
+    oyFilterPlug_Release( &plug );
+    return NULL;
+  }
+
+  oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+  if(!s->graph_)
+    s->graph_ = oyFilterGraph_FromNode( (oyFilterNode_s*)s->input, 0 );
+  graph = oyFilterGraph_Copy( s->graph_, NULL );
+  if(s->tickets_n_)
+    ticket = (oyPixelAccess_s_*)s->tickets_[--s->tickets_n_];
+  oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+  if(!ticket)
+    ticket = (oyPixelAccess_s_*)oyPixelAccess_New( 0 );
+
+  error = oyPixelAccess_Init_( ticket, start_x, start_y, plug, type );
+
+  /* a real copy shares the node and edge lists, but not the options */
+  if(error <= 0)
+    ticket->graph = (oyFilterGraph_s_*)oyFilterGraph_Copy( graph, ticket->oy_ );
+
+  if(error)
+    oyPixelAccess_Release( (oyPixelAccess_s**)&ticket );
+
+  oyFilterGraph_Release( &graph );
+  oyFilterPlug_Release( &plug );
+
+  return (oyPixelAccess_s*)ticket;
+}
+
+/** Function  oyConversion_RecycleTicket
+ *  @memberof oyConversion_s
+ *  @brief    Give a ticket back for reuse
+ *
+ *  A ticket without further references is reset and kept for the next
+ *  oyConversion_GetTicket() call. Otherwise or if enough tickets are kept,
+ *  the ticket is released.
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in,out] ticket              the ticket; will be set to NULL
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/22
+ *  @since   2018/03/22 (Oyranos: 0.9.7)
+ */
+int                oyConversion_RecycleTicket (
+                                       oyConversion_s    * conversion,
+                                       oyPixelAccess_s  ** ticket )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+
+  if(!ticket || !*ticket)
+    return 0;
+
+  if(s && s->type_ == oyOBJECT_CONVERSION_S &&
+     (*ticket)->type_ == oyOBJECT_PIXEL_ACCESS_S &&
+     oyObject_GetRefCount( (*ticket)->oy_ ) == 1)
+  {
+    oyPixelAccess_Reset_( (oyPixelAccess_s_*)*ticket );
+
+    oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+    if(s->tickets_n_ < oyCONVERSION_TICKETS_MAX)
+    {
+      s->tickets_[s->tickets_n_++] = *ticket;
+      *ticket = NULL;
+    }
+    oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+  }
+
+  if(*ticket)
+    oyPixelAccess_Release( ticket );
+
+  return 0;
+}
+
 /** Function  oyConversion_RunPixels
  *  @memberof oyConversion_s
  *  @brief    Process a pixel conversion graph
@@ -680,9 +802,9 @@ int          oyConversion_GetOnePixel( oyConversion_s    * conversion,
  *                                     data.
  *  @return                            0 on success, else error
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
  *  @since   2008/07/06 (Oyranos: 0.1.8)
- *  @date    2009/03/06
+ *  @date    2018/03/22
  *
  *  Here a very basic code snippet:
  *  @code
@@ -719,7 +841,7 @@ int                oyConversion_RunPixels (
   oyFilterNode_s * node_out = 0;
   oyImage_s * image_out = 0,
             * image_input = 0;
-  int error = 0, result = 0, dirty = 0;
+  int error = 0, result = 0, dirty = 0, own_ticket = 0;
   oyRectangle_s_ roi = {oyOBJECT_RECTANGLE_S, 0,0,0, 0,0,0,0};
   double clck;
 
@@ -742,16 +864,18 @@ int                oyConversion_RunPixels (
 
   if(!pixel_access_)
   {
-    /** The function creates a very simple pixel iterator if no job ticket
-        is passed in as __pixel_access__. */
+    /** The function obtains a very simple pixel iterator from
+        oyConversion_GetTicket() if no job ticket is passed in as
+        __pixel_access__. */
     if(plug)
     {
       if(oy_debug) clck = oyClock();
-      pixel_access_ = (oyPixelAccess_s_*)oyPixelAccess_Create( 0,0, plug,
-                                                      oyPIXEL_ACCESS_IMAGE, 0 );
+      pixel_access_ = (oyPixelAccess_s_*)oyConversion_GetTicket( conversion,
+                                                0,0, oyPIXEL_ACCESS_IMAGE );
+      own_ticket = 1;
       if(oy_debug)
       { clck = oyClock() - clck;
-        DBG_PROG1_S("oyPixelAccess_Create(): %g", clck/1000000.0 );
+        DBG_PROG1_S("oyConversion_GetTicket(): %g", clck/1000000.0 );
       }
     }
   }
@@ -804,6 +928,10 @@ int                oyConversion_RunPixels (
     /* refresh the graph representation */
     if(oy_debug) clck = oyClock();
     oyFilterGraph_SetFromNode( (oyFilterGraph_s*)pixel_access_->graph, (oyFilterNode_s*)s->input, 0, 0 );
+    /* the compiled graph for new tickets is outdated as well */
+    oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+    oyFilterGraph_Release( &s->graph_ );
+    oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
     if(oy_debug)
     { clck = oyClock() - clck;
       DBGs_PROG1_S(pixel_access_,"oyFilterGraph_SetFromNode(): %g",clck/1000000.0 );
@@ -909,7 +1037,10 @@ int                oyConversion_RunPixels (
                                 pixel_access_->array, 0 );
   }
 
-  oyPixelAccess_Release( (oyPixelAccess_s**)&pixel_access_ );
+  if(own_ticket)
+    oyConversion_RecycleTicket( conversion, (oyPixelAccess_s**)&pixel_access_ );
+  else
+    oyPixelAccess_Release( (oyPixelAccess_s**)&pixel_access_ );
 
   oyImage_Release( &image_out );
   oyFilterPlug_Release( &plug );
@@ -927,9 +1058,12 @@ int                oyConversion_RunPixels (
  *  @param[in]     output              output node
  *  @return                            0 on success, else error
  *
- *  @version Oyranos: 0.1.10
+ *  The compiled graph and the recycled tickets of
+ *  oyConversion_GetTicket() are dropped.
+ *
+ *  @version Oyranos: 0.9.7
  *  @since   2009/03/05 (Oyranos: 0.1.10)
- *  @date    2009/03/05
+ *  @date    2018/03/22
  */
 int                oyConversion_Set  ( oyConversion_s    * conversion,
                                        oyFilterNode_s    * input,
@@ -946,6 +1080,10 @@ int                oyConversion_Set  ( oyConversion_s    * conversion,
   if(output)
     s->out_ = (oyFilterNode_s_*)oyFilterNode_Copy(output,NULL);
 
+  oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+  oyConversion_DropTickets_( s );
+  oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
   return error;
 }
 
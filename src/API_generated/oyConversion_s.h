@@ -264,6 +264,16 @@ OYAPI int  OYEXPORT
                                        double              x,
                                        double              y,
                                        oyPixelAccess_s   * pixel_access );
+OYAPI oyPixelAccess_s *  OYEXPORT
+                oyConversion_GetTicket (
+                                       oyConversion_s    * conversion,
+                                       int32_t             start_x,
+                                       int32_t             start_y,
+                                       oyPIXEL_ACCESS_TYPE_e type );
+OYAPI int  OYEXPORT
+                 oyConversion_RecycleTicket (
+                                       oyConversion_s    * conversion,
+                                       oyPixelAccess_s  ** ticket );
 OYAPI int  OYEXPORT
                  oyConversion_RunPixels (
                                        oyConversion_s    * conversion,
@@ -103,6 +103,8 @@ void oyConversion_Release__Members( oyConversion_s_ * conversion )
    */
   oyFilterGraph_s * g = oyFilterGraph_New( 0 );
   int i,n;
+
+  oyConversion_DropTickets_( conversion );
   oyFilterGraph_SetFromNode( g, (oyFilterNode_s*)conversion->input, 0, 0 );
 
   oyFilterNode_Release( (oyFilterNode_s**)&conversion->input );
@@ -350,7 +352,7 @@ oyConversion_s_ * oyConversion_Copy_ ( oyConversion_s_ *conversion, oyObject_s o
     
     if(oy_debug_objects >= 0 && s->oy_)
     {
-      const char * t = getenv(OY_DEBUG_OBJECTS);
+      const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
       int id_ = -1;
 
       if(t)
@@ -464,7 +466,7 @@ int oyConversion_Release_( oyConversion_s_ **conversion )
 
   if(oy_debug_objects >= 0 && s->oy_)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -548,7 +550,7 @@ int oyConversion_Release_( oyConversion_s_ **conversion )
 
   if(oy_debug_objects >= 0)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -607,6 +609,26 @@ int oyConversion_Release_( oyConversion_s_ **conversion )
 
 
 /* Include "Conversion.private_methods_definitions.c" { */
+/** Function  oyConversion_DropTickets_
+ *  @memberof oyConversion_s
+ *  @brief    Release the compiled graph and the recycled tickets
+ *  @internal
+ *
+ *  Needed after the graph changed. The caller locks the object.
+ *
+ *  @param[in,out] s                   the conversion
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/22
+ *  @since   2018/03/22 (Oyranos: 0.9.7)
+ */
+void               oyConversion_DropTickets_ (
+                                       oyConversion_s_   * s )
+{
+  oyFilterGraph_Release( &s->graph_ );
+  while(s->tickets_n_)
+    oyPixelAccess_Release( &s->tickets_[--s->tickets_n_] );
+}
 
 /* } Include "Conversion.private_methods_definitions.c" */
 
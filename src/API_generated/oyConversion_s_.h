@@ -40,6 +40,9 @@ typedef struct oyConversion_s_ oyConversion_s_;
 #include "oyConversion_s.h"
 
 /* Include "Conversion.private.h" { */
+/** @internal
+ *  @brief   recycled oyPixelAccess_s tickets kept per conversion */
+#define oyCONVERSION_TICKETS_MAX 8
 
 /* } Include "Conversion.private.h" */
 
@@ -64,6 +67,9 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
 /* Include "Conversion.members.h" { */
   oyFilterNode_s_    * input;          /**< the input image filter; Most users will start logically with this pice and chain their filters to get the final result. */
   oyFilterNode_s_    * out_;           /**< @private the Oyranos output image. Oyranos will stream the filters starting from the end. This element will be asked on its first plug. */
+  oyFilterGraph_s    * graph_;         /**< @private compiled graph; tickets reference its nodes and edges */
+  oyPixelAccess_s    * tickets_[oyCONVERSION_TICKETS_MAX]; /**< @private recycled tickets */
+  int                  tickets_n_;     /**< @private number of recycled tickets */
 
 /* } Include "Conversion.members.h" */
 
@@ -82,6 +88,8 @@ int
 
 
 /* Include "Conversion.private_methods_declarations.h" { */
+void               oyConversion_DropTickets_ (
+                                       oyConversion_s_   * s );
 
 /* } Include "Conversion.private_methods_declarations.h" */
 
@@ -291,17 +291,28 @@ OYAPI int OYEXPORT
   return oyFilterPlugs_Count( s->edges );
 }
 
+/** @internal
+ *  upper bound of threads for concurrent context preparation */
+#define oyFILTERGRAPH_THREADS_MAX 4
+
 /** Function  oyFilterGraph_PrepareContexts
  *  @memberof oyFilterGraph_s
  *  @brief    Iterate over a filter graph and possibly prepare contexts
  *
+ *  Nodes with different contexts are prepared concurrently, if Oyranos was
+ *  build with OpenMP and a thread locking API is set with
+ *  oyThreadLockingSet(). Nodes with the same oyCMMapi4_s context hash
+ *  wait for the first such node and take its context from the cache.
+ *
  *  @param[in,out] graph               a filter graph
- *  @param[in]     flags               1 - enforce a context preparation
+ *  @param[in]     flags               - 1 - enforce a context preparation
+ *                                     - oyFILTERGRAPH_PREPARE_SERIAL -
+ *                                       prepare one node after the other
  *  @return                            0 on success, else error
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
  *  @since   2009/02/28 (Oyranos: 0.1.10)
- *  @date    2009/03/01
+ *  @date    2018/03/23
  */
 OYAPI int  OYEXPORT
            oyFilterGraph_PrepareContexts (
@@ -311,16 +322,28 @@ OYAPI int  OYEXPORT
   oyOption_s * o = 0;
   oyFilterNode_s_ * node = 0;
   oyFilterGraph_s_ * s = (oyFilterGraph_s_*)graph;
-  int i, n, do_it;
+  oyFilterNode_s_ ** todo = NULL;
+  oyHash_s ** keys = NULL;
+  char * lead = NULL;
+  int i, j, n, todo_n = 0, lead_n = 0, threads = 1, do_it;
 
   oyCheckType__m( oyOBJECT_FILTER_GRAPH_S, return 1 )
 
   n = oyFilterNodes_Count( s->nodes );
+  if(n > 0)
+  {
+    oyAllocHelper_m_( todo, oyFilterNode_s_*, n, 0, return 1 );
+    oyAllocHelper_m_( keys, oyHash_s*, n, 0, oyFree_m_( todo ); return 1 );
+    oyAllocHelper_m_( lead, char, n, 0, oyFree_m_( todo ); oyFree_m_( keys );
+                      return 1 );
+  }
+
+  /* collect the nodes in need of a context; the first one per hash leads */
   for(i = 0; i < n; ++i)
   {
     node = (oyFilterNode_s_*) oyFilterNodes_Get( s->nodes, i );
 
-    if(flags || !node->backend_data)
+    if(flags & 0x01 || !node->backend_data)
       do_it = 1;
     else
       do_it = 0;
@@ -328,11 +351,42 @@ OYAPI int  OYEXPORT
     if(do_it &&
        ((oyCMMapi4_s_*)node->core->api4_)->oyCMMFilterNode_ContextToMem &&
        strlen(((oyCMMapi7_s_*)node->api7_)->context_type))
-      oyFilterNode_SetContext_( node, 0 );
+    {
+      keys[todo_n] = oyFilterNode_GetHash_( node, 4 );
+      for(j = 0; j < todo_n; ++j)
+        if(keys[j] == keys[todo_n])
+          break;
+      lead[todo_n] = (j == todo_n);
+      if(lead[todo_n])
+        ++lead_n;
+      todo[todo_n++] = node;
+    } else
+      oyFilterNode_Release( (oyFilterNode_s**)&node );
+  }
 
-    oyFilterNode_Release( (oyFilterNode_s**)&node );
+#if defined(_OPENMP)
+  if(lead_n > 1 && !(flags & oyFILTERGRAPH_PREPARE_SERIAL) &&
+     oyThreadLockingReady())
+    threads = OY_MIN( lead_n, oyFILTERGRAPH_THREADS_MAX );
+#pragma omp parallel for num_threads(threads) schedule(dynamic) if(threads > 1)
+#endif
+  for(i = 0; i < todo_n; ++i)
+    if(lead[i])
+      oyFilterNode_SetContext_( todo[i], 0 );
+
+  /* the others find their context in the cache */
+  for(i = 0; i < todo_n; ++i)
+  {
+    if(!lead[i])
+      oyFilterNode_SetContext_( todo[i], 0 );
+    oyHash_Release( &keys[i] );
+    oyFilterNode_Release( (oyFilterNode_s**)&todo[i] );
   }
 
+  if(todo) oyFree_m_( todo );
+  if(keys) oyFree_m_( keys );
+  if(lead) oyFree_m_( lead );
+
   /* clean the graph */
   o = oyOptions_Find( s->options, "dirty", oyNAME_PATTERN );
   oyOption_SetFromString( o, "false", 0 );
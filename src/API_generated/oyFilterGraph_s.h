@@ -41,6 +41,8 @@ typedef struct oyFilterGraph_s oyFilterGraph_s;
 
 
 /* Include "FilterGraph.public.h" { */
+/** @brief   oyFilterGraph_PrepareContexts() flag to not use threads */
+#define oyFILTERGRAPH_PREPARE_SERIAL 0x02
 
 /* } Include "FilterGraph.public.h" */
 
@@ -627,9 +627,9 @@ int            oyFilterNode_EdgeCount( oyFilterNode_s    * node,
  *                                     - ::OY_FILTEREDGE_CONNECTED: consider used
  *  @return                            the absolute position
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
  *  @since   2009/02/26 (Oyranos: 0.1.10)
- *  @date    2009/11/02
+ *  @date    2018/04/16
  */
 OYAPI int  OYEXPORT
                oyFilterNode_GetConnectorPos (
@@ -643,6 +643,8 @@ OYAPI int  OYEXPORT
   int pos = -1,
       i, j, n, n2,
       nth = -1;
+  uint64_t pattern_buffer[64];
+  oyRegistration_s * pattern_c;
 
   oyCheckType__m( oyOBJECT_FILTER_NODE_S, return pos )
 
@@ -655,14 +657,18 @@ OYAPI int  OYEXPORT
   if(nth_of_type == -1)
     nth_of_type = 0;
 
+  /* connector registrations come compiled from the side table */
+  pattern_c = oyRegistrationCompile_( pattern, OY_SLASH_C, '.',
+                                      pattern_buffer, sizeof(pattern_buffer), 0 );
+
   /* plugs */
   if(is_input)
   {
     n = s->api7_->plugs_n;
     for( i = 0; i < n; ++i )
     {
-      if(oyFilterRegistrationMatch( oyConnector_GetReg(s->api7_->plugs[i]),
-                                    pattern, 0))
+      if(oyRegistrationMatchCached_( oyConnector_GetReg(s->api7_->plugs[i]),
+                                     pattern_c, 0 ))
       {
         if( i == n - 1 && s->api7_->plugs_last_add)
           n2 = s->api7_->plugs_last_add;
@@ -692,7 +698,7 @@ OYAPI int  OYEXPORT
           if( nth == nth_of_type )
           {
             pos = i + j;
-            return pos;
+            goto clean;
           }
         }
       }
@@ -705,8 +711,8 @@ OYAPI int  OYEXPORT
     for( i = 0; i < n; ++i )
     {
       /* 2. compare pattern argument with the socket type */
-      if(oyFilterRegistrationMatch( oyConnector_GetReg(s->api7_->sockets[i]),
-                                    pattern, 0))
+      if(oyRegistrationMatchCached_( oyConnector_GetReg(s->api7_->sockets[i]),
+                                     pattern_c, 0 ))
       {
 
         /* 3. iterate through at least connectors or connectors that where added
@@ -744,15 +750,18 @@ OYAPI int  OYEXPORT
           /* 4. check the type relative positional parameter */
           if( nth == nth_of_type )
           {
-            /* 4.1 return as we otherwise would need to leave two loops */
+            /* 4.1 jump as we otherwise would need to leave two loops */
             pos = i + j;
-            return pos;
+            goto clean;
           }
         }
       }
     }
   }
 
+  clean:
+  oyRegistrationRelease_( &pattern_c, 0 );
+
   return pos;
 }
 
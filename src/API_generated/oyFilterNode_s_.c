@@ -440,7 +440,7 @@ oyFilterNode_s_ * oyFilterNode_Copy_ ( oyFilterNode_s_ *filternode, oyObject_s o
     
     if(oy_debug_objects >= 0 && s->oy_)
     {
-      const char * t = getenv(OY_DEBUG_OBJECTS);
+      const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
       int id_ = -1;
 
       if(t)
@@ -554,7 +554,7 @@ int oyFilterNode_Release_( oyFilterNode_s_ **filternode )
 
   if(oy_debug_objects >= 0 && s->oy_)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -667,7 +667,7 @@ int oyFilterNode_Release_( oyFilterNode_s_ **filternode )
 
   if(oy_debug_objects >= 0 && s->oy_)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -692,7 +692,7 @@ int oyFilterNode_Release_( oyFilterNode_s_ **filternode )
 
   if(oy_debug_objects >= 0)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -1018,7 +1018,7 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
            */
 
 
-          if(oy_debug && getenv("OY_DEBUG_WRITE"))
+          if(oy_debug && oyEnvGetString(oyENV_DEBUG_WRITE))
           {
             size = 0;
             ptr = oyFilterNode_TextToInfo_( node, &size, oyAllocateFunc_ );
@@ -1229,7 +1229,7 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
                   node->backend_data = oyPointer_Copy( cmm_ptr4, 0 );
               }
 
-              if(oy_debug && getenv("OY_DEBUG_WRITE"))
+              if(oy_debug && oyEnvGetString(oyENV_DEBUG_WRITE))
               {
                 int id = oyFilterNode_GetId( (oyFilterNode_s*)node );
                 char * file_name = 0;
@@ -245,6 +245,12 @@ int          oyObject_Release         ( oyObject_s      * obj )
     if(s->backdoor_)
     { deallocateFunc( s->backdoor_ ); s->backdoor_ = 0; }
 
+    if(s->signal_batch_)
+      oySignalBatchRelease_( &s->signal_batch_, deallocateFunc );
+
+    if(s->observers_ && s->observers_->release)
+    { s->observers_->release( &s->observers_ ); }
+
     if(s->handles_ && s->handles_->release)
     { s->handles_->release( (oyStruct_s**)&s->handles_ ); }
 
@@ -313,92 +313,181 @@ OYAPI int  OYEXPORT
  *  @memberof oyObserver_s
  *  @brief   send a signal to all ovservers of a model
  *
+ *  Objects without observers return immediately. Inside a
+ *  oyStruct_SignalBatchBegin() scope of the model, the signal is queued
+ *  and delivered once by oyStruct_SignalBatchEnd().
+ *
  *  @param[in]     model               the model
  *  @param[in]     signal_type         the basic signal type to emit
  *  @param[in,out] signal_data         the advanced signal information
  *  @return                            0 - no handler found; 1 - handler found;
  *                                     < 0 error or issue
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/16
  *  @since   2009/10/27 (Oyranos: 0.1.10)
- *  @date    2009/10/27
  */
 OYAPI int  OYEXPORT
            oyStruct_ObserverSignal   ( oyStruct_s        * model,
                                        oySIGNAL_e          signal_type,
                                        oyStruct_s        * signal_data )
 {
-  oyObserver_s * obs = 0;
-  int error = !model, t_err = 0;
-  oyOption_s * o = 0;
+  int error = !model || !model->oy_, result = 0;
   oyStructList_s * observers = 0;
-  int n,i, result = 0;
+  oySignalBatch_s * batch;
 
   if(oyToSignalBlock_m( oyObserverGetFlags() ))
     return 0;
 
   if(!error)
-    o = oyOptions_Find( model->oy_->handles_, OY_SIGNAL_OBSERVERS,
-                        oyNAME_REGISTRATION );
+    observers = (oyStructList_s*) model->oy_->observers_;
 
-  if(!o)
+  if(!observers)
     return 0;
 
-  if(!error)
+  batch = model->oy_->signal_batch_;
+  if(batch)
   {
-    observers = (oyStructList_s*)oyOption_GetStruct( o, oyOBJECT_STRUCT_LIST_S);
-    n = oyStructList_Count( observers );
-    for(i = 0; i < n; ++i)
+    int i, n = oyStructList_Count( observers );
+
+    if(!n)
+      return 0;
+
+    /* coalesce repeated signals */
+    for(i = 0; i < batch->n; ++i)
+      if(batch->types[i] == (int)signal_type &&
+         batch->data[i] == signal_data)
+        return n;
+
+    if(batch->n >= batch->reserved)
     {
-      obs = (oyObserver_s*) oyStructList_GetType( observers,
-                                                  i, oyOBJECT_OBSERVER_S );
-      if(obs)
+      oyDeAlloc_f deallocateFunc = model->oy_->deallocateFunc_ ?
+                                   model->oy_->deallocateFunc_ :
+                                   oyDeAllocateFunc_;
+      int reserved = batch->reserved ? batch->reserved * 2 : 8;
+      int * types = (int*) oyAllocateWrapFunc_( sizeof(int) * reserved,
+                                                model->oy_->allocateFunc_ );
+      oyStruct_s ** data = (oyStruct_s**) oyAllocateWrapFunc_(
+                                              sizeof(oyStruct_s*) * reserved,
+                                              model->oy_->allocateFunc_ );
+      if(!types || !data)
       {
-        if(obs->model == model)
-        {
-          if(oy_debug_signals)
-          {
-            WARNc6_S( "\n\t%s %s: %s[%d]->%s[%d]", _("Signal"),
-                    oySignalToString(signal_type),
-                    oyStruct_GetText( obs->model, oyNAME_NAME, 1),
-                    oyObject_GetId(   obs->model->oy_),
-                    oyStruct_GetText( obs->observer, oyNAME_NAME, 1),
-                    oyObject_GetId(   obs->observer->oy_) );
-          }
-          t_err = oyObserver_SignalSend( obs, signal_type, signal_data );
-          if(t_err)
-          {
-            DBG_NUM7_S( "oyObserver_SignalSend() returned %d\n\t%s %s: %s[%d]->%s[%d]",
-                    t_err, _("Signal"),
-                    oySignalToString(signal_type),
-                    oyStruct_GetText( obs->model, oyNAME_NAME, 1),
-                    oyObject_GetId(   obs->model->oy_),
-                    oyStruct_GetText( obs->observer, oyNAME_NAME, 1),
-                    oyObject_GetId(   obs->observer->oy_) );
-          }
-          ++result;
-        }
-        else
-        {
-          WARNc6_S( "\n\t%s %s: %s[%d]->%s[%d]",_("found observer of wrong type"),
-                    oySignalToString(signal_type),
-                    oyStruct_GetText( obs->model, oyNAME_NAME, 1),
-                    oyObject_GetId(   obs->model->oy_),
-                    oyStruct_GetText( obs->observer, oyNAME_NAME, 1),
-                    oyObject_GetId(   obs->observer->oy_) );
-        }
-      } else
-        WARNc3_S( "\n\t%s: oyObservers_s[%s]",_("found no observer"),
-                    oySignalToString(signal_type),
-                    oyStruct_TypeToText((oyStruct_s*)observers) );
+        if(types) deallocateFunc( types );
+        if(data) deallocateFunc( data );
+        return -1;
+      }
+      if(batch->n)
+      {
+        memcpy( types, batch->types, sizeof(int) * batch->n );
+        memcpy( data, batch->data, sizeof(oyStruct_s*) * batch->n );
+        deallocateFunc( batch->types );
+        deallocateFunc( batch->data );
+      }
+      batch->types = types;
+      batch->data = data;
+      batch->reserved = reserved;
     }
+
+    batch->types[batch->n] = signal_type;
+    batch->data[batch->n] = signal_data && signal_data->copy ?
+                            signal_data->copy( signal_data, 0 ) : signal_data;
+    ++batch->n;
+
+    return n;
   }
 
+  if(!error)
+    result = oyStruct_ObserverListSignal_( model, observers,
+                                           signal_type, signal_data );
+
   if(result)
     return result;
   return error;
 }
 
+/** Function oyStruct_SignalBatchBegin
+ *  @memberof oyObserver_s
+ *  @brief   collect the signals of a model
+ *
+ *  Bulk edits, like setting many options of a filter node, send one signal
+ *  cascade per change. Inside a batching scope the signals to the models
+ *  observers are queued instead. Each signal type and signal_data pair is
+ *  queued once. oyStruct_SignalBatchEnd() sends them in the order of
+ *  their first emission.
+ *  Scopes can be nested. Only the outermost scope sends.
+ *
+ *  @code
+    oyStruct_SignalBatchBegin( (oyStruct_s*)node );
+    for(i = 0; i < n; ++i)
+      oyOptions_SetFromString( &node_options, keys[i], values[i], OY_CREATE_NEW );
+    oyStruct_SignalBatchEnd( (oyStruct_s*)node );
+    @endcode
+ *
+ *  @param[in,out] model               the model
+ *  @return                            0 - fine; 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/16
+ *  @since   2018/03/16 (Oyranos: 0.9.7)
+ */
+OYAPI int  OYEXPORT
+           oyStruct_SignalBatchBegin ( oyStruct_s        * model )
+{
+  oySignalBatch_s * batch;
+
+  if(!model || !model->oy_)
+    return 1;
+
+  batch = model->oy_->signal_batch_;
+  if(!batch)
+  {
+    batch = (oySignalBatch_s*) oyAllocateWrapFunc_( sizeof(oySignalBatch_s),
+                                                    model->oy_->allocateFunc_ );
+    if(!batch)
+      return 1;
+    memset( batch, 0, sizeof(oySignalBatch_s) );
+    model->oy_->signal_batch_ = batch;
+  }
+  ++batch->depth;
+
+  return 0;
+}
+
+/** Function oyStruct_SignalBatchEnd
+ *  @memberof oyObserver_s
+ *  @brief   close a signal batching scope and send the collected signals
+ *
+ *  @param[in,out] model               the model
+ *  @return                            number of sent signals; -1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/16
+ *  @since   2018/03/16 (Oyranos: 0.9.7)
+ */
+OYAPI int  OYEXPORT
+           oyStruct_SignalBatchEnd   ( oyStruct_s        * model )
+{
+  oySignalBatch_s * batch;
+  int i, n;
+
+  if(!model || !model->oy_ || !model->oy_->signal_batch_)
+    return -1;
+
+  batch = model->oy_->signal_batch_;
+  if(--batch->depth > 0)
+    return 0;
+
+  /* handlers might emit new signals on model; send those directly */
+  model->oy_->signal_batch_ = NULL;
+  n = batch->n;
+  for(i = 0; i < n; ++i)
+    oyStruct_ObserverSignal( model, (oySIGNAL_e) batch->types[i],
+                             batch->data[i] );
+  oySignalBatchRelease_( &batch, model->oy_->deallocateFunc_ );
+
+  return n;
+}
+
 /** Function oyStruct_DisableSignalSend
  *  @memberof oyObserver_s
  *  @brief   disable sending a signal to all ovservers of a model
@@ -407,29 +496,26 @@ OYAPI int  OYEXPORT
  *  @return                            0 - no handler found; 1 - error
  *                                     < 0 error or issue
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/16
  *  @since   2010/04/07 (Oyranos: 0.1.10)
- *  @date    2010/04/07
  */
 OYAPI int  OYEXPORT
            oyStruct_DisableSignalSend( oyStruct_s        * model )
 {
   oyObserver_s * obs = 0;
   int error = !model;
-  oyOption_s * o = 0;
   oyStructList_s * observers = 0;
   int n,i;
 
   if(!error)
-    o = oyOptions_Find( model->oy_->handles_, OY_SIGNAL_OBSERVERS,
-                        oyNAME_REGISTRATION );
+    observers = (oyStructList_s*) model->oy_->observers_;
 
-  if(!o)
+  if(!observers)
     return 0;
 
   if(!error)
   {
-    observers = (oyStructList_s*)oyOption_GetStruct( o, oyOBJECT_STRUCT_LIST_S );
     n = oyStructList_Count( observers );
     for(i = 0; i < n; ++i)
     {
@@ -451,30 +537,26 @@ OYAPI int  OYEXPORT
  *  @return                            0 - no handler found; 1 - error
  *                                     < 0 error or issue
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/16
  *  @since   2010/04/07 (Oyranos: 0.1.10)
- *  @date    2010/04/07
  */
 OYAPI int  OYEXPORT
            oyStruct_EnableSignalSend ( oyStruct_s        * model )
 {
   oyObserver_s * obs = 0;
   int error = !model;
-  oyOption_s * o = 0;
   oyStructList_s * observers = 0;
   int n,i;
 
   if(!error)
-    o = oyOptions_Find( model->oy_->handles_, OY_SIGNAL_OBSERVERS,
-                        oyNAME_REGISTRATION );
+    observers = (oyStructList_s*) model->oy_->observers_;
 
-  if(!o)
+  if(!observers)
     return 0;
 
   if(!error)
   {
-    observers = (oyStructList_s*)oyOption_GetStruct( o, oyOBJECT_STRUCT_LIST_S );
-
     n = oyStructList_Count( observers );
     for(i = 0; i < n; ++i)
     {
@@ -484,11 +566,10 @@ OYAPI int  OYEXPORT
         --obs->disable_ref;
       if(obs && obs->disable_ref < 0)
       {
-        oyOption_s_ * o_ = (oyOption_s_*)o;
         obs->disable_ref = 0;
         WARNcc3_S( model, "%s: %s[%d]", _("Already enabled"),
                    oyStruct_GetText( (oyStruct_s*)obs, oyNAME_NAME, 1),
-                   oyObject_GetId( o_->value->oy_struct->oy_ ) );
+                   oyObject_GetId( ((oyStruct_s*)observers)->oy_ ) );
       }
     }
   }
@@ -99,6 +99,8 @@ typedef  int      (*oyObserver_Signal_f) (
  *  additional data is only blindly transported. A agreement is not subject of
  *  the oyObserver_s structure. For completeness the observed object shall
  *  always be included in the signal.
+ *  Bulk changes to a model can be collected with oyStruct_SignalBatchBegin()
+ *  and are sent once with oyStruct_SignalBatchEnd().
  *
  *  This class is a public members only class and does not
  *  belong to the oyranos object model, like all "Generic Objects".
@@ -165,6 +167,10 @@ OYAPI int  OYEXPORT
            oyStruct_DisableSignalSend( oyStruct_s        * model );
 OYAPI int  OYEXPORT
            oyStruct_EnableSignalSend ( oyStruct_s        * model );
+OYAPI int  OYEXPORT
+           oyStruct_SignalBatchBegin ( oyStruct_s        * model );
+OYAPI int  OYEXPORT
+           oyStruct_SignalBatchEnd   ( oyStruct_s        * model );
 OYAPI int  OYEXPORT
            oyStruct_ObserversCopy    ( oyStruct_s        * object,
                                        oyStruct_s        * pattern,
@@ -36,6 +36,11 @@ int        oyStruct_ObserverRemove_  ( oyStructList_s    * list,
                                        oyStruct_s        * obj,
                                        int                 observer,
                                        oyObserver_Signal_f signalFunc );
+int        oyStruct_ObserverListSignal_(
+                                       oyStruct_s        * model,
+                                       oyStructList_s    * observers,
+                                       oySIGNAL_e          signal_type,
+                                       oyStruct_s        * signal_data );
 
 /* } Include "Observer.private_methods_declarations.h" */
 
@@ -145,13 +145,16 @@ void oyOption_Release__Members( oyOption_s_ * option )
 
   if(option->oy_->deallocateFunc_)
   {
-    /*oyDeAlloc_f deallocateFunc = option->oy_->deallocateFunc_;*/
+    oyDeAlloc_f deallocateFunc = option->oy_->deallocateFunc_;
 
     /* Deallocate members of basic type here
      * E.g.: deallocateFunc( option->member );
      */
 
     oyOption_Clear( (oyOption_s*) option );
+    if(option->registration_old_)
+      deallocateFunc( option->registration_old_ );
+    option->registration_old_ = NULL;
   }
 }
 
@@ -176,6 +179,8 @@ int oyOption_Init__Members( oyOption_s_ * option )
 {
   option->id = oy_option_id_++;
   option->registration = NULL;
+  option->registration_c_ = NULL;
+  option->registration_old_ = NULL;
   option->value = NULL;
 
   return 0;
@@ -221,6 +226,8 @@ int oyOption_Copy__Members( oyOption_s_ * dst, oyOption_s_ * src)
    oyStruct_EnableSignalSend( (oyStruct_s*)dst );
 
    dst->registration = oyStringCopy_( src->registration, allocateFunc_ );
+   dst->registration_c_ = oyRegistrationCompileDefault_m( dst->registration,
+                                                          allocateFunc_ );
    dst->value_type = src->value_type;
    dst->value = allocateFunc_(sizeof(oyValue_u));
    memset(dst->value, 0, sizeof(oyValue_u));
@@ -387,7 +394,7 @@ oyOption_s_ * oyOption_Copy_ ( oyOption_s_ *option, oyObject_s object )
     
     if(oy_debug_objects >= 0 && s->oy_)
     {
-      const char * t = getenv(OY_DEBUG_OBJECTS);
+      const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
       int id_ = -1;
 
       if(t)
@@ -501,7 +508,7 @@ int oyOption_Release_( oyOption_s_ **option )
 
   if(oy_debug_objects >= 0 && s->oy_)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -585,7 +592,7 @@ int oyOption_Release_( oyOption_s_ **option )
 
   if(oy_debug_objects >= 0)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -1083,5 +1090,38 @@ int            oyOption_MoveInStruct_( oyOption_s_       * option,
   return error;
 }
 
+/**
+ *  @internal
+ *  Function oyOption_MatchPattern_
+ *  @memberof oyOption_s
+ *  @brief   match the option registration against a pattern
+ *
+ *  Gives the same result as oyFilterRegistrationMatch(). With the
+ *  compiled pattern, the options compiled registration is used and
+ *  avoids splitting both strings again for each option of a loop.
+ *
+ *  @param[in]     option              the option
+ *  @param[in]     pattern             the pattern string
+ *  @param[in]     pattern_c           optional pattern from
+ *                                     oyRegistrationCompileDefault_m()
+ *  @return                            match, useable for ranking
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/15
+ *  @since   2018/03/15 (Oyranos: 0.9.7)
+ */
+int            oyOption_MatchPattern_( oyOption_s_       * option,
+                                       const char        * pattern,
+                                       const oyRegistration_s * pattern_c )
+{
+  if(!option)
+    return 0;
+
+  if(pattern_c && option->registration_c_)
+    return oyRegistrationMatch_( option->registration_c_, pattern_c, 0, 0 );
+
+  return oyFilterRegistrationMatch( option->registration, pattern, 0 );
+}
+
 /* } Include "Option.private_methods_definitions.c" */
 
@@ -36,6 +36,7 @@ typedef struct oyOption_s_ oyOption_s_;
 #include "oyOption_s.h"
 
 /* Include "Option.private.h" { */
+#include "oyranos_object_internal.h"
 
 /* } Include "Option.private.h" */
 
@@ -65,6 +66,8 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
   oyValue_u          * value;          /**< the actual value */
   oyOPTIONSOURCE_e     source;         /**< the source of this value */
   uint32_t             flags;          /**< | oyOPTIONATTRIBUTE_e */
+  oyRegistration_s   * registration_c_;/**< @private tokenised registration for pattern matching */
+  char               * registration_old_;/**< @private the last replaced registration */
 
 /* } Include "Option.members.h" */
 
@@ -98,6 +101,9 @@ int            oyOption_SetFromInt_  ( oyOption_s_       * obj,
                                        uint32_t            flags );
 int            oyOption_MoveInStruct_( oyOption_s_       * option,
                                        oyStruct_s       ** s );
+int            oyOption_MatchPattern_( oyOption_s_       * option,
+                                       const char        * pattern,
+                                       const oyRegistration_s * pattern_c );
 
 /* } Include "Option.private_methods_declarations.h" */
 
@@ -1045,12 +1045,18 @@ int            oyOptions_Filter      ( oyOptions_s      ** add_list,
   int n, i;
   int32_t c = 0;
   uint32_t options_source = 0;
+  uint64_t pattern_buffer[64];
+  oyRegistration_s * pattern_c = NULL;
 
   oyCheckType__m( oyOBJECT_OPTIONS_S, return 1 )
 
   if(error <= 0)
   {
     n = oyOptions_Count( s );
+    if(registration && n > 1)
+      pattern_c = oyRegistrationCompile_( registration, OY_SLASH_C, '.',
+                                          pattern_buffer,
+                                          sizeof(pattern_buffer), 0 );
     if(!*add_list)
       *add_list = oyOptions_New(0);
 
@@ -1061,15 +1067,13 @@ int            oyOptions_Filter      ( oyOptions_s      ** add_list,
     for(i = 0; i < n; ++i)
     {
       int found = 1;
-      const char * o_registration;
       oyOPTIONSOURCE_e o_source;
 
       o = oyOptions_Get( s, i );
-      o_registration = oyOptionPriv_m(o)->registration;
       o_source = oyOptionPriv_m(o)->source;
 
       if(found && registration &&
-         !oyFilterRegistrationMatch( o_registration, registration, 0 ))
+         !oyOption_MatchPattern_( oyOptionPriv_m(o), registration, pattern_c ))
           found = 0;
 
       options_source = flags & oyOPTIONSOURCE_FILTER ? oyOPTIONSOURCE_FILTER :0;
@@ -1096,6 +1100,8 @@ int            oyOptions_Filter      ( oyOptions_s      ** add_list,
       *count = c;
   }
 
+  oyRegistrationRelease_( &pattern_c, 0 );
+
   return error;
 }
 
@@ -1351,19 +1357,25 @@ int            oyOptions_CountType   ( oyOptions_s       * options,
   int i, n, m = 0, found;
   oyOption_s_ * o = 0;
   oyOptions_s * s = options;
+  uint64_t pattern_buffer[64];
+  oyRegistration_s * pattern_c = NULL;
 
 
   if(!error)
     oyCheckType__m( oyOBJECT_OPTIONS_S, return 0 );
 
     n = oyOptions_Count( options );
+    if(registration && n > 1)
+      pattern_c = oyRegistrationCompile_( registration, OY_SLASH_C, '.',
+                                          pattern_buffer,
+                                          sizeof(pattern_buffer), 0 );
     for(i = 0; i < n;  ++i)
     {
       o = (oyOption_s_*)oyOptions_Get( options, i );
       found = 1;
 
       if(found && registration &&
-         !oyFilterRegistrationMatch( o->registration, registration, 0 ))
+         !oyOption_MatchPattern_( o, registration, pattern_c ))
           found = 0;
 
       if(found && type &&
@@ -1377,6 +1389,8 @@ int            oyOptions_CountType   ( oyOptions_s       * options,
       oyOption_Release( (oyOption_s**)&o );
     }
 
+  oyRegistrationRelease_( &pattern_c, 0 );
+
   return m;
 }
 
@@ -1411,8 +1425,8 @@ int          oyOptionRegistrationMatch(const char        * registration,
  *                                     - oyNAME_REGISTRATION for a exact comparision
  *  @return                            a matching options
  *
- *  @version Oyranos: 0.1.9
- *  @date    2009/04/13
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/15
  *  @since   2008/11/05 (Oyranos: 0.1.9)
  */
 oyOption_s *   oyOptions_Find        ( oyOptions_s       * options,
@@ -1435,6 +1449,14 @@ oyOption_s *   oyOptions_Find        ( oyOptions_s       * options,
   {
     oyOptions_s * set_a = options;
     int set_an = oyOptions_Count( set_a ), i;
+    uint64_t pattern_buffer[64];
+    oyRegistration_s * pattern_c = NULL;
+
+    /* split the pattern once for all options */
+    if(type == oyNAME_PATTERN && set_an > 1)
+      pattern_c = oyRegistrationCompile_( registration, OY_SLASH_C, '.',
+                                          pattern_buffer,
+                                          sizeof(pattern_buffer), 0 );
 
     for(i = 0; i < set_an; ++i)
     {
@@ -1443,7 +1465,10 @@ oyOption_s *   oyOptions_Find        ( oyOptions_s       * options,
 
       if(found && registration)
       {
-         if(!oyOptionRegistrationMatch( oyOptionPriv_m(o)->registration, registration, type ))
+         if(type == oyNAME_PATTERN)
+           found = oyOption_MatchPattern_( oyOptionPriv_m(o), registration,
+                                           pattern_c ) != 0;
+         else if(!oyOptionRegistrationMatch( oyOptionPriv_m(o)->registration, registration, type ))
           found = 0;
       }
 
@@ -1455,6 +1480,8 @@ oyOption_s *   oyOptions_Find        ( oyOptions_s       * options,
 
       oyOption_Release( &o );
     }
+
+    oyRegistrationRelease_( &pattern_c, 0 );
   }
 
   return option;
@@ -357,7 +357,7 @@ oyPixelAccess_s_ * oyPixelAccess_Copy_ ( oyPixelAccess_s_ *pixelaccess, oyObject
     
     if(oy_debug_objects >= 0 && s->oy_)
     {
-      const char * t = getenv(OY_DEBUG_OBJECTS);
+      const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
       int id_ = -1;
 
       if(t)
@@ -471,7 +471,7 @@ int oyPixelAccess_Release_( oyPixelAccess_s_ **pixelaccess )
 
   if(oy_debug_objects >= 0 && s->oy_)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -555,7 +555,7 @@ int oyPixelAccess_Release_( oyPixelAccess_s_ **pixelaccess )
 
   if(oy_debug_objects >= 0)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -614,6 +614,134 @@ int oyPixelAccess_Release_( oyPixelAccess_s_ **pixelaccess )
 
 
 /* Include "PixelAccess.private_methods_definitions.c" { */
+#include "oyFilterSocket_s_.h"
+#include "oyFilterPlug_s_.h"
+
+/** Function  oyPixelAccess_Init_
+ *  @memberof oyPixelAccess_s
+ *  @brief    Set up a ticket for a plug
+ *  @internal
+ *
+ *  Sets all members of oyPixelAccess_Create() except the graph.
+ *
+ *  @param[in,out] s                   a new or reset ticket
+ *  @param[in]     start_x             x position
+ *  @param[in]     start_y             y position
+ *  @param[in]     plug                the output plug
+ *  @param[in]     type                the access type
+ *  @return                            0 - success, >= 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/22
+ *  @since   2008/07/07 (Oyranos: 0.1.8)
+ */
+int                oyPixelAccess_Init_(oyPixelAccess_s_  * s,
+                                       int32_t             start_x,
+                                       int32_t             start_y,
+                                       oyFilterPlug_s    * plug,
+                                       oyPIXEL_ACCESS_TYPE_e type )
+{
+  oyFilterSocket_s_ * sock = 0;
+  oyFilterPlug_s_ ** plug_ = (oyFilterPlug_s_**)&plug;
+  int error = !s || !plug || !(*plug_)->remote_socket_;
+  int w = 0;
+  oyImage_s * image = 0;
+  int32_t n = 0;
+
+  if(error <= 0)
+  {
+    sock = (*plug_)->remote_socket_;
+    image = (oyImage_s*)sock->data;
+
+    s->start_xy[0] = s->start_xy_old[0] = start_x;
+    s->start_xy[1] = s->start_xy_old[1] = start_y;
+
+    /* make shure the filter->image_ is set, e.g.
+       error = oyFilterCore_ImageSet ( filter, image );
+
+    s->data_in = filter->image_->data; */
+    if(image)
+      w = oyImage_GetWidth( image );
+
+    /** The filters have no obligation to pass end to end informations.
+        The ticket must hold all pices of interesst.
+     */
+    s->output_array_roi->width = 1.0;
+    if(image && w)
+      s->output_array_roi->height = oyImage_GetHeight( image ) / (double)w;
+    s->output_image = oyImage_Copy( image, 0 );
+
+    if(type == oyPIXEL_ACCESS_POINT)
+    {
+      s->array_xy = s->oy_->allocateFunc_(sizeof(int32_t) * 2);
+      s->array_xy[0] = s->array_xy[1] = 0;
+      s->array_n = 1;
+      s->pixels_n = 1;
+    } else
+    if(type == oyPIXEL_ACCESS_LINE)
+    {
+      s->array_xy = s->oy_->allocateFunc_(sizeof(int32_t) * 2);
+      /* set relative advancements from one pixel to the next */
+      s->array_xy[0] = 1;
+      s->array_xy[1] = 0;
+      s->array_n = 1;
+      s->pixels_n = w;       /* the total we want */
+    } else
+    /* if(type == oyPIXEL_ACCESS_IMAGE) */
+    {
+      /** @todo how can we know about the various module capabilities
+       *  - back report the processed number of pixels in the passed pointer
+       *  - restrict for a line interface only, would fit to oyArray2d_s
+       *  - + handle inside an to be created function oyConversion_RunPixels()
+       */
+    }
+
+    /* Copy requests, which where attached to the node, to the ticket. */
+    if((*plug_)->node->core->options_)
+      error = oyOptions_Filter( &s->request_queue, &n, 0,
+                                oyBOOLEAN_INTERSECTION,
+                                "////resolve", (*plug_)->node->core->options_ );
+  }
+
+  return error;
+}
+
+/** Function  oyPixelAccess_Reset_
+ *  @memberof oyPixelAccess_s
+ *  @brief    Drop the per request state of a ticket
+ *  @internal
+ *
+ *  The ticket keeps its object and ROI allocation for
+ *  oyPixelAccess_Init_().
+ *
+ *  @param[in,out] s                   the ticket
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/22
+ *  @since   2018/03/22 (Oyranos: 0.9.7)
+ */
+void               oyPixelAccess_Reset_(oyPixelAccess_s_ * s )
+{
+  oyArray2d_Release( &s->array );
+  oyImage_Release( &s->output_image );
+  oyOptions_Release( &s->request_queue );
+  oyFilterGraph_Release( (oyFilterGraph_s**)&s->graph );
+  if(s->user_data && s->user_data->release)
+    s->user_data->release( &s->user_data );
+  s->user_data = NULL;
+  if(s->array_xy && s->oy_->deallocateFunc_)
+    s->oy_->deallocateFunc_( s->array_xy );
+  s->array_xy = NULL;
+
+  s->start_xy[0] = s->start_xy_old[0] = 0;
+  s->start_xy[1] = s->start_xy_old[1] = 0;
+  s->array_n = 0;
+  s->index = 0;
+  s->pixels_n = 0;
+  s->workspace_id = 0;
+  oyRectangle_SetGeo( (oyRectangle_s*)s->output_array_roi, 0,0,0,0 );
+  s->output_array_is_focussed = 0;
+}
 
 /* } Include "PixelAccess.private_methods_definitions.c" */
 
@@ -103,6 +103,12 @@ int
 
 
 /* Include "PixelAccess.private_methods_declarations.h" { */
+int                oyPixelAccess_Init_(oyPixelAccess_s_  * s,
+                                       int32_t             start_x,
+                                       int32_t             start_y,
+                                       oyFilterPlug_s    * plug,
+                                       oyPIXEL_ACCESS_TYPE_e type );
+void               oyPixelAccess_Reset_(oyPixelAccess_s_ * s );
 
 /* } Include "PixelAccess.private_methods_declarations.h" */
 
@@ -1126,6 +1126,9 @@ OYAPI int OYEXPORT
     return error;
   }
 
+  if(error <= 0)
+    error = oyProfile_UnshareBlock_( s );
+
   if(error <= 0 && !s->block_)
   {
     oyStruct_AllocHelper_m_( block_, char, size_, s, error = 1 );
@@ -1660,9 +1663,7 @@ OYAPI oyPointer OYEXPORT
       if(s->file_name_)
         profile->oy_->deallocateFunc_( s->file_name_ );
       s->file_name_ = 0;
-      if(s->block_ && s->size_)
-        profile->oy_->deallocateFunc_( s->block_ );
-      s->size_ = 0;
+      oyProfile_ReleaseBlock_( s );
       s->block_ = oyAllocateWrapFunc_( *size,
                                              profile->oy_->allocateFunc_ );
       error = !memcpy( s->block_, block, *size );
@@ -1771,11 +1772,15 @@ OYAPI oyProfileTag_s * OYEXPORT
  *  @memberof oyProfile_s
  *  @brief    Get a profile tag by its tag signature
  *
+ *  Unmodified profiles are looked up in a signature index of the ICC tag
+ *  table. Only the requested tag is created then.
+ *
  *  @param[in]     profile             the profile
  *  @param[in]     id                  icTagSignature
  *
- *  @since Oyranos: version 0.1.8
- *  @date  2 january 2008 (API 0.1.8)
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/13
+ *  @since   2008/01/02 (Oyranos: 0.1.8)
  */
 OYAPI oyProfileTag_s * OYEXPORT
                  oyProfile_GetTagById( oyProfile_s       * profile,
@@ -1787,12 +1792,48 @@ OYAPI oyProfileTag_s * OYEXPORT
                  * tmp = 0;
   int i = 0, n = 0;
   icTagSignature tag_id_ = 0;
+  oyProfileTagIndex_s * tag_index = 0;
 
   if(!s)
     return 0;
 
   oyCheckType__m( oyOBJECT_PROFILE_S, return 0 )
 
+  if(error <= 0 && !s->tags_modified_)
+    tag_index = oyProfile_GetTagIndex_( s );
+
+  if(tag_index)
+  {
+    int pos = oyProfileTagIndex_Find_( tag_index, id );
+
+    if(pos < 0)
+      return 0;
+
+    /* lock free after the first request */
+    if(tag_index->tags[pos])
+      return oyProfileTag_Copy( tag_index->tags[pos], 0 );
+
+    oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+    if(!tag_index->tags[pos])
+    {
+      if(oyStructList_Count( s->tags_ ))
+      {
+        /* already parsed: header + tag table order */
+        tmp = oyProfile_GetTagByPos_( s, pos + 1 );
+        if(tmp && oyProfileTagPriv_m(tmp)->use == id)
+          tag_index->tags[pos] = tmp;
+        else
+          oyProfileTag_Release( &tmp );
+      } else
+        tag_index->tags[pos] = oyProfile_TagFromTable_( s, pos );
+    }
+    tag = oyProfileTag_Copy( tag_index->tags[pos], 0 );
+    oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+    if(tag)
+      return tag;
+  }
+
   if(error <= 0)
     n = oyProfile_GetTagCount_( s );
 
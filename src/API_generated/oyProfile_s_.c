@@ -179,6 +179,7 @@ void oyProfile_Release__Members( oyProfile_s_ * profile )
   profile->sig_ = (icColorSpaceSignature)0;
 
   oyStructList_Release(&profile->tags_);
+  oyProfile_ReleaseTagIndex_( profile );
   oyConfig_Release(&profile->meta_);
 
   if(profile->oy_->deallocateFunc_)
@@ -192,7 +193,7 @@ void oyProfile_Release__Members( oyProfile_s_ * profile )
     { deallocateFunc( profile->names_chan_ ); profile->names_chan_ = 0; }
 
     if(profile->block_)
-    { deallocateFunc( profile->block_ ); profile->block_ = 0; profile->size_ = 0; }
+      oyProfile_ReleaseBlock_( profile );
 
     if(profile->file_name_)
     { deallocateFunc( profile->file_name_ ); profile->file_name_ = 0; }
@@ -251,6 +252,12 @@ int oyProfile_Copy__Members( oyProfile_s_ * dst, oyProfile_s_ * src)
   allocateFunc_ = dst->oy_->allocateFunc_;
 
   /* Copy each value of src to dst here */
+  if(src->block_ && src->size_ && oyMapMemRef_( src->block_ ) == 0)
+  {
+    /* share the read only file mapping */
+    dst->block_ = src->block_;
+    dst->size_ = src->size_;
+  } else
   if(src->block_ && src->size_)
   {
     dst->block_ = allocateFunc_( src->size_ );
@@ -458,7 +465,7 @@ oyProfile_s_ * oyProfile_Copy_ ( oyProfile_s_ *profile, oyObject_s object )
     
     if(oy_debug_objects >= 0 && s->oy_)
     {
-      const char * t = getenv(OY_DEBUG_OBJECTS);
+      const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
       int id_ = -1;
 
       if(t)
@@ -572,7 +579,7 @@ int oyProfile_Release_( oyProfile_s_ **profile )
 
   if(oy_debug_objects >= 0 && s->oy_)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -656,7 +663,7 @@ int oyProfile_Release_( oyProfile_s_ **profile )
 
   if(oy_debug_objects >= 0)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
 
     if(t)
@@ -740,6 +747,58 @@ int oyProfile_HasID_          ( oyProfile_s_      * s )
   return has_id;
 }
 
+/** @internal
+ *  @memberof oyProfile_s
+ *  @brief   release the ICC data
+ *
+ *  The data is either allocated or a shared oyMapFileToMem_() block.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2018/03/09 (Oyranos: 0.9.7)
+ *  @date    2018/03/09
+ */
+void oyProfile_ReleaseBlock_   ( oyProfile_s_      * s )
+{
+  if(s->tag_index_)
+    s->tag_index_->block = NULL;
+  if(s->block_ && oyUnMapMem_( s->block_ ) != 0 && s->oy_->deallocateFunc_)
+    s->oy_->deallocateFunc_( s->block_ );
+  s->block_ = 0;
+  s->size_ = 0;
+}
+
+/** @internal
+ *  @memberof oyProfile_s
+ *  @brief   obtain writeable ICC data
+ *
+ *  A shared read only file mapping is replaced by a private copy.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2018/03/09 (Oyranos: 0.9.7)
+ *  @date    2018/03/09
+ */
+int oyProfile_UnshareBlock_    ( oyProfile_s_      * s )
+{
+  oyPointer block = 0;
+  int error = 0;
+
+  if(!s->block_ || !oyIsMappedMem_( s->block_ ))
+    return error;
+
+  oyStruct_AllocHelper_m_( block, char, s->size_, s, error = 1 );
+  if(error <= 0)
+  {
+    memcpy( block, s->block_, s->size_ );
+    /* same tag table */
+    if(s->tag_index_ && s->tag_index_->block == s->block_)
+      s->tag_index_->block = block;
+    oyUnMapMem_( s->block_ );
+    s->block_ = block;
+  }
+
+  return error;
+}
+
 /** @internal
  *  @memberof oyProfile_s
  *  @brief   hash for oyProfile_s
@@ -1000,7 +1059,10 @@ oyProfile_s_ *  oyProfile_FromFile_  ( const char        * name,
   if(name && !s)
   {
     file_name = oyFindProfile_( name, flags );
-    block = oyGetProfileBlock( file_name, &size, allocateFunc );
+    /* large profiles are shared read only and paged in on access */
+    block = oyMapFileToMem_( file_name, &size );
+    if(!block)
+      block = oyGetProfileBlock( file_name, &size, allocateFunc );
     if(!block || !size)
       error = 1;
   }
@@ -1501,8 +1563,8 @@ oyProfileTag_s * oyProfile_GetTagByPos_( oyProfile_s_    * profile,
     if(error <= 0 && s->size_ > (size_t)min_icc_size)
     {
       uint32_t tag_count = 0;
-      icTag *tag_list = 0;
       int i = 0;
+      oyProfileTagIndex_s * tag_index = s->tag_index_;
       oyProfileTag_s_ * tag_ = oyProfileTag_New_( 0 );
       char h[5] = {"head"};
       uint32_t * hi = (uint32_t*)&h;
@@ -1529,48 +1591,24 @@ oyProfileTag_s * oyProfile_GetTagByPos_( oyProfile_s_    * profile,
 
 
       tag_count = oyValueUInt32( ic_profile->count );
-
-      tag_list = (icTag*)&((char*)s->block_)[132];
+      if(tag_index && tag_index->block != s->block_)
+        tag_index = 0;
 
       /* parse the profile and add tags to the oyProfile_s::tags_ list */
       for(i = 0; (size_t)i < tag_count; ++i)
       {
-        icTag *ic_tag = &tag_list[i];
-        size_t offset = oyValueUInt32( ic_tag->offset );
-        size_t tag_size = oyValueUInt32( ic_tag->size );
-        char *tmp = 0;
         char **texts = 0;
         int32_t texts_n = 0;
         int j;
-        oySTATUS_e status = oyOK;
-        icTagSignature sig = oyValueUInt32( ic_tag->sig );
-        icTagTypeSignature tag_type = 0;
-
-        oyProfileTag_s * tag_ = oyProfileTag_New( 0 );
+        oyProfileTag_s * tag_;
 
-        tag_block = 0;
-
-        if((offset+tag_size) > s->size_)
-          status = oyCORRUPTED;
+        /* keep tags handed out by oyProfile_GetTagById() */
+        if(tag_index && i < tag_index->count && tag_index->tags[i])
+          tag_ = oyProfileTag_Copy( tag_index->tags[i], 0 );
         else
-        {
-          icTagBase * tag_base = 0;
-
-          oyStruct_AllocHelper_m_( tag_block, char, tag_size, tag_, return 0 );
-          tmp = &((char*)s->block_)[offset];
-          error = !memcpy( tag_block, tmp, tag_size );
-          if(error) { WARNc_S("Unable to copy CMM name"); }
-
-          tag_base = (icTagBase*) tag_block;
-          tag_type = oyValueUInt32( tag_base->sig );
-        }
-
-        error = oyProfileTag_Set( tag_, sig, tag_type,
-                                  status, tag_size, &tag_block );
-        if(error <= 0)
-          error = oyProfileTag_SetOffset( tag_, offset );
-        if(error <= 0)
-          error = oyProfileTag_SetCMM( tag_, profile_cmm );
+          tag_ = oyProfile_TagFromTable_( s, i );
+        if(!tag_)
+          continue;
 
         if(oy_debug > 3)
         {
@@ -1601,6 +1639,210 @@ oyProfileTag_s * oyProfile_GetTagByPos_( oyProfile_s_    * profile,
   return tag;
 }
 
+/** @internal
+ *  Function  oyProfile_TagFromTable_
+ *  @memberof oyProfile_s
+ *  @brief    Create a tag from the ICC tag table
+ *
+ *  Non thread save
+ *
+ *  @param[in]     profile             the profile with ICC data
+ *  @param[in]     i                   tag table position; without header
+ *  @return                            a new tag or zero
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/13
+ *  @since   2018/03/13 (Oyranos: 0.9.7)
+ */
+oyProfileTag_s * oyProfile_TagFromTable_( oyProfile_s_    * profile,
+                                       int                 i )
+{
+  oyProfile_s_ * s = profile;
+  icTag * ic_tag = &((icTag*)&((char*)s->block_)[132])[i];
+  size_t offset = oyValueUInt32( ic_tag->offset );
+  size_t tag_size = oyValueUInt32( ic_tag->size );
+  oySTATUS_e status = oyOK;
+  icTagSignature sig = oyValueUInt32( ic_tag->sig );
+  icTagTypeSignature tag_type = 0;
+  icSignature profile_cmmId = oyProfile_GetSignature( (oyProfile_s*)s, oySIGNATURE_CMM );
+  char profile_cmm[5] = {0,0,0,0,0};
+  oyPointer tag_block = 0;
+  oyProfileTag_s * tag_ = oyProfileTag_New( 0 );
+  int error = !tag_;
+
+  profile_cmmId = oyValueUInt32( profile_cmmId );
+  memcpy( profile_cmm, &profile_cmmId, 4 );
+
+  if((offset+tag_size) > s->size_)
+    status = oyCORRUPTED;
+  else if(error <= 0)
+  {
+    icTagBase * tag_base = 0;
+
+    oyStruct_AllocHelper_m_( tag_block, char, tag_size, tag_,
+                             oyProfileTag_Release( &tag_ ); return 0 );
+    memcpy( tag_block, &((char*)s->block_)[offset], tag_size );
+
+    tag_base = (icTagBase*) tag_block;
+    tag_type = oyValueUInt32( tag_base->sig );
+  }
+
+  if(error <= 0)
+    error = oyProfileTag_Set( tag_, sig, tag_type,
+                              status, tag_size, &tag_block );
+  if(error <= 0)
+    error = oyProfileTag_SetOffset( tag_, offset );
+  if(error <= 0)
+    error = oyProfileTag_SetCMM( tag_, profile_cmm );
+
+  if(error > 0)
+    oyProfileTag_Release( &tag_ );
+
+  return tag_;
+}
+
+#define oyTagSigHash_m( sig ) (((uint32_t)(sig) * 2654435761u) >> 7)
+/** @internal
+ *  Function  oyProfile_GetTagIndex_
+ *  @memberof oyProfile_s
+ *  @brief    Get the signature index of the ICC tag table
+ *
+ *  The index is built on first call from the unmodified ICC data. Only that
+ *  call locks the profile.
+ *
+ *  @param[in]     profile             the profile
+ *  @return                            the index or zero for modified or
+ *                                     invalid profiles; owned by the profile
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/13
+ *  @since   2018/03/13 (Oyranos: 0.9.7)
+ */
+oyProfileTagIndex_s * oyProfile_GetTagIndex_( oyProfile_s_ * profile )
+{
+  oyProfile_s_ * s = profile;
+  oyProfileTagIndex_s * tag_index = s->tag_index_;
+  icTag * tag_list;
+  uint32_t tag_count, slots = 16, i;
+  size_t size;
+  char * mem = NULL;
+
+  if(tag_index && s->block_ && tag_index->block == s->block_)
+    return tag_index;
+
+  if(!s->block_ || s->tags_modified_ || s->size_ < 132)
+    return NULL;
+
+  oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+
+  tag_index = s->tag_index_;
+  if(tag_index && tag_index->block == s->block_)
+  {
+    oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+    return tag_index;
+  }
+
+  tag_count = oyValueUInt32( ((icProfile*)s->block_)->count );
+  if(132 + (size_t)tag_count * sizeof(icTag) > s->size_)
+  {
+    oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+    return NULL;
+  }
+
+  while(slots < tag_count * 2)
+    slots *= 2;
+  size = sizeof(oyProfileTagIndex_s) +
+         tag_count * (sizeof(oyProfileTag_s*) + sizeof(icTagSignature)) +
+         slots * sizeof(int32_t);
+  oyStruct_AllocHelper_m_( mem, char, size, s, mem = NULL );
+
+  tag_index = NULL;
+  if(mem)
+  {
+    memset( mem, 0, size );
+    tag_index = (oyProfileTagIndex_s*) mem;
+    tag_index->tags = (oyProfileTag_s**) (mem + sizeof(oyProfileTagIndex_s));
+    tag_index->slots = (int32_t*) &tag_index->tags[tag_count];
+    tag_index->sigs = (icTagSignature*) &tag_index->slots[slots];
+    tag_index->count = tag_count;
+    tag_index->mask = slots - 1;
+
+    tag_list = (icTag*)&((char*)s->block_)[132];
+    for(i = 0; i < tag_count; ++i)
+    {
+      icTagSignature sig = oyValueUInt32( tag_list[i].sig );
+      uint32_t h = oyTagSigHash_m( sig ) & tag_index->mask;
+
+      tag_index->sigs[i] = sig;
+      /* keep the first of duplicate tags, like a linear search does */
+      while(tag_index->slots[h] && tag_index->sigs[tag_index->slots[h]-1] != sig)
+        h = (h + 1) & tag_index->mask;
+      if(!tag_index->slots[h])
+        tag_index->slots[h] = i + 1;
+    }
+
+    tag_index->block = s->block_;
+    /* readers might still hold the old one */
+    tag_index->prev = s->tag_index_;
+    s->tag_index_ = tag_index;
+  }
+
+  oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+  return tag_index;
+}
+
+/** @internal
+ *  Function  oyProfileTagIndex_Find_
+ *  @memberof oyProfile_s
+ *  @brief    Look up a tag signature
+ *
+ *  @return                            tag table position or -1
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/13
+ *  @since   2018/03/13 (Oyranos: 0.9.7)
+ */
+int          oyProfileTagIndex_Find_ ( oyProfileTagIndex_s * tag_index,
+                                       icTagSignature      sig )
+{
+  uint32_t h = oyTagSigHash_m( sig ) & tag_index->mask;
+
+  while(tag_index->slots[h])
+  {
+    int pos = tag_index->slots[h] - 1;
+    if(tag_index->sigs[pos] == sig)
+      return pos;
+    h = (h + 1) & tag_index->mask;
+  }
+
+  return -1;
+}
+
+/** @internal
+ *  Function  oyProfile_ReleaseTagIndex_
+ *  @memberof oyProfile_s
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/13
+ *  @since   2018/03/13 (Oyranos: 0.9.7)
+ */
+void         oyProfile_ReleaseTagIndex_( oyProfile_s_    * profile )
+{
+  oyProfile_s_ * s = profile;
+
+  while(s->tag_index_)
+  {
+    oyProfileTagIndex_s * tag_index = s->tag_index_;
+    int i;
+
+    s->tag_index_ = tag_index->prev;
+    for(i = 0; i < tag_index->count; ++i)
+      oyProfileTag_Release( &tag_index->tags[i] );
+    s->oy_->deallocateFunc_( tag_index );
+  }
+}
+
 /** @internal
  *  Function  oyProfile_GetTagCount_
  *  @memberof oyProfile_s
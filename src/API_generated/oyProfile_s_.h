@@ -44,6 +44,22 @@ typedef struct oyProfile_s_ oyProfile_s_;
 #include "oyProfile_s.h"
 
 /* Include "Profile.private.h" { */
+/** @internal
+ *  @brief   tag signature to tag table position index
+ *
+ *  Built once from the tag table in oyProfile_s_::block_. Lookups need no
+ *  lock. Tags are created on request only.
+ */
+typedef struct oyProfileTagIndex_s oyProfileTagIndex_s;
+struct oyProfileTagIndex_s {
+  void               * block;          /**< indexed ICC data; NULL if outdated */
+  int                  count;          /**< tag table entries */
+  unsigned int         mask;           /**< hash slots - 1 */
+  oyProfileTag_s    ** tags;           /**< per table position, lazily filled */
+  int32_t            * slots;          /**< table position + 1; 0 is empty */
+  icTagSignature     * sigs;           /**< per table position */
+  oyProfileTagIndex_s* prev;           /**< outdated index, kept for readers */
+};
 
 /* } Include "Profile.private.h" */
 
@@ -76,6 +92,7 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
   oyStructList_s     * tags_;          /**< @private list of header + tags */
   int                  tags_modified_; /**< @private note manipulation */
   oyConfig_s         * meta_;          /**< @private parsed meta tag */
+  oyProfileTagIndex_s * tag_index_;    /**< @private tag signature index */
 
 /* } Include "Profile.members.h" */
 
@@ -116,6 +133,12 @@ char *       oyProfile_GetFileName_r ( oyProfile_s_      * profile,
 oyProfileTag_s * oyProfile_GetTagByPos_( oyProfile_s_    * profile,
                                        int                 pos );
 int             oyProfile_GetTagCount_ ( oyProfile_s_      * profile );
+oyProfileTag_s * oyProfile_TagFromTable_( oyProfile_s_    * profile,
+                                       int                 i );
+oyProfileTagIndex_s * oyProfile_GetTagIndex_( oyProfile_s_ * profile );
+int          oyProfileTagIndex_Find_ ( oyProfileTagIndex_s * tag_index,
+                                       icTagSignature      sig );
+void         oyProfile_ReleaseTagIndex_( oyProfile_s_    * profile );
 int          oyProfile_TagMoveIn_    ( oyProfile_s_      * profile,
                                        oyProfileTag_s   ** obj,
                                        int                 pos );
@@ -132,6 +155,8 @@ oyPointer    oyProfile_WriteTagTable_( oyProfile_s_      * profile,
                                        size_t            * size );
 
 int oyProfile_HasID_          ( oyProfile_s_      * s );
+void oyProfile_ReleaseBlock_   ( oyProfile_s_      * s );
+int oyProfile_UnshareBlock_    ( oyProfile_s_      * s );
 int oyProfile_GetHash_        ( oyProfile_s_      * s,
                                        int                 flags );
 #if 0
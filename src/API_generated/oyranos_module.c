@@ -105,6 +105,9 @@ oyCMMapiFilters_s * oyCMMsGetFilterApis_(const char        * registration,
   int rank_list_n = 5, count_ = 0;
   oyObject_s object = oyObject_New();
   oyHash_s * entry = 0;
+  double stats_start = 0.0;
+  uint64_t pattern_buffer[64];
+  oyRegistration_s * pattern_c = NULL;
 
   if(!rank_list)
   {
@@ -156,6 +159,11 @@ oyCMMapiFilters_s * oyCMMsGetFilterApis_(const char        * registration,
     char * file_match = NULL;
     oyCMMinfo_s * info = 0;
 
+    stats_start = oyStatsStart_m();
+    /* compile once; module registrations come compiled from the side table */
+    pattern_c = oyRegistrationCompile_( registration, OY_SLASH_C, '.',
+                                        pattern_buffer,
+                                        sizeof(pattern_buffer), 0 );
     meta_apis_n = oyCMMapis_Count( meta_apis );
     for(k = 0; k < meta_apis_n; ++k)
     {
@@ -191,7 +199,7 @@ oyCMMapiFilters_s * oyCMMsGetFilterApis_(const char        * registration,
                                        &reg, 0, oyAllocateFunc_, 0, 0 );
           if(!ret && reg)
           {
-            rank = oyFilterRegistrationMatch( reg, registration, type );
+            rank = oyRegistrationMatchCached_( reg, pattern_c, type );
             if((rank && OYRANOS_VERSION == oyCMMinfo_GetCompatibility( info )) ||
                !registration)
               ++rank;
@@ -373,6 +381,7 @@ oyCMMapiFilters_s * oyCMMsGetFilterApis_(const char        * registration,
 
     if(file_match)
       oyFree_m_( file_match );
+    oyStatsEnd_m( oySTATS_MODULE_SCAN, stats_start, count_ );
   }
 
   if(error <= 0 && apis2 && entry)
@@ -384,6 +393,7 @@ oyCMMapiFilters_s * oyCMMsGetFilterApis_(const char        * registration,
     oyObject_Release( &object );
     oyHash_Release( &entry );
     oyCMMapiFilters_Release( &apis );
+    oyRegistrationRelease_( &pattern_c, 0 );
 
   return apis2;
 }
@@ -784,7 +794,7 @@ oyCMMapis_s *    oyCMMsGetMetaApis_  ( )
 #if defined(COMPILE_STATIC)
       WARNc1_S("%s", _("Could not find any meta module."));
 #else
-      const char * v = getenv(OY_MODULE_PATH);
+      const char * v = oyEnvGetString(oyENV_MODULE_PATH);
       WARNc2_S("%s OY_MODULE_PATH: \"%s\"",
                _("Could not find any meta module. "
                 "Did you set the OY_MODULE_PATH variable,"
@@ -1953,6 +1963,110 @@ oyPointer_s * oyPointer_LookUpFromText( const char        * text,
 }
 
 
+/* resolved target of oyOptions_Handle() */
+typedef struct {
+  oyCMMapi10_s_     * api;             /* referenced; NULL terminates */
+  oyMOptions_Handle_f handler;         /* declared handler or NULL for probing */
+} oyOptionsHandler_s;
+
+static int   oyOptionsHandlersRelease_(oyPointer         * ptr )
+{
+  oyOptionsHandler_s * handlers = (oyOptionsHandler_s*) *ptr;
+  int i;
+
+  if(!handlers)
+    return 1;
+
+  for(i = 0; handlers[i].api; ++i)
+    if(handlers[i].api->release)
+      handlers[i].api->release( (oyStruct_s**)&handlers[i].api );
+  oyDeAllocateFunc_( handlers );
+  *ptr = NULL;
+
+  return 0;
+}
+
+static oyMOptions_Handle_f oyCMMapi10_GetCommandHandler_ (
+                                       oyCMMapi10_s_     * api,
+                                       const char        * command )
+{
+  int i;
+
+  if(!api->commands || !command)
+    return NULL;
+
+  for(i = 0; api->commands[i].command; ++i)
+    if(oyFilterRegistrationMatch( command, api->commands[i].command, 0 ))
+      return api->commands[i].handler;
+
+  return NULL;
+}
+
+/* Resolve (registration, command) to the matching modules once and keep
+ * the result in the module cache. */
+static oyPointer_s * oyOptionsHandlersGet_ (
+                                       const char        * registration,
+                                       const char        * command )
+{
+  char * hash_text = NULL;
+  oyHash_s * entry;
+  oyPointer_s * ptr;
+
+  oyStringAddPrintf_( &hash_text, oyAllocateFunc_,oyDeAllocateFunc_,
+                      "oyOptions_Handle;%s;%s",
+                      oyNoEmptyString_m_( registration ),
+                      oyNoEmptyString_m_( command ) );
+  entry = oyCMMCacheListGetEntry_( hash_text );
+  oyDeAllocateFunc_( hash_text ); hash_text = 0;
+
+  ptr = (oyPointer_s*) oyHash_GetPointer( entry, oyOBJECT_POINTER_S );
+  if(!ptr)
+  {
+    oyCMMapiFilters_s * apis = oyCMMsGetFilterApis_( registration,
+                                 oyOBJECT_CMM_API10_S,
+                                 oyFILTER_REG_MODE_STRIP_IMPLEMENTATION_ATTR,
+                                 0,0 );
+    int apis_n = oyCMMapiFilters_Count( apis ), i, n = 0;
+    oyOptionsHandler_s * handlers = (oyOptionsHandler_s*)
+                 oyAllocateFunc_( sizeof(oyOptionsHandler_s) * (apis_n + 1) );
+    uint64_t pattern_buffer[64];
+    oyRegistration_s * pattern_c = oyRegistrationCompile_( registration,
+                                        OY_SLASH_C, '.', pattern_buffer,
+                                        sizeof(pattern_buffer), 0 );
+
+    if(handlers)
+    {
+      memset( handlers, 0, sizeof(oyOptionsHandler_s) * (apis_n + 1) );
+      for(i = 0; i < apis_n; ++i)
+      {
+        oyCMMapi10_s_ * cmm_api10 = (oyCMMapi10_s_*) oyCMMapiFilters_Get( apis, i );
+
+        if(cmm_api10 &&
+           oyRegistrationMatchCached_( cmm_api10->registration, pattern_c, 0 ))
+        {
+          handlers[n].api = cmm_api10;
+          handlers[n++].handler = oyCMMapi10_GetCommandHandler_( cmm_api10,
+                                                                 command );
+        }
+        else if(cmm_api10 && cmm_api10->release)
+          cmm_api10->release( (oyStruct_s**)&cmm_api10 );
+      }
+
+      ptr = oyPointer_New( 0 );
+      oyPointer_Set( ptr, __FILE__, "oyOptionsHandler_s", handlers,
+                     "oyOptionsHandlersRelease_", oyOptionsHandlersRelease_ );
+      oyHash_SetPointer( entry, (oyStruct_s*) ptr );
+    }
+
+    oyRegistrationRelease_( &pattern_c, 0 );
+    oyCMMapiFilters_Release( &apis );
+  }
+
+  oyHash_Release( &entry );
+
+  return ptr;
+}
+
 /** 
  *  @brief    Handle a request by a module
  *  @memberof oyOptions_s
@@ -1965,8 +2079,12 @@ oyPointer_s * oyPointer_LookUpFromText( const char        * text,
  *                                     <= -1 - issue,
  *                                     + a message should be sent
  *
- *  @version  Oyranos: 0.9.0
- *  @date     2012/10/25
+ *  Modules are looked up once per registration and command. Commands
+ *  declared in oyCMMapi10_s::commands are called directly, others get the
+ *  "can_handle" probe first.
+ *
+ *  @version  Oyranos: 0.9.7
+ *  @date     2018/04/08
  *  @since    2009/12/11 (Oyranos: 0.1.10)
  */
 int             oyOptions_Handle     ( const char        * registration,
@@ -1984,54 +2102,52 @@ int             oyOptions_Handle     ( const char        * registration,
 
   if(!error)
   {
-    oyCMMapiFilters_s * apis;
-    int apis_n = 0, i, found = 0;
-    oyCMMapi10_s_ * cmm_api10 = 0;
+    oyPointer_s * ptr = oyOptionsHandlersGet_( registration, command );
+    oyOptionsHandler_s * handlers = (oyOptionsHandler_s*)
+                                                 oyPointer_GetPointer( ptr );
+    int i, found = 0;
     char * test = 0;
 
-    STRING_ADD( test, "can_handle." );
-    if(command && command[0])
-      STRING_ADD( test, command );
+    if(!handlers)
+      WARNc2_S( "%s %s",_("Could not allocate memory for:"),
+                oyNoEmptyString_m_(registration) );
 
-    apis = oyCMMsGetFilterApis_( registration, oyOBJECT_CMM_API10_S,
-                                 oyFILTER_REG_MODE_STRIP_IMPLEMENTATION_ATTR,
-                                 0,0 );
+    for(i = 0; handlers && handlers[i].api; ++i)
+    {
+      oyCMMapi10_s_ * cmm_api10 = handlers[i].api;
 
-    apis_n = oyCMMapiFilters_Count( apis );
-    if(test)
-      for(i = 0; i < apis_n; ++i)
+      if(handlers[i].handler)
       {
-        cmm_api10 = (oyCMMapi10_s_*) oyCMMapiFilters_Get( apis, i );
-
-        if(oyFilterRegistrationMatch( cmm_api10->registration, registration, 0))
+        found = 1;
+        error = handlers[i].handler( s, command, result );
+      }
+      else if(cmm_api10->oyMOptions_Handle)
+      {
+        /* fallback for modules without declared commands */
+        if(!test)
         {
-          if(cmm_api10->oyMOptions_Handle)
-          {
-            error = cmm_api10->oyMOptions_Handle( s, test, result );
-            if(error == 0)
-            {
-              found = 1;
-              error = cmm_api10->oyMOptions_Handle( s, command, result );
-            }
-
-          } else
-            error = 1;
-
-          if(error > 0)
-          {
-            WARNc2_S( "%s %s",_("error in module:"), cmm_api10->registration );
-          }
+          STRING_ADD( test, "can_handle." );
+          if(command && command[0])
+            STRING_ADD( test, command );
+        }
+        error = cmm_api10->oyMOptions_Handle( s, test, result );
+        if(error == 0)
+        {
+          found = 1;
+          error = cmm_api10->oyMOptions_Handle( s, command, result );
         }
 
-        if(cmm_api10->release)
-          cmm_api10->release( (oyStruct_s**)&cmm_api10 );
+      } else
+        error = 1;
+
+      if(error > 0)
+      {
+        WARNc2_S( "%s %s",_("error in module:"), cmm_api10->registration );
       }
-    else
-      WARNc2_S( "%s %s",_("Could not allocate memory for:"),
-                oyNoEmptyString_m_(registration) );
+    }
 
     oyFree_m_( test );
-    oyCMMapiFilters_Release( &apis );
+    oyPointer_Release( &ptr );
     if(!found && error == 0)
       error = -1;
   }
@@ -665,7 +665,8 @@ oyCMMapi10_s_    dFil_api10_my_handler = {
   dFilInfoGetTextMyHandler,             /**< getText */
   (char**)dFil_texts_my_handler,       /**<texts; list of arguments to getText*/
  
-  dFilMOptions_Handle                  /**< oyMOptions_Handle_f oyMOptions_Handle */
+  dFilMOptions_Handle,                 /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                 /**< commands; none */
 };
 
 /* OY_DUMMY_OPTIONS_HANDLER_REG ----------------------------------------------*/
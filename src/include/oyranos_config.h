@@ -86,6 +86,8 @@ typedef  char*  (* oyDBSearchEmptyKeyname_f) (
                                        oySCOPE_e           scope );
 typedef  int    (* oyDBEraseKey_f)   ( const char        * key_name,
                                        oySCOPE_e           scope );
+/* DB write batches; writes of the scope are kept until commit */
+typedef  int    (* oyDBTransaction_f)( oySCOPE_e           scope );
 typedef struct {
   uint32_t         type;               /**< set to oyOBJECT_DB_API_S for ABI compatibility with the actual used header version */
   char             nick[8];            /**< four byte nick name of module + terminating zero */
@@ -109,6 +111,9 @@ typedef struct {
   oyDBSetString_f setString;
   oyDBSearchEmptyKeyname_f searchEmptyKeyname;
   oyDBEraseKey_f eraseKey;
+
+  oyDBTransaction_f transactionBegin;  /**< optional */
+  oyDBTransaction_f transactionCommit; /**< optional */
 } oyDbAPI_s;
 
 int                oyDbHandlingReady ( void );
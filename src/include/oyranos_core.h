@@ -122,6 +122,86 @@ void           oyI18Nreset           ( void );
 int                oyBigEndian       ( void );
 
 
+/** @brief   Instrumentation probes
+ *
+ *  Each probe accumulates a call count, the spent time and a probe specific
+ *  value. Read them with oyStatsGet() or oyStatsToText().
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2018/03/08 (Oyranos: 0.9.7)
+ *  @date    2018/03/08
+ */
+typedef enum {
+  oySTATS_MODULE_SCAN,                 /**< uncached module lookups; value
+                                            counts the found APIs */
+  oySTATS_CACHE_HIT,                   /**< cache lookups finding an entry;
+                                            value counts the compared entries */
+  oySTATS_CACHE_MISS,                  /**< cache lookups adding an entry;
+                                            value counts the compared entries */
+  oySTATS_TRANSFORM_BUILD,             /**< CMM transform creation; value
+                                            counts the linked profiles */
+  oySTATS_PIXEL_RUN,                   /**< CMM pixel conversion; value counts
+                                            the converted pixels */
+  oySTATS_DEVICE_OPEN,                 /**< device connections opened by
+                                            modules; value counts the ones
+                                            kept open for reuse */
+  oySTATS_DEVICE_PARSE,                /**< device descriptions, e.g. PPDs,
+                                            parsed by modules; value counts
+                                            the parsed bytes */
+  oySTATS_MAX
+} oySTATS_e;
+#define oySTATS_ENABLE                 0x01 /**< collect counters and timers */
+#define oySTATS_TRACE                  0x02 /**< record spans for ::OY_TRACE */
+int                oyStatsSet        ( int                 flags );
+int                oyStatsGet        ( oySTATS_e           probe,
+                                       double            * count,
+                                       double            * seconds,
+                                       double            * value );
+char *             oyStatsToText     ( oyAlloc_f           allocateFunc );
+void               oyStatsReset      ( void );
+int                oyStatsTraceWrite ( const char        * file_name );
+
+/** @brief   Environment variables read by Oyranos
+ *
+ *  The variables are read once into a snapshot. Use oyEnvReload() after
+ *  changing them inside a running process.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2018/03/20 (Oyranos: 0.9.7)
+ *  @date    2018/03/20
+ */
+typedef enum {
+  oyENV_DEBUG,                         /**< ::OY_DEBUG */
+  oyENV_DEBUG_MEMORY,                  /**< ::OY_DEBUG_MEMORY */
+  oyENV_DEBUG_OBJECTS,                 /**< ::OY_DEBUG_OBJECTS */
+  oyENV_DEBUG_OBJECTS_SKIP_CMM_CACHES, /**< "OY_DEBUG_OBJECTS_SKIP_CMM_CACHES" */
+  oyENV_DEBUG_SIGNALS,                 /**< ::OY_DEBUG_SIGNALS */
+  oyENV_DEBUG_WRITE,                   /**< "OY_DEBUG_WRITE" */
+  oyENV_DEBUG_DB_MODULE,               /**< ::OY_DEBUG_DB_MODULE */
+  oyENV_BACKTRACE,                     /**< ::OY_BACKTRACE */
+  oyENV_STATS,                         /**< ::OY_STATS */
+  oyENV_TRACE,                         /**< ::OY_TRACE */
+  oyENV_MODULE_PATH,                   /**< ::OY_MODULE_PATH */
+  oyENV_LD_LIBRARY_PATH,               /**< "LD_LIBRARY_PATH" */
+  oyENV_LOCALEDIR,                     /**< "OY_LOCALEDIR" */
+  oyENV_HOME,                          /**< "HOME" */
+  oyENV_XDG_DATA_HOME,                 /**< "XDG_DATA_HOME" */
+  oyENV_XDG_CONFIG_HOME,               /**< "XDG_CONFIG_HOME" */
+  oyENV_XDG_DATA_DIRS,                 /**< "XDG_DATA_DIRS" */
+  oyENV_XDG_CONFIG_DIRS,               /**< "XDG_CONFIG_DIRS" */
+  oyENV_TMP,                           /**< "TMP" */
+  oyENV_TEMP,                          /**< "TEMP" */
+  oyENV_TMPDIR,                        /**< "TMPDIR" */
+  oyENV_DISPLAY,                       /**< "DISPLAY" */
+  oyENV_MAX
+} oyENV_e;
+const char *       oyEnvName         ( oyENV_e             key );
+const char *       oyEnvGetString    ( oyENV_e             key );
+int                oyEnvGetInt       ( oyENV_e             key,
+                                       int                 fallback );
+int                oyEnvReload       ( void );
+
+
 /* String Helpers */
 #define oyNoEmptyString_m( text_nem ) text_nem?text_nem:"---"
 int                oyStringAddPrintf ( char             ** text,
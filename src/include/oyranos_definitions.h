@@ -82,6 +82,25 @@
  *  @since 0.9.0
  */
 #define OY_BACKTRACE                   "OY_BACKTRACE"
+/** @brief Oyranos instrumentation environment variable
+ *
+ *  A non zero value switches on counters and timers. See oyStatsGet().
+ *
+ *  @see @ref debug_vars
+ *
+ *  @since 0.9.7
+ */
+#define OY_STATS                       "OY_STATS"
+/** @brief Oyranos instrumentation environment variable
+ *
+ *  Names a file to write a Chrome trace-event JSON into at exit.
+ *  It implies ::OY_STATS.
+ *
+ *  @see @ref debug_vars
+ *
+ *  @since 0.9.7
+ */
+#define OY_TRACE                       "OY_TRACE"
 /** @brief Oyranos modules/CMM's environment variable
  *
  *  @see @ref runtime_vars
@@ -33,5 +33,6 @@ extern oyOptions_s     * oy_db_cache_;
 
 int      oyObjectUsedByCache_        ( int                 id );
 int *    get_oy_db_cache_init_();
+int *    get_oy_db_cache_generation_();
 
 #endif /* OYRANOS_CACHE_H */
@@ -33,6 +33,8 @@ extern oyDB_getKeyNamesOneLevel_f oyDB_getKeyNamesOneLevel;
 extern oyDBSetString_f            oyDBSetString;
 extern oyDBSearchEmptyKeyname_f   oyDBSearchEmptyKeyname;
 extern oyDBEraseKey_f             oyDBEraseKey;
+extern oyDBTransaction_f          oyDBTransactionBegin;
+extern oyDBTransaction_f          oyDBTransactionCommit;
 
 
 #ifdef __cplusplus
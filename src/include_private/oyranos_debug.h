@@ -49,6 +49,16 @@ double   oyGetCurrentLocalHour       ( double              time,
 double   oyGetCurrentGMTHour         ( int               * gmt_to_local_time_diff_sec );
 const char *       oyPrintTime       ( );
 
+/* Instrumentation - see oyStatsGet() */
+extern int oy_stats;
+double             oyStatsStart_     ( void );
+void               oyStatsEnd_       ( int                 probe,
+                                       double              start,
+                                       double              value );
+/** the disabled path is a single integer test */
+#define oyStatsStart_m()               (oy_stats ? oyStatsStart_() : 0.0)
+#define oyStatsEnd_m(probe,start,value) do { if(oy_stats) oyStatsEnd_(probe,start,value); } while(0)
+
 #if defined(__GNUC__)
 # define  OY_DBG_FORMAT_ "%s:%d %s() "
 # define  OY_DBG_ARGS_   strrchr(__FILE__,'/') ? strrchr(__FILE__,'/')+1 : __FILE__,__LINE__,__func__
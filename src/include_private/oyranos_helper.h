@@ -114,6 +114,12 @@ int  oyWriteMemToFile2_              ( const char        * name,
                                        oyAlloc_f           allocateFunc );
 char* oyReadFileToMem_  (const char* fullFileName, size_t *size,
                          oyAlloc_f     allocate_func);
+char * oyMapFileToMem_               ( const char        * full_file_name,
+                                       size_t            * size );
+int    oyIsMappedMem_                ( const void        * block );
+int    oyMapMemRef_                  ( const void        * block );
+int    oyUnMapMem_                   ( void              * block );
+void   oyMapFileForget_              ( const char        * full_file_name );
 char * oyReadStdinToMem_             ( size_t            * size,
                                        oyAlloc_f           allocate_func );
 char * oyReadFilepToMem_             ( FILE              * file,
@@ -171,6 +177,11 @@ int            oyRampManipulateU16   ( uint16_t          * ramp1,
                                        uint16_t          * ramp_result,
                                        int                 ramp_size,
                                        uint16_t          (*manip_f)(uint16_t,uint16_t) );
+int            oyRampMixU16          ( uint16_t          * ramp1,
+                                       uint16_t          * ramp2,
+                                       uint16_t          * ramp_result,
+                                       int                 ramp_size,
+                                       double              pos );
 float          oyAddF32              ( float               value1,
                                        float               value2 );
 float          oySubstF32            ( float               value1,
@@ -219,6 +230,15 @@ int                oyMiscBlobGetHash_( void              * buffer,
 #define OY_GETPID() getpid()
 #endif
 
+/* spin lock for short critical sections without a thread library */
+#if defined(__GNUC__)
+#define oySpinLock_m(lock)   while(__sync_lock_test_and_set( &(lock), 1 )) ;
+#define oySpinUnLock_m(lock) __sync_lock_release( &(lock) );
+#else
+#define oySpinLock_m(lock)
+#define oySpinUnLock_m(lock)
+#endif
+
 #ifdef HAVE_DL
 #include <dlfcn.h> /* dlopen() */
 #define dlinit() 0
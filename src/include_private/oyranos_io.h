@@ -51,7 +51,8 @@ extern "C" {
 /* --- static variables   --- */
 
 #define OY_WEB_RGB "sRGB.icc"
-#define OY_COLOR_DL_CACHE_PATH "openicc/device_link"
+#define OY_COLOR_CACHE_PATH "openicc/"
+#define OY_COLOR_DL_CACHE_PATH OY_COLOR_CACHE_PATH "device_link"
 #define OY_PIXMAPSDIRNAME "pixmaps"
 
 #if defined(__APPLE__)
@@ -67,6 +68,7 @@ extern "C" {
 # define OS_ICC_MACHINE_DIR            OS_MACHINE_DIR      OS_ICC_PATH
 # define CSNetworkPath                 "/Network/Library"  OS_ICC_PATH
 
+# define OS_CACHE_ROOT_PATH  "/Caches/org.freedesktop." OY_COLOR_CACHE_PATH
 # define OS_CACHE_PATH       "/Caches/org.freedesktop." OY_COLOR_DL_CACHE_PATH
 # define OS_LOGO_PATH     "/org.freedesktop.openicc/" OY_PIXMAPSDIRNAME
 # define OS_SETTING_PATH     "/Preferences/org.freedesktop.openicc/" OY_SETTINGSDIRNAME
@@ -88,6 +90,7 @@ extern "C" {
 # define OS_ICC_SYSTEM_DIR             OS_GLOBAL_DIR         OS_ICC_PATH
 # define OS_ICC_MACHINE_DIR            OS_MACHINE_DIR "lib/" OS_ICC_PATH
 
+# define OS_CACHE_ROOT_PATH  "cache/color/" OY_COLOR_CACHE_PATH
 # define OS_CACHE_PATH       "cache/color/" OY_COLOR_DL_CACHE_PATH
 # define OS_LOGO_PATH        OY_PIXMAPSDIRNAME
 # define OS_SETTING_PATH     "color/" OY_SETTINGSDIRNAME
@@ -100,6 +103,7 @@ extern "C" {
 
 #endif
 
+# define OS_CACHE_USER_DIR             OS_USER_DIR           OS_CACHE_ROOT_PATH
 # define OS_DL_CACHE_USER_DIR          OS_USER_DIR           OS_CACHE_PATH
 # define OS_DL_CACHE_SYSTEM_DIR        OS_MACHINE_DIR        OS_CACHE_PATH
 # define OS_DL_CACHE_MACHINE_DIR       OS_MACHINE_DIR        OS_CACHE_PATH
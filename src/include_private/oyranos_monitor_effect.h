@@ -26,6 +26,11 @@ int      oyProfileAddWhitePointEffect( oyProfile_s       * monitor_profile,
 uint16_t*oyProfileGetWhitePointRamp  ( int                 width,
                                        oyProfile_s       * p,
                                        oyOptions_s       * options );
+uint16_t*oyProfileGetWhitePointFade  ( int                 width,
+                                       oyProfile_s       * p,
+                                       oyOptions_s       * start_options,
+                                       oyOptions_s       * end_options,
+                                       int                 steps );
 uint16_t*oyProfile_GetVCGT           ( oyProfile_s       * profile,
                                        int               * width );
 int      oyProfile_SetVCGT           ( oyProfile_s       * profile,
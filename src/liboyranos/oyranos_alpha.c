@@ -823,7 +823,7 @@ OY_DEPRECATED char *   oyGetMonitorProfileNameFromDB(const char        * display
 
   if(error > 0)
   {
-    display_name = getenv( "DISPLAY" );
+    display_name = oyEnvGetString( oyENV_DISPLAY );
     error = !display_name;
   }
 
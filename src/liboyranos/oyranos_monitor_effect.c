@@ -30,6 +30,8 @@
  *  can detect the color server correctly.
  */
 
+#include <math.h>
+
 #include "oyranos_color.h"
 #include "oyranos_helper.h"
 #include "oyranos_i18n.h"
@@ -287,7 +289,7 @@ uint16_t * oyProfileGetWhitePointRamp( int                 width,
       ramp[i*3 + j] = i * mul;
   }
 
-  if(getenv("OY_DEBUG_WRITE"))
+  if(oyEnvGetString(oyENV_DEBUG_WRITE))
     oyImage_WritePPM( input, "wtpt-effect-gray.ppm", "gray ramp" );
 
   oyConversion_Correct( cc, "//" OY_TYPE_STD "/icc_color", 0, NULL);
@@ -303,6 +305,66 @@ uint16_t * oyProfileGetWhitePointRamp( int                 width,
   return ramp;
 }
 
+/** @brief   fade between two white point effects
+ *
+ *  Only the start and end ramps are converted. The intermediate ramps
+ *  are mixed linear from those two, which is cheap enough to be done
+ *  for each step of a smooth transition.
+ *
+ *  @param[in]     width               ramp size
+ *  @param[in]     p                   the monitor profile
+ *  @param[in]     start_options       effect options of the start point
+ *  @param[in]     end_options         effect options of the end point
+ *  @param[in]     steps               number of transitions; ramp 0 is the
+ *                                     start and ramp steps is the end
+ *  @return                            steps + 1 ramps of width * 3
+ *                                     values each; release with free()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/10
+ *  @since   2018/04/10 (Oyranos: 0.9.7)
+ */
+uint16_t * oyProfileGetWhitePointFade( int                 width,
+                                       oyProfile_s       * p,
+                                       oyOptions_s       * start_options,
+                                       oyOptions_s       * end_options,
+                                       int                 steps )
+{
+  uint16_t * start, * end, * ramps = NULL;
+  int i, n = width * 3;
+
+  if(width < 2 || steps < 1)
+    return NULL;
+
+  start = oyProfileGetWhitePointRamp( width, p, start_options );
+  end   = oyProfileGetWhitePointRamp( width, p, end_options );
+  if(start && end)
+    ramps = calloc( sizeof(uint16_t), (size_t)n * (steps + 1) );
+
+  if(ramps)
+    for(i = 0; i <= steps; ++i)
+      oyRampMixU16( start, end, &ramps[(size_t)n * i], n, (double)i/steps );
+
+  free( start );
+  free( end );
+
+  return ramps;
+}
+
+/** @brief   get the vcgt tag as ramp
+ *
+ *  Table types with 8 or 16 bit values and the parametric type are decoded.
+ *  A single table is used for all three channels.
+ *
+ *  @param[in]     profile             the profile
+ *  @param[in,out] width               ramp size; is set from a table and
+ *                                     is used for sampling parametric tags
+ *  @return                            width * 3 values; release with free()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/10
+ *  @since   2018/02/19 (Oyranos: 0.9.7)
+ */
 uint16_t *   oyProfile_GetVCGT       ( oyProfile_s       * profile,
                                        int               * width )
 {
@@ -333,22 +395,38 @@ uint16_t *   oyProfile_GetVCGT       ( oyProfile_s       * profile,
                      OY_DBG_ARGS_, parametrisch, nkurven, segmente, byte );
 
   if (parametrisch)
-  { //icU16Fixed16Number
-    const char * name = oyProfile_GetText( profile, oyNAME_DESCRIPTION );
-    oyMessageFunc_p( oyMSG_WARN,(oyStruct_s*)profile, OY_DBG_FORMAT_
-                     "parametric vcgt is not supported: %s",
-                     OY_DBG_ARGS_, oyNoEmptyString_m_(name) );
-#if 0
-      double r_gamma = 1.0/oyValueUInt32(*(icUInt32Number*)&data_[12])*65536.0;
-      double start_r = oyValueUInt32(*(icUInt32Number*)&data_[16])/65536.0;
-      double ende_r = oyValueUInt32(*(icUInt32Number*)&data_[20])/65536.0;
-      double g_gamma = 1.0/oyValueUInt32(*(icUInt32Number*)&data_[24])*65536.0;
-      double start_g = oyValueUInt32(*(icUInt32Number*)&data_[28])/65536.0;
-      double ende_g = oyValueUInt32(*(icUInt32Number*)&data_[32])/65536.0;
-      double b_gamma = 1.0/oyValueUInt32(*(icUInt32Number*)&data_[36])*65536.0;
-      double start_b = oyValueUInt32(*(icUInt32Number*)&data_[40])/65536.0;
-      double ende_b = oyValueUInt32(*(icUInt32Number*)&data_[44])/65536.0;
-#endif
+  { /* gamma, min and max as s15Fixed16Number for red, green and blue */
+    int i,j, n = *width > 1 ? *width : 256;
+    double gamma[3], min[3], max[3];
+
+    if(size < 48)
+    {
+      const char * name = oyProfile_GetText( profile, oyNAME_DESCRIPTION );
+      oyMessageFunc_p( oyMSG_WARN,(oyStruct_s*)profile, OY_DBG_FORMAT_
+                       "parametric vcgt tag too small: %lu need 48 %s",
+                       OY_DBG_ARGS_, size, oyNoEmptyString_m_(name) );
+      goto clean_oyProfile_GetVCGT;
+    }
+
+    for(j = 0; j < 3; ++j)
+    {
+      gamma[j] = (int32_t)oyValueUInt32(*(icUInt32Number*)&data_[12 + j*12])/65536.0;
+      min[j]   = (int32_t)oyValueUInt32(*(icUInt32Number*)&data_[16 + j*12])/65536.0;
+      max[j]   = (int32_t)oyValueUInt32(*(icUInt32Number*)&data_[20 + j*12])/65536.0;
+    }
+
+    ramp = calloc( sizeof(uint16_t), n * 3 );
+    if(ramp)
+    for(i = 0; i < n; ++i)
+      for(j = 0; j < 3; ++j)
+      {
+        double v = min[j] + (max[j] - min[j]) * pow( (double)i/(n-1), gamma[j] );
+        if(v < 0.0) v = 0.0;
+        if(v > 1.0) v = 1.0;
+        ramp[i*3 + j] = OY_ROUNDp( v * 65535.0 );
+      }
+
+    *width = n;
   } else {
     int start = 18, i,j;
     if((int)size < start + byte * segmente * nkurven)
@@ -360,20 +438,29 @@ uint16_t *   oyProfile_GetVCGT       ( oyProfile_s       * profile,
                         size, start + byte * segmente * nkurven, oyNoEmptyString_m_(name) );
       goto clean_oyProfile_GetVCGT;
     }
-    if(byte != 2)
+    if((byte != 1 && byte != 2) || (nkurven != 1 && nkurven != 3) ||
+       segmente < 2)
     {
       const char * name = oyProfile_GetText( profile, oyNAME_DESCRIPTION );
       oyMessageFunc_p( oyMSG_WARN,(oyStruct_s*)profile, OY_DBG_FORMAT_
-                        "vcgt bytes not supported: %d need 2 %s",
+                        "vcgt not supported: bytes %d curves %d entries %d %s",
                         OY_DBG_ARGS_,
-                        byte, oyNoEmptyString_m_(name) );
+                        byte, nkurven, segmente, oyNoEmptyString_m_(name) );
       goto clean_oyProfile_GetVCGT;
     }
 
-    ramp = calloc( byte, segmente * nkurven);
-    for (j = 0; j < nkurven; j++)
-      for (i = segmente * j; i < segmente * (j+1); i++)
-        ramp[(i - segmente*j) * nkurven + j] = oyValueUInt16 (*(icUInt16Number*)&data_[start + byte*i]);
+    ramp = calloc( sizeof(uint16_t), segmente * 3 );
+    if(ramp)
+    for (j = 0; j < 3; j++)
+    {
+      int c = nkurven == 3 ? j : 0;
+      for (i = 0; i < segmente; i++)
+      {
+        int pos = start + byte * (segmente * c + i);
+        ramp[i * 3 + j] = byte == 1 ? data_[pos] * 257 :
+                          oyValueUInt16 (*(icUInt16Number*)&data_[pos]);
+      }
+    }
 
     *width = segmente;
   }
@@ -455,7 +542,7 @@ int      oyProfile_CreateEffectVCGT  ( oyProfile_s       * prof )
   int width = 256;
   uint16_t * vcgt = oyProfile_GetVCGT( prof, &width );
   oyImage_s * img;
-  if(getenv("OY_DEBUG_WRITE"))
+  if(oyEnvGetString(oyENV_DEBUG_WRITE))
   {
     img = oyImage_Create( width, 1, vcgt, OY_TYPE_123_16, prof, 0 );
     oyImage_WritePPM( img, "wtpt-vcgt.ppm", "vcgt ramp" );
@@ -464,7 +551,7 @@ int      oyProfile_CreateEffectVCGT  ( oyProfile_s       * prof )
 
   /* 4. create conversion, fill ramp and convert */
   uint16_t * ramp = oyProfileGetWhitePointRamp( width, prof, module_options );
-  if(getenv("OY_DEBUG_WRITE"))
+  if(oyEnvGetString(oyENV_DEBUG_WRITE))
   {
     img = oyImage_Create( width, 1, ramp, OY_TYPE_123_16, prof, 0 );
     oyImage_WritePPM( img, "wtpt-effect.ppm", "white point ramp" );
@@ -480,7 +567,7 @@ int      oyProfile_CreateEffectVCGT  ( oyProfile_s       * prof )
   for(i = 0; i < width; ++i)
     for(j = 0; j < 3; ++j)
       mix[i*3+j] = OY_ROUNDp( oyLinInterpolateRampU16c( vcgt, width, j,3, oyLinInterpolateRampU16c( ramp, width, j, 3, (double)i/width )/65535.) );
-  if(getenv("OY_DEBUG_WRITE"))
+  if(oyEnvGetString(oyENV_DEBUG_WRITE))
   {
     img  = oyImage_Create( width, 1, mix, OY_TYPE_123_16, prof, 0 );
     oyImage_WritePPM( img, "wtpt-mix.ppm", "white point + vcgt" );
@@ -483,7 +483,7 @@ int          oyPolicySaveActual      ( oyGROUP_e           group,
   int error = !name;
   char * text = 0;
   char * filename = 0;
-  const char * xdg_home_dir = getenv("XDG_CONFIG_HOME");
+  const char * xdg_home_dir = oyEnvGetString(oyENV_XDG_CONFIG_HOME);
   char * path = 0, * ptr;
 
   DBG_PROG_START
@@ -110,6 +110,10 @@ const char * oy_prefered_db_ = "//" OY_TYPE_STD "/db_handler.elDB";
 
 /* private helper */
 
+/* DB modules without write batches store each key on its own */
+static int oyDBTransactionNone_      ( oySCOPE_e           scope OY_UNUSED )
+{ return 0; }
+
 oyDB_s * oyDB_newFromInit            ( const char        * top_key_name,
                                        oySCOPE_e           scope,
                                        oyAlloc_f           allocFunc,
@@ -156,6 +160,10 @@ int                oyDbHandlingSet   ( const oyDbAPI_s   * db_api )
                 oyDBSetString = db_api->setString;
        oyDBSearchEmptyKeyname = db_api->searchEmptyKeyname;
                  oyDBEraseKey = db_api->eraseKey;
+         oyDBTransactionBegin = db_api->transactionBegin ?
+                                db_api->transactionBegin : oyDBTransactionNone_;
+        oyDBTransactionCommit = db_api->transactionCommit ?
+                                db_api->transactionCommit : oyDBTransactionNone_;
 
     oy_db_handling_ready_ = 1;
     oy_db_handling_api = db_api;
@@ -176,9 +184,9 @@ int                oyDbInitialise_  ( void )
   oyOptions_s * opts = 0,
               * result_opts = 0;
 
-  if(getenv(OY_DEBUG_DB_MODULE))
+  if(oyEnvGetString(oyENV_DEBUG_DB_MODULE))
   {
-    oy_prefered_db_ = getenv(OY_DEBUG_DB_MODULE);
+    oy_prefered_db_ = oyEnvGetString(oyENV_DEBUG_DB_MODULE);
     oyMessageFunc_p( oyMSG_DBG, NULL, OY_DBG_FORMAT_
                      " selecting OY_DEBUG_DB_MODULE=\"%s\"",OY_DBG_ARGS_, oy_prefered_db_ );
   }
@@ -300,6 +308,20 @@ int      oyDBEraseKeyInit            ( const char        * key_name,
   else
     return 1;
 }
+int      oyDBTransactionBeginInit    ( oySCOPE_e           scope )
+{ 
+  if(oyDbHandlingInit() <= 0)
+    return oyDBTransactionBegin(scope);
+  else
+    return 1;
+}
+int      oyDBTransactionCommitInit   ( oySCOPE_e           scope )
+{ 
+  if(oyDbHandlingInit() <= 0)
+    return oyDBTransactionCommit(scope);
+  else
+    return 1;
+}
 
 oyDB_newFrom_f             oyDB_newFrom = oyDB_newFromInit;
 oyDB_release_f             oyDB_release = oyDB_releaseInit;
@@ -310,6 +332,8 @@ oyDB_getKeyNamesOneLevel_f oyDB_getKeyNamesOneLevel = oyDB_getKeyNamesOneLevelIn
 oyDBSetString_f            oyDBSetString = oyDBSetStringInit;
 oyDBSearchEmptyKeyname_f   oyDBSearchEmptyKeyname = oyDBSearchEmptyKeynameInit;
 oyDBEraseKey_f             oyDBEraseKey = oyDBEraseKeyInit;
+oyDBTransaction_f          oyDBTransactionBegin = oyDBTransactionBeginInit;
+oyDBTransaction_f          oyDBTransactionCommit = oyDBTransactionCommitInit;
 
 
 const char *       oyDbHandlingCurrent (void )
@@ -333,4 +357,6 @@ void               oyDbHandlingReset ( void )
                 oyDBSetString = oyDBSetStringInit;
        oyDBSearchEmptyKeyname = oyDBSearchEmptyKeynameInit;
                  oyDBEraseKey = oyDBEraseKeyInit;
+         oyDBTransactionBegin = oyDBTransactionBeginInit;
+        oyDBTransactionCommit = oyDBTransactionCommitInit;
 }
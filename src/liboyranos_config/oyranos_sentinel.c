@@ -103,6 +103,7 @@ void     oyFinish_                   ( int                 flags )
 #include "oyProfiles_s.h"
 #include "oyStructList_s_.h"
 #include "oyranos_cache.h"
+#include "oyranos_object_internal.h"
 
 /** @internal
  *
@@ -126,6 +127,8 @@ void     oyAlphaFinish_              ( int                 unused OY_UNUSED )
   }
   oyOptions_Release( &oy_db_cache_ );
   *get_oy_db_cache_init_() = 0;
+  ++*get_oy_db_cache_generation_();
+  oyRegistrationCacheRelease_();
 }
 
 #include "oyranos_alpha.h"
@@ -2338,6 +2338,9 @@ int      oyOptions_SetRegFromText    ( oyOptions_s      ** options,
 
 static int oy_db_cache_init_ = 0;
 int * get_oy_db_cache_init_() { return &oy_db_cache_init_; };
+/* increased on each DB cache change; lets modules detect stale snapshots */
+static int oy_db_cache_generation_ = 0;
+int * get_oy_db_cache_generation_() { return &oy_db_cache_generation_; };
 
 /** Function oyGetPersistentStrings
  *  @brief   cache strings from DB
@@ -2360,6 +2363,8 @@ int          oyGetPersistentStrings  ( const char        * top_key_name )
   int     key_names_n = 0;
   int init = !oy_db_cache_;
 
+  ++oy_db_cache_generation_;
+
   if(!top_key_name)
   {
     oyOptions_Release( &oy_db_cache_ );
@@ -2530,6 +2535,7 @@ int          oySetPersistentString   ( const char        * key_name,
       key = strchr( key_name, '/' ) + 1;
   }
   error = oyOptions_SetRegFromText( &oy_db_cache_, key, value, OY_ADD_ALWAYS );
+  ++oy_db_cache_generation_;
   if(error)
     WARNc3_S( "Could not set key: %d %s -> %s",
               error, key_name, value ? value : "" ); 
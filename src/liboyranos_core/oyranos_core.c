@@ -273,7 +273,7 @@ int            oyObject_GetId        ( oyObject_s          object )
 
   if(st && oy_debug_objects >= 0)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
     if(t)
       id_ = atoi(t);
@@ -721,7 +721,7 @@ void         oyObjectDebugMessage_   ( void              * object,
 
   if(st && oy_debug_objects >= 0)
   {
-    const char * t = getenv(OY_DEBUG_OBJECTS);
+    const char * t = oyEnvGetString(oyENV_DEBUG_OBJECTS);
     int id_ = -1;
     if(t)
       id_ = atoi(t);
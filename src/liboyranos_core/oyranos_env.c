@@ -0,0 +1,187 @@
+/** @file oyranos_env.c
+ *
+ *  Oyranos is an open source Color Management System
+ *
+ *  @par Copyright:
+ *            2018 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    environment snapshot
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            new BSD <http://www.opensource.org/licenses/BSD-3-Clause>
+ *  @since    2018/03/20
+ *
+ *  getenv() scans the whole environment and races with setenv() in
+ *  threaded hosts. The library reads its variables here once and looks
+ *  them up by ::oyENV_e afterwards.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "oyranos_config_internal.h"
+#include "oyranos_core.h"
+#include "oyranos_debug.h"
+#include "oyranos_definitions.h"
+#include "oyranos_helper.h"
+#include "oyranos_string.h"
+
+static const char * oy_env_names_[oyENV_MAX] = {
+  OY_DEBUG,
+  OY_DEBUG_MEMORY,
+  OY_DEBUG_OBJECTS,
+  "OY_DEBUG_OBJECTS_SKIP_CMM_CACHES",
+  OY_DEBUG_SIGNALS,
+  "OY_DEBUG_WRITE",
+  OY_DEBUG_DB_MODULE,
+  OY_BACKTRACE,
+  OY_STATS,
+  OY_TRACE,
+  OY_MODULE_PATH,
+  "LD_LIBRARY_PATH",
+  "OY_LOCALEDIR",
+  "HOME",
+  "XDG_DATA_HOME",
+  "XDG_CONFIG_HOME",
+  "XDG_DATA_DIRS",
+  "XDG_CONFIG_DIRS",
+  "TMP",
+  "TEMP",
+  "TMPDIR",
+  "DISPLAY"
+};
+
+typedef struct oyEnv_s oyEnv_s;
+struct oyEnv_s {
+  char    * values[oyENV_MAX];
+  oyEnv_s * previous;                  /**< replaced snapshot */
+};
+
+static oyEnv_s * volatile oy_env_ = NULL;
+static volatile int oy_env_lock_ = 0;
+#define oyEnvLock_m()   oySpinLock_m( oy_env_lock_ )
+#define oyEnvUnLock_m() oySpinUnLock_m( oy_env_lock_ )
+
+static oyEnv_s *   oyEnvRead_        ( void )
+{
+  oyEnv_s * env = (oyEnv_s*) calloc( 1, sizeof(oyEnv_s) );
+  int i;
+
+  if(!env)
+    return NULL;
+
+  for(i = 0; i < oyENV_MAX; ++i)
+  {
+    const char * v = getenv( oy_env_names_[i] );
+    if(v)
+      env->values[i] = strdup( v );
+  }
+
+  return env;
+}
+
+static oyEnv_s *   oyEnvGet_         ( void )
+{
+  oyEnv_s * env = oy_env_;
+
+  if(!env)
+  {
+    oyEnvLock_m()
+    if(!oy_env_)
+      oy_env_ = oyEnvRead_();
+    env = oy_env_;
+    oyEnvUnLock_m()
+  }
+
+  return env;
+}
+
+/** \addtogroup misc
+ *  @{ *//* misc */
+
+/** @brief   name of a environment variable
+ *
+ *  @param[in]     key                 the variable
+ *  @return                            the name, e.g. "OY_DEBUG"
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/20
+ *  @since   2018/03/20 (Oyranos: 0.9.7)
+ */
+const char *       oyEnvName         ( oyENV_e             key )
+{
+  if((int)key < 0 || key >= oyENV_MAX)
+    return NULL;
+  return oy_env_names_[key];
+}
+
+/** @brief   value of a environment variable
+ *
+ *  The snapshot is read on first use. Hot paths can call this instead of
+ *  getenv().
+ *
+ *  @param[in]     key                 the variable
+ *  @return                            the value or NULL if unset; the
+ *                                     string stays valid over oyEnvReload()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/20
+ *  @since   2018/03/20 (Oyranos: 0.9.7)
+ */
+const char *       oyEnvGetString    ( oyENV_e             key )
+{
+  oyEnv_s * env;
+
+  if((int)key < 0 || key >= oyENV_MAX)
+    return NULL;
+
+  env = oyEnvGet_();
+  return env ? env->values[key] : NULL;
+}
+
+/** @brief   integer value of a environment variable
+ *
+ *  @param[in]     key                 the variable
+ *  @param[in]     fallback            returned for a unset variable
+ *  @return                            the value as integer
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/20
+ *  @since   2018/03/20 (Oyranos: 0.9.7)
+ */
+int                oyEnvGetInt       ( oyENV_e             key,
+                                       int                 fallback )
+{
+  const char * v = oyEnvGetString( key );
+  return v ? atoi( v ) : fallback;
+}
+
+/** @brief   read the environment again
+ *
+ *  Call after setenv() or putenv() for variables of ::oyENV_e. Debug
+ *  levels are taken over only during library initialisation. The
+ *  previous snapshot is kept, as other threads might still read it.
+ *
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/20
+ *  @since   2018/03/20 (Oyranos: 0.9.7)
+ */
+int                oyEnvReload       ( void )
+{
+  oyEnv_s * env = oyEnvRead_();
+
+  if(!env)
+    return 1;
+
+  oyEnvLock_m()
+  env->previous = oy_env_;
+  oy_env_ = env;
+  oyEnvUnLock_m()
+
+  return 0;
+}
+
+/** @} *//* misc */
@@ -65,8 +65,8 @@ void oyI18NInit_()
   if(!oy_country_ || !oy_language_)
   {
     char * temp = 0;
-    if(getenv("OY_LOCALEDIR") && oyStrlen_(getenv("OY_LOCALEDIR")))
-      oy_domain_path = oyStringCopy_(getenv("OY_LOCALEDIR"), oyAllocateFunc_);
+    if(oyEnvGetString(oyENV_LOCALEDIR) && oyStrlen_(oyEnvGetString(oyENV_LOCALEDIR)))
+      oy_domain_path = oyStringCopy_(oyEnvGetString(oyENV_LOCALEDIR), oyAllocateFunc_);
 
     oyStringAdd_( &temp, "NLSPATH=", oyAllocateFunc_, oyDeAllocateFunc_);
     oyStringAdd_( &temp, oy_domain_path, oyAllocateFunc_, oyDeAllocateFunc_);
@@ -287,6 +287,263 @@ oyReadFileToMem_(const char* name, size_t *size,
   return mem;
 }
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#define OY_USE_MMAP 1
+#endif
+
+/* smaller files are cheaper to read than to map and fault in */
+#define OY_MMAP_MIN_SIZE 65536
+
+typedef struct oyMappedFile_s_ {
+  struct oyMappedFile_s_ * next;
+  char       * block;
+  size_t       size;
+  dev_t        dev;
+  ino_t        ino;
+  time_t       mtime;
+  int          refs;
+} oyMappedFile_s_;
+static oyMappedFile_s_ * oy_mapped_files_ = NULL;
+static volatile int oy_mapped_files_lock_ = 0;
+
+/** @internal
+ *  @brief   map a file read only into memory
+ *
+ *  The mapping is shared by all callers asking for the same unchanged file.
+ *  Pages are only read in when touched. Release with oyUnMapMem_() and
+ *  add a user with oyMapMemRef_(). The block must not be written to.
+ *
+ *  Truncating the file under a live mapping faults with SIGBUS on the
+ *  next read. oyWriteMemToFile_() therefore writes a new file and renames
+ *  it over the old one; the mapping keeps the old inode. But any user
+ *  tool can rewrite a file in place. So only files, which the caller and
+ *  other users can not write to, are mapped. That covers the system and
+ *  machine scopes; user files are read in as before.
+ *
+ *  @param[in]     full_file_name      the file to map
+ *  @param[out]    size                the file size
+ *  @return                            the mapping or NULL for small or
+ *                                     writable files, errors or missing
+ *                                     mmap support; the caller reads the
+ *                                     file then
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/20
+ *  @since   2018/03/09 (Oyranos: 0.9.7)
+ */
+char * oyMapFileToMem_               ( const char        * full_file_name,
+                                       size_t            * size )
+{
+  char * block = NULL;
+#if defined(OY_USE_MMAP)
+  const char * filename = full_file_name;
+  struct stat status;
+  oyMappedFile_s_ * m;
+  int fd;
+
+  if(!filename || !size)
+    return NULL;
+
+  if(strlen(filename) > 7 && memcmp(filename, "file://", 7) == 0)
+    filename = &filename[7];
+
+  fd = open( filename, O_RDONLY );
+  if(fd < 0)
+    return NULL;
+
+  if(fstat( fd, &status ) != 0 || !S_ISREG(status.st_mode) ||
+     status.st_size < OY_MMAP_MIN_SIZE ||
+     status.st_mode & (S_IWGRP | S_IWOTH) ||
+     access( filename, W_OK ) == 0)
+  {
+    close( fd );
+    return NULL;
+  }
+
+  oySpinLock_m( oy_mapped_files_lock_ )
+  for(m = oy_mapped_files_; m; m = m->next)
+    if(m->dev == status.st_dev && m->ino == status.st_ino &&
+       m->mtime == status.st_mtime && m->size == (size_t)status.st_size)
+    {
+      ++m->refs;
+      block = m->block;
+      *size = m->size;
+      break;
+    }
+  oySpinUnLock_m( oy_mapped_files_lock_ )
+
+  if(!block)
+  {
+    void * p = mmap( NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    m = NULL;
+    if(p != MAP_FAILED)
+      m = (oyMappedFile_s_*) calloc( sizeof(oyMappedFile_s_), 1 );
+    if(m)
+    {
+      m->block = (char*)p;
+      m->size = status.st_size;
+      m->dev = status.st_dev;
+      m->ino = status.st_ino;
+      m->mtime = status.st_mtime;
+      m->refs = 1;
+      oySpinLock_m( oy_mapped_files_lock_ )
+      m->next = oy_mapped_files_;
+      oy_mapped_files_ = m;
+      oySpinUnLock_m( oy_mapped_files_lock_ )
+      block = m->block;
+      *size = m->size;
+    } else if(p != MAP_FAILED)
+      munmap( p, status.st_size );
+  }
+
+  close( fd );
+#else
+  (void)full_file_name; (void)size;
+#endif
+
+  return block;
+}
+
+/** @internal
+ *  @brief   stop sharing the mappings of a file
+ *
+ *  Called before a file gets replaced. Existing users keep their pages of
+ *  the old inode; the last oyUnMapMem_() unmaps as usual.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/16
+ *  @since   2018/04/16 (Oyranos: 0.9.7)
+ */
+void   oyMapFileForget_              ( const char        * full_file_name )
+{
+#if defined(OY_USE_MMAP)
+  struct stat status;
+  oyMappedFile_s_ * m;
+
+  if(!full_file_name || !oy_mapped_files_ ||
+     stat( full_file_name, &status ) != 0)
+    return;
+
+  oySpinLock_m( oy_mapped_files_lock_ )
+  for(m = oy_mapped_files_; m; m = m->next)
+    if(m->dev == status.st_dev && m->ino == status.st_ino)
+    {
+      m->dev = 0;
+      m->ino = 0;
+      m->mtime = 0;
+    }
+  oySpinUnLock_m( oy_mapped_files_lock_ )
+#else
+  (void)full_file_name;
+#endif
+}
+
+/** @internal
+ *  @brief   check for a oyMapFileToMem_() block
+ *
+ *  @return                            1 - block is mapped, 0 - not mapped
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/09
+ *  @since   2018/03/09 (Oyranos: 0.9.7)
+ */
+int    oyIsMappedMem_                ( const void        * block )
+{
+  oyMappedFile_s_ * m;
+  int mapped = 0;
+
+  if(!block || !oy_mapped_files_)
+    return mapped;
+
+  oySpinLock_m( oy_mapped_files_lock_ )
+  for(m = oy_mapped_files_; m; m = m->next)
+    if(m->block == block)
+    {
+      mapped = 1;
+      break;
+    }
+  oySpinUnLock_m( oy_mapped_files_lock_ )
+
+  return mapped;
+}
+
+/** @internal
+ *  @brief   add a user to a oyMapFileToMem_() block
+ *
+ *  @return                            0 - block is mapped, 1 - not mapped
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/09
+ *  @since   2018/03/09 (Oyranos: 0.9.7)
+ */
+int    oyMapMemRef_                  ( const void        * block )
+{
+  oyMappedFile_s_ * m;
+  int error = 1;
+
+  if(!block || !oy_mapped_files_)
+    return error;
+
+  oySpinLock_m( oy_mapped_files_lock_ )
+  for(m = oy_mapped_files_; m; m = m->next)
+    if(m->block == block)
+    {
+      ++m->refs;
+      error = 0;
+      break;
+    }
+  oySpinUnLock_m( oy_mapped_files_lock_ )
+
+  return error;
+}
+
+/** @internal
+ *  @brief   release a oyMapFileToMem_() block
+ *
+ *  The last user unmaps the file.
+ *
+ *  @return                            0 - released, 1 - block is not mapped
+ *                                     and needs a normal deallocation
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/09
+ *  @since   2018/03/09 (Oyranos: 0.9.7)
+ */
+int    oyUnMapMem_                   ( void              * block )
+{
+  oyMappedFile_s_ * m, ** prev;
+  int error = 1;
+
+  if(!block || !oy_mapped_files_)
+    return error;
+
+  oySpinLock_m( oy_mapped_files_lock_ )
+  for(prev = &oy_mapped_files_, m = oy_mapped_files_; m;
+      prev = &m->next, m = m->next)
+    if(m->block == block)
+    {
+      error = 0;
+      if(--m->refs == 0)
+        *prev = m->next;
+      else
+        m = NULL;
+      break;
+    }
+  oySpinUnLock_m( oy_mapped_files_lock_ )
+
+#if defined(OY_USE_MMAP)
+  if(!error && m)
+  {
+    munmap( m->block, m->size );
+    free( m );
+  }
+#endif
+
+  return error;
+}
+
 char * oyReadStdinToMem_             ( size_t            * size,
                                        oyAlloc_f           allocate_func )
 {
@@ -531,17 +788,40 @@ char * oyReadUrlToMemf_              ( size_t            * size,
   return result;
 }
 
+/** @internal
+ *  @brief   write a file in one step
+ *
+ *  The data goes to a temporary file beside the target, which is then
+ *  renamed over the target. Readers and oyMapFileToMem_() mappings of
+ *  the old file are not disturbed. A symbolic link is resolved, so the
+ *  file it points to gets replaced.
+ *
+ *  The replacement has consequences compared to writing in place:
+ *  - write access to the directory is needed, not only to the file
+ *  - the new file belongs to the writing user and group; only the
+ *    permission bits of the old file are kept
+ *  - a hard link to the old file keeps the old content
+ *
+ *  @return                            0 - success, otherwise errno or 1
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/20
+ *  @since   2004/11/25 (Oyranos: 0.1.x)
+ */
 int
 oyWriteMemToFile_(const char* name, const void* mem, size_t size)
 {
   FILE *fp = 0;
-  /*int   pt = 0;
-  char* block = mem;*/
   const char* filename;
-  char * full_name = 0;
+  char * full_name = 0,
+       * tmp_name = 0;
   int r = !name;
   size_t written_n = 0;
   char * path = 0;
+#ifdef HAVE_POSIX
+  struct stat status;
+  int keep_mode = 0;
+#endif
 
   DBG_PROG_START
 
@@ -552,6 +832,20 @@ oyWriteMemToFile_(const char* name, const void* mem, size_t size)
   if(!r)
   {
     full_name = oyResolveDirFileName_( filename );
+#ifdef HAVE_POSIX
+    if(full_name && lstat( full_name, &status ) == 0 && S_ISLNK(status.st_mode))
+    {
+      char * real = realpath( full_name, NULL );
+      if(real)
+      {
+        oyDeAllocateFunc_( full_name );
+        full_name = oyStringCopy( real, oyAllocateFunc_ );
+        free( real );
+      }
+    }
+    if(full_name && stat( full_name, &status ) == 0)
+      keep_mode = 1;
+#endif
     path = oyExtractPathFromFileName_( full_name );
     /* oyMakeDir_() needs a ending slash '/' */
     STRING_ADD( path, OY_SLASH );
@@ -560,30 +854,44 @@ oyWriteMemToFile_(const char* name, const void* mem, size_t size)
 
   if(!r)
   {
-    fp = fopen(full_name, "wb");
-    DBG_PROG2_S("fp = %d filename = %s", (int)(intptr_t)fp, filename)
-    if ((fp != 0)
-     && mem
-     && size)
+    if(!mem || !size)
+      WARNc1_S("no data to write into: \"%s\"", filename );
+
+    oyStringAddPrintf_( &tmp_name, oyAllocateFunc_, oyDeAllocateFunc_,
+                        "%s.tmp-%d", full_name, (int)OY_GETPID() );
+    fp = fopen(tmp_name, "wb");
+    DBG_PROG2_S("fp = %d filename = %s", (int)(intptr_t)fp, tmp_name)
+    if(fp)
     {
-#if 0
-      do {
-        r = fputc ( block[pt++] , fp);
-      } while (--size);
-#else
-      written_n = fwrite( mem, 1, size, fp );
+      if(mem && size)
+        written_n = fwrite( mem, 1, size, fp );
       if(written_n != size)
-        r = errno;
+        r = errno ? errno : 1;
+      if(fclose( fp ) != 0 && !r)
+        r = errno ? errno : 1;
+    } else
+      r = errno ? errno : 1;
+
+#ifdef HAVE_POSIX
+    if(!r && keep_mode)
+      chmod( tmp_name, status.st_mode & 07777 );
 #endif
-    } else 
-      if(mem && size)
-        r = errno;
-      else
-        WARNc1_S("no data to write into: \"%s\"", filename );
+    if(!r)
+    {
+      oyMapFileForget_( full_name );
+#ifdef _WIN32
+      /* rename() does not replace an existing file there */
+      remove( full_name );
+#endif
+      if(rename( tmp_name, full_name ) != 0)
+        r = errno ? errno : 1;
+    }
+    if(r)
+      remove( tmp_name );
 
     if(r && oy_debug > 1)
     {
-      switch (errno)
+      switch (r)
       {
         case EACCES:       WARNc1_S("Permission denied: %s", filename); break;
         case EIO:          WARNc1_S("EIO : %s", filename); break;
@@ -592,13 +900,12 @@ oyWriteMemToFile_(const char* name, const void* mem, size_t size)
         case ENOTDIR:      WARNc1_S("ENOTDIR : %s", filename); break;
         case ELOOP:        WARNc1_S("Too many symbolic links encountered while traversing the path: %s", filename); break;
         case EOVERFLOW:    WARNc1_S("EOVERFLOW : %s", filename); break;
-        default:           WARNc2_S("%s : %s", strerror(errno), filename);break;
+        default:           WARNc2_S("%s : %s", strerror(r), filename);break;
       }
     }
-
-    if (fp) fclose (fp);
   }
 
+  if(tmp_name) oyDeAllocateFunc_( tmp_name );
   if(path) oyDeAllocateFunc_( path );
   if(full_name) oyDeAllocateFunc_( full_name );
 
@@ -650,14 +957,14 @@ char * oyGetTempFileName_            ( const char        * name,
 
   if(flags & OY_FILE_TEMP_DIR)
   {
-    if(getenv("TMP") && strlen(getenv("TMP")))
-      tmp_dir = getenv("TMP");
+    if(oyEnvGetString(oyENV_TMP) && strlen(oyEnvGetString(oyENV_TMP)))
+      tmp_dir = oyEnvGetString(oyENV_TMP);
     else
-    if(getenv("TEMP") && strlen(getenv("TEMP")))
-      tmp_dir = getenv("TEMP");
+    if(oyEnvGetString(oyENV_TEMP) && strlen(oyEnvGetString(oyENV_TEMP)))
+      tmp_dir = oyEnvGetString(oyENV_TEMP);
     else
-    if(getenv("TMPDIR") && strlen(getenv("TMPDIR")))
-      tmp_dir = getenv("TMPDIR");
+    if(oyEnvGetString(oyENV_TMPDIR) && strlen(oyEnvGetString(oyENV_TMPDIR)))
+      tmp_dir = oyEnvGetString(oyENV_TMPDIR);
     else
       tmp_dir = "/tmp";
 
@@ -844,7 +1151,7 @@ char * oyGetHomeDir_ ()
   DBG_PROG_ENDE
   return path;
 # else
-  char* name = (char*) getenv("HOME");
+  char* name = (char*) oyEnvGetString(oyENV_HOME);
 
   DBG_PROG_START
 
@@ -1478,8 +1785,8 @@ char**  oyXDGPathsGet_( int             * count,
 {
   char ** paths = 0, ** tmp;
   int     n = 0, tmp_n = 0;
-  char *  vars[] = {"XDG_DATA_HOME", "XDG_CONFIG_HOME", "XDG_DATA_DIRS", 
-                    "XDG_CONFIG_DIRS"};
+  oyENV_e vars[] = {oyENV_XDG_DATA_HOME, oyENV_XDG_CONFIG_HOME,
+                    oyENV_XDG_DATA_DIRS, oyENV_XDG_CONFIG_DIRS};
   int     vars_n = 4;
   int     i, j;
 
@@ -1490,7 +1797,7 @@ char**  oyXDGPathsGet_( int             * count,
       if( ((i == 0 || i == 2) && data != oyNO) ||
           ((i == 1 || i == 3) && data != oyYES) )
     {
-      const char * var = getenv(vars[i]);
+      const char * var = oyEnvGetString(vars[i]);
       if(var)
       {
         if(strlen(var))
@@ -1810,7 +2117,7 @@ char**  oyLibPathsGet_( int             * count,
 {
   char ** paths = 0, ** tmp;
   int     n = 0, tmp_n = 0;
-  char *  vars[] = {OY_MODULE_PATH,"LD_LIBRARY_PATH"};
+  oyENV_e vars[] = {oyENV_MODULE_PATH, oyENV_LD_LIBRARY_PATH};
   int     vars_n = 2;
   int     i,j;
   char  * fix_paths[5] = {0,0,0,0,0};
@@ -1860,7 +2167,7 @@ char**  oyLibPathsGet_( int             * count,
   for(i = 0; i < vars_n; ++i)
   {
     {
-      const char * var = getenv(vars[i]);
+      const char * var = oyEnvGetString(vars[i]);
       if(var)
       {
 
@@ -1881,7 +2188,7 @@ char**  oyLibPathsGet_( int             * count,
             {
               if(!oyIsDir_(fp))
                 DBG_PROG4_S("%s %s:\"%s\"/\"%s\"",_("path is not readable"),
-                         oyNoEmptyString_m_(vars[i]),
+                         oyNoEmptyString_m_(oyEnvName(vars[i])),
                          oyNoEmptyString_m_(full_name),
                          oyNoEmptyString_m_(subdir) );
               full_paths[full_paths_n++] = fp; fp = NULL;
@@ -135,6 +135,38 @@ int            oyRampManipulateU16   ( uint16_t          * ramp1,
   return error;
 }
 
+/** @brief   mix two ramps linear
+ *
+ *  @param[in]     ramp1               returned for pos 0.0
+ *  @param[in]     ramp2               returned for pos 1.0
+ *  @param[out]    ramp_result         can be ramp1 or ramp2
+ *  @param[in]     ramp_size           number of values in each ramp
+ *  @param[in]     pos                 mix position; clipped to 0.0 - 1.0
+ *  @return                            error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/10
+ *  @since   2018/04/10 (Oyranos: 0.9.7)
+ */
+int            oyRampMixU16          ( uint16_t          * ramp1,
+                                       uint16_t          * ramp2,
+                                       uint16_t          * ramp_result,
+                                       int                 ramp_size,
+                                       double              pos )
+{
+  int error = !ramp1 || !ramp2 || !ramp_result,
+      i;
+
+  if(pos < 0.0) pos = 0.0;
+  if(pos > 1.0) pos = 1.0;
+
+  if(!error)
+    for(i = 0; i < ramp_size; ++i)
+      ramp_result[i] = (uint16_t)(ramp1[i] + (ramp2[i] - (double)ramp1[i]) * pos + 0.5);
+
+  return error;
+}
+
 MANIPULATION_FUNCTION( float, +, oyAddF32 )
 MANIPULATION_FUNCTION( float, -, oySubstF32 )
 MANIPULATION_FUNCTION( float, *, oyMultF32 )
@@ -39,14 +39,14 @@ void oyInit_()
   }
   oy_sentinel_initialised_ = 1;
 
-  if(getenv(OY_DEBUG))
+  if(oyEnvGetString(oyENV_DEBUG))
   {
     char * version = oyVersionString(1,0);
     char * id = oyVersionString(2,0);
     char * cfg_date =  oyVersionString(3,0);
     char * devel_time = oyVersionString(4,0);
 
-    oy_debug = atoi(getenv(OY_DEBUG));
+    oy_debug = oyEnvGetInt(oyENV_DEBUG, 0);
     DBG3_S( "Oyranos v%s config: %s devel period: %s",
                   oyNoEmptyName_m_(version),
                   oyNoEmptyName_m_(cfg_date), oyNoEmptyName_m_(devel_time) );
@@ -58,25 +58,28 @@ void oyInit_()
     oyFree_m_(devel_time);
   }
 
-  if(getenv(OY_DEBUG_MEMORY))
-    oy_debug_memory = atoi(getenv(OY_DEBUG_MEMORY));
+  oy_debug_memory = oyEnvGetInt(oyENV_DEBUG_MEMORY, oy_debug_memory);
 
-  if(getenv(OY_DEBUG_OBJECTS))
+  if(oyEnvGetString(oyENV_DEBUG_OBJECTS))
   {
-    oy_debug_objects = atoi(getenv(OY_DEBUG_OBJECTS));
+    oy_debug_objects = oyEnvGetInt(oyENV_DEBUG_OBJECTS, 0);
     if(!oy_debug_objects) oy_debug_objects = 0;
   }
 
-  if(getenv(OY_DEBUG_SIGNALS))
-    oy_debug_signals = atoi(getenv(OY_DEBUG_SIGNALS));
+  oy_debug_signals = oyEnvGetInt(oyENV_DEBUG_SIGNALS, oy_debug_signals);
 
-  if(getenv(OY_BACKTRACE))
+  if(oyEnvGetString(oyENV_BACKTRACE))
   {
-    oy_backtrace = getenv(OY_BACKTRACE);
+    oy_backtrace = oyEnvGetString(oyENV_BACKTRACE);
     if(!oy_debug)
       ++oy_debug;
   }
 
+  if(oyEnvGetString(oyENV_TRACE))
+    oyStatsSet( oySTATS_ENABLE | oySTATS_TRACE );
+  else if(oyEnvGetInt(oyENV_STATS, 0))
+    oyStatsSet( oySTATS_ENABLE );
+
   oyI18NInit_ ();
   DBG_PROG_ENDE
 }
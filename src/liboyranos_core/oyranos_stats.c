@@ -0,0 +1,338 @@
+/** @file oyranos_stats.c
+ *
+ *  Oyranos is an open source Color Management System
+ *
+ *  @par Copyright:
+ *            2018 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    instrumentation counters, timers and traces
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            new BSD <http://www.opensource.org/licenses/BSD-3-Clause>
+ *  @since    2018/03/08
+ *
+ *  The probes are placed in hot paths. So they test only the ::oy_stats
+ *  integer, unless switched on by ::OY_STATS, ::OY_TRACE or oyStatsSet().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "oyranos_config_internal.h"
+#include "oyranos_core.h"
+#include "oyranos_debug.h"
+#include "oyranos_definitions.h"
+#include "oyranos_helper.h"
+#include "oyranos_i18n.h"
+#include "oyranos_string.h"
+
+#if defined(_WIN32)
+# include <process.h>
+#else
+# include <time.h>
+# include <unistd.h>
+#endif
+#if defined(HAVE_PTHREAD)
+# include <pthread.h>
+#endif
+
+/** @internal
+ *  instrumentation flags - 0 is off (default); see oyStatsSet() */
+int oy_stats = 0;
+
+typedef struct {
+  double count;
+  double seconds;
+  double value;
+} oyStatsProbe_s;
+
+typedef struct {
+  int    probe;
+  double start;
+  double end;
+  double value;
+  unsigned long thread;
+} oyStatsEvent_s;
+
+static const char * oy_stats_names_[oySTATS_MAX] = {
+  "module_scan",
+  "cache_hit",
+  "cache_miss",
+  "transform_build",
+  "pixel_run",
+  "device_open",
+  "device_parse"
+};
+static oyStatsProbe_s oy_stats_probes_[oySTATS_MAX];
+static oyStatsEvent_s * oy_stats_events_ = NULL;
+static int oy_stats_events_n_ = 0,
+           oy_stats_events_reserved_ = 0;
+static double oy_stats_epoch_ = 0.0;
+/* limit the trace to around 40 MB */
+#define OY_STATS_EVENTS_MAX 1000000
+
+/* The enabled path is only used for diagnosis. A spin lock keeps the core
+ * library free of a thread library dependency. */
+static volatile int oy_stats_lock_ = 0;
+#define oyStatsLock_m()   oySpinLock_m( oy_stats_lock_ )
+#define oyStatsUnLock_m() oySpinUnLock_m( oy_stats_lock_ )
+
+/** @internal
+ *  @brief monotonic time in seconds
+ *
+ *  oySeconds() has only 0.1 ms resolution.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/08
+ *  @since   2018/03/08 (Oyranos: 0.9.7)
+ */
+double             oyStatsStart_     ( void )
+{
+#if defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+  return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+#else
+  return oySeconds();
+#endif
+}
+
+static unsigned long oyStatsThread_  ( void )
+{
+#if defined(HAVE_PTHREAD)
+  return (unsigned long) pthread_self();
+#else
+  return 0;
+#endif
+}
+
+/** @internal
+ *  @brief account a span to a probe
+ *
+ *  Use the oyStatsEnd_m() macro to keep the disabled path cheap.
+ *
+ *  @param[in]     probe               a ::oySTATS_e
+ *  @param[in]     start               from oyStatsStart_m(); 0.0 skips
+ *                                     the span
+ *  @param[in]     value               probe specific amount, e.g. pixels
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/19
+ *  @since   2018/03/08 (Oyranos: 0.9.7)
+ */
+void               oyStatsEnd_       ( int                 probe,
+                                       double              start,
+                                       double              value )
+{
+  double end;
+
+  /* the span began with disabled stats */
+  if(start == 0.0 || probe < 0 || probe >= oySTATS_MAX)
+    return;
+
+  end = oyStatsStart_();
+
+  oyStatsLock_m()
+  oy_stats_probes_[probe].count += 1.0;
+  oy_stats_probes_[probe].seconds += end - start;
+  oy_stats_probes_[probe].value += value;
+
+  if(oy_stats & oySTATS_TRACE &&
+     oy_stats_events_n_ < OY_STATS_EVENTS_MAX)
+  {
+    if(oy_stats_events_n_ >= oy_stats_events_reserved_)
+    {
+      int n = oy_stats_events_reserved_ ? oy_stats_events_reserved_ * 2 : 4096;
+      oyStatsEvent_s * events = (oyStatsEvent_s*) realloc( oy_stats_events_,
+                                                 sizeof(oyStatsEvent_s) * n );
+      if(events)
+      {
+        oy_stats_events_ = events;
+        oy_stats_events_reserved_ = n;
+      }
+    }
+    if(oy_stats_events_n_ < oy_stats_events_reserved_)
+    {
+      oyStatsEvent_s * e = &oy_stats_events_[oy_stats_events_n_++];
+      e->probe = probe;
+      e->start = start;
+      e->end = end;
+      e->value = value;
+      e->thread = oyStatsThread_();
+    }
+  }
+  oyStatsUnLock_m()
+}
+
+static void oyStatsAtExit_           ( void )
+{
+  if(oy_stats & oySTATS_TRACE)
+    oyStatsTraceWrite( NULL );
+}
+
+/** \addtogroup misc
+ *  @{ *//* misc */
+
+/** @brief   switch instrumentation
+ *
+ *  Counters and timers are collected with ::oySTATS_ENABLE. With
+ *  ::oySTATS_TRACE each probe is additionally recorded as span.
+ *  When the ::OY_TRACE variable names a file, the spans are written there
+ *  at exit.
+ *  The ::OY_STATS and ::OY_TRACE environment variables set the flags during
+ *  library initialisation.
+ *
+ *  @param[in]     flags               ::oySTATS_ENABLE, ::oySTATS_TRACE
+ *                                     or zero to switch off
+ *  @return                            the previous flags
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/08
+ *  @since   2018/03/08 (Oyranos: 0.9.7)
+ */
+int                oyStatsSet        ( int                 flags )
+{
+  static int at_exit = 0;
+  int old = oy_stats;
+
+  if(flags & oySTATS_TRACE)
+    flags |= oySTATS_ENABLE;
+
+  if(flags && !oy_stats_epoch_)
+    oy_stats_epoch_ = oyStatsStart_();
+
+  if(flags & oySTATS_TRACE && !at_exit && oyEnvGetString(oyENV_TRACE))
+  {
+    at_exit = 1;
+    atexit( oyStatsAtExit_ );
+  }
+
+  oy_stats = flags;
+
+  return old;
+}
+
+/** @brief   read a probe
+ *
+ *  @param[in]     probe               the probe to read
+ *  @param[out]    count               number of recorded calls
+ *  @param[out]    seconds             accumulated time
+ *  @param[out]    value               accumulated probe specific value
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/08
+ *  @since   2018/03/08 (Oyranos: 0.9.7)
+ */
+int                oyStatsGet        ( oySTATS_e           probe,
+                                       double            * count,
+                                       double            * seconds,
+                                       double            * value )
+{
+  if((int)probe < 0 || probe >= oySTATS_MAX)
+    return 1;
+
+  oyStatsLock_m()
+  if(count) *count = oy_stats_probes_[probe].count;
+  if(seconds) *seconds = oy_stats_probes_[probe].seconds;
+  if(value) *value = oy_stats_probes_[probe].value;
+  oyStatsUnLock_m()
+
+  return 0;
+}
+
+/** @brief   all probes as JSON
+ *
+ *  The result looks like: {"module_scan":{"count":2,"seconds":0.0105,"value":0},...}
+ *
+ *  @param[in]     allocateFunc        user allocator
+ *  @return                            the JSON text
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/08
+ *  @since   2018/03/08 (Oyranos: 0.9.7)
+ */
+char *             oyStatsToText     ( oyAlloc_f           allocateFunc )
+{
+  char * text = NULL, * t;
+  int i;
+
+  oyStringAddPrintf( &text, 0,0, "{" );
+  for(i = 0; i < oySTATS_MAX; ++i)
+  {
+    double count = 0, seconds = 0, value = 0;
+    oyStatsGet( (oySTATS_e)i, &count, &seconds, &value );
+    oyStringAddPrintf( &text, 0,0,
+                       "%s\"%s\":{\"count\":%.0f,\"seconds\":%g,\"value\":%.0f}",
+                       i ? "," : "", oy_stats_names_[i], count, seconds, value );
+  }
+  oyStringAddPrintf( &text, 0,0, "}" );
+
+  t = oyStringCopy( text, allocateFunc );
+  oyFree_m_( text );
+
+  return t;
+}
+
+/** @brief   clear all probes and recorded spans
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/08
+ *  @since   2018/03/08 (Oyranos: 0.9.7)
+ */
+void               oyStatsReset      ( void )
+{
+  oyStatsLock_m()
+  memset( oy_stats_probes_, 0, sizeof(oy_stats_probes_) );
+  oy_stats_events_n_ = 0;
+  oyStatsUnLock_m()
+}
+
+/** @brief   write recorded spans as Chrome trace-event JSON
+ *
+ *  The file can be loaded into chrome://tracing .
+ *
+ *  @param[in]     file_name           the file to write; NULL uses ::OY_TRACE
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/08
+ *  @since   2018/03/08 (Oyranos: 0.9.7)
+ */
+int                oyStatsTraceWrite ( const char        * file_name )
+{
+  FILE * fp;
+  int i, pid = (int)OY_GETPID();
+
+  if(!file_name)
+    file_name = oyEnvGetString(oyENV_TRACE);
+  if(!file_name || !file_name[0])
+    return 1;
+
+  fp = fopen( file_name, "w" );
+  if(!fp)
+  {
+    WARNc2_S( "%s: %s", "could not write", file_name );
+    return 1;
+  }
+
+  fprintf( fp, "{\"traceEvents\":[" );
+  oyStatsLock_m()
+  for(i = 0; i < oy_stats_events_n_; ++i)
+  {
+    oyStatsEvent_s * e = &oy_stats_events_[i];
+    fprintf( fp, "%s\n{\"name\":\"%s\",\"cat\":\"oyranos\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%lu,\"args\":{\"value\":%.0f}}",
+             i ? "," : "", oy_stats_names_[e->probe],
+             (e->start - oy_stats_epoch_) * 1000000.0,
+             (e->end - e->start) * 1000000.0,
+             pid, e->thread, e->value );
+  }
+  oyStatsUnLock_m()
+  fprintf( fp, "\n],\"displayTimeUnit\":\"ms\"}\n" );
+  fclose( fp );
+
+  return 0;
+}
+
+/** @} *//* misc */
@@ -1204,7 +1204,7 @@ void               oyObjectTreePrint ( int                 flags )
 {
   if(oy_debug_objects >= 0)
   {
-    int skip_cmm_caches_flag = getenv("OY_DEBUG_OBJECTS_SKIP_CMM_CACHES") ? 0x04 : 0;
+    int skip_cmm_caches_flag = oyEnvGetString(oyENV_DEBUG_OBJECTS_SKIP_CMM_CACHES) ? 0x04 : 0;
     int * ids_old = oyObjectGetCurrentObjectIdList( );
     oyTreeData_s * trees = (oyTreeData_s*) myCalloc_m( sizeof( oyTreeData_s ), oy_object_list_max_count_ + 1 );
     int n, i, count = 0;
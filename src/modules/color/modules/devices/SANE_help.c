@@ -26,6 +26,19 @@ static const char help_message[] = ""
 " |--------+--------------+--------------+------------+--------------+---------------+------------------+-------------------------------------|\n"
 " |optional|device_handle |              |sane_open() |::backend_core|device_handle  |SANE_Handle       |Get a handle to the scanner device.  |\n"
 " |        |              |              |is called   |              |               |(oyBlob_s)        |Lifetime until sane_close()          |\n"
+" |--------+--------------+--------------+------------+--------------+---------------+------------------+-------------------------------------|\n"
+" |        |              |              |            |              |               |                  |Serve the device list from a cache.  |\n"
+" |optional|freshness     |<double>      |seconds;    |              |               |                  |When older, answer with it and       |\n"
+" |        |              |              |default 30  |              |               |                  |enumerate again in the background    |\n"
+" |--------+--------------+--------------+------------+--------------+---------------+------------------+-------------------------------------|\n"
+" |optional|cache         |refresh       |            |              |               |                  |Drop the cached devices and color    |\n"
+" |        |              |              |            |              |               |                  |properties before answering          |\n"
+" |--------+--------------+--------------+------------+--------------+---------------+------------------+-------------------------------------|\n"
+" |optional|session       |close         |sane_exit() |              |               |                  |End the SANE session kept open for   |\n"
+" |        |              |              |if opened by|              |               |                  |former device_handle, device_context |\n"
+" |        |              |              |the module  |              |               |                  |or driver_version calls              |\n"
+" |--------+--------------+--------------+------------+--------------+---------------+------------------+-------------------------------------|\n"
+" |optional|backend       |<string>      |e.g. test   |              |               |                  |List only devices of this backend    |\n"
 " |-------------------------------------------------------------------------------------------------------------------------------------------|\n"
 " |                                              Get the properties of a particular SANE device                                               |\n"
 " |-------------------------------------------------------------------------------------------------------------------------------------------|\n"
@@ -52,6 +65,16 @@ static const char help_message[] = ""
 " |        |              |              |            |              |               |                  |sane_close(sane_handle) herself      |\n"
 " |--------+--------------+--------------+------------+--------------+---------------+------------------+-------------------------------------|\n"
 " |optional|driver_version|<int>         |            |::backend_core|driver_version |<int>             |                                     |\n"
+" |--------+--------------+--------------+------------+--------------+---------------+------------------+-------------------------------------|\n"
+" |optional|freshness     |<double>      |seconds;    |              |               |                  |Reuse the cached color options,      |\n"
+" |        |              |              |default 30  |              |               |                  |without calling sane_open()          |\n"
+" |--------+--------------+--------------+------------+--------------+---------------+------------------+-------------------------------------|\n"
+" |optional|cache         |refresh       |            |              |               |                  |Drop the cached devices and color    |\n"
+" |        |              |              |            |              |               |                  |properties before answering          |\n"
+" |--------+--------------+--------------+------------+--------------+---------------+------------------+-------------------------------------|\n"
+" |optional|session       |close         |sane_exit() |              |               |                  |End the SANE session kept open for   |\n"
+" |        |              |              |if opened by|              |               |                  |former device_handle, device_context |\n"
+" |        |              |              |the module  |              |               |                  |or driver_version calls              |\n"
 " |-------------------------------------------------------------------------------------------------------------------------------------------|\n"
 " |                                                       Get an extensive help mesage                                                        |\n"
 " |-------------------------------------------------------------------------------------------------------------------------------------------|\n"
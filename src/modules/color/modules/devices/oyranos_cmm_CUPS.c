@@ -34,6 +34,13 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <locale.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
 
 /* internal Oyranos APIs */
 #include "oyranos_texts.h"
@@ -78,6 +85,14 @@
 #define _DBG_FORMAT_ "%s:%d %s()"
 #define _DBG_ARGS_ (strrchr(__FILE__,'/') ? strrchr(__FILE__,'/')+1 : __FILE__),__LINE__,__func__
 
+#if CUPS_VERSION_MAJOR*100+CUPS_VERSION_MINOR < 107
+#define CUPS_HTTP_OK           HTTP_OK
+#define CUPS_HTTP_NOT_MODIFIED HTTP_NOT_MODIFIED
+#else
+#define CUPS_HTTP_OK           HTTP_STATUS_OK
+#define CUPS_HTTP_NOT_MODIFIED HTTP_STATUS_NOT_MODIFIED
+#endif
+
 static int _initialised = 0;
 int CUPSgetProfiles                  ( const char        * device_name,
                                        ppd_file_t        * ppd_file,
@@ -103,6 +118,7 @@ int          resetPPDAttributes_     ( ppd_file_t        * ppd,
 int          LoadDevice              ( oyConfig_s        * device,
                                        oyConfigs_s       * devices,
                                        ppd_file_t        * ppd_file,
+                                       const char        * ppd_file_location,
                                        const char        * device_name,
                                        oyOptions_s       * options );
 
@@ -172,6 +188,10 @@ const char * _help_list =
       " The bidirectional \"oyNAME_DESCRIPTION\" option turns the \"list\" \n"
       " call into a expensive one.\n"
       " The option \"device_name\" may be added as a filter.\n"
+      " The option \"ppd_dir\" names a local directory. Each \"name.ppd\"\n"
+      " file in it is used as device \"name\" instead of the CUPS server.\n"
+      " The printer list is kept for some seconds and parsed PPDs until\n"
+      " they change. The option \"cache\" with value \"refresh\" drops both.\n"
       " \"list\" is normally a cheap call, see oyNAME_DESCRIPTION above."
       " Informations are stored in the returned oyConfig_s::data member.";
 const char * _help_properties =
@@ -241,40 +261,259 @@ http_t * oyGetCUPSConnection()
   return cups_http_;
 }
 
-int GetDevices                       ( http_t            * http,
+/* The destination list is kept for a few seconds, as "list" and
+ * "properties" calls follow each other quickly. */
+#define CUPS_DESTS_TTL 5.0
+static char ** cups_dests_ = NULL;
+static int     cups_dests_n_ = 0;
+static double  cups_dests_time_ = 0.0;
+
+/* parsed PPDs by printer; downloaded PPDs are reused with If-Modified-Since */
+typedef struct {
+  char       * name;                   /* device_name */
+  char       * path;                   /* the PPD file */
+  int          downloaded;             /* remove path with the entry */
+  time_t       modtime;                /* server side modification time */
+  time_t       mtime;
+  off_t        size;
+  ppd_file_t * ppd;
+} CUPSppd_s;
+static CUPSppd_s * cups_ppds_ = NULL;
+static int         cups_ppds_n_ = 0;
+
+#if defined(HAVE_PTHREAD)
+/* guards cups_dests_ and cups_ppds_; a PPD from CUPSppdGet_() is used
+ * while holding it, as a other thread might parse it again */
+static pthread_mutex_t cups_cache_lock_ = PTHREAD_MUTEX_INITIALIZER;
+#define CUPSLock_m()   pthread_mutex_lock( &cups_cache_lock_ );
+#define CUPSUnLock_m() pthread_mutex_unlock( &cups_cache_lock_ );
+#else
+#define CUPSLock_m()
+#define CUPSUnLock_m()
+#endif
+
+/** @internal
+ *  @brief   drop the destination list and all parsed PPDs
+ *
+ *  Triggered by the "cache=refresh" option. The caller holds
+ *  cups_cache_lock_.
+ */
+static void  CUPSCacheClear_         ( void )
+{
+  int i;
+
+  if(cups_dests_)
+    oyStringListRelease_( &cups_dests_, cups_dests_n_, oyDeAllocateFunc_ );
+  cups_dests_n_ = 0;
+  cups_dests_time_ = 0.0;
+
+  for(i = 0; i < cups_ppds_n_; ++i)
+  {
+    CUPSppd_s * e = &cups_ppds_[i];
+    if(e->ppd) ppdClose( e->ppd );
+    if(e->path && e->downloaded) unlink( e->path );
+    if(e->name) oyDeAllocateFunc_( e->name );
+    if(e->path) oyDeAllocateFunc_( e->path );
+  }
+  if(cups_ppds_) oyDeAllocateFunc_( cups_ppds_ );
+  cups_ppds_ = NULL;
+  cups_ppds_n_ = 0;
+}
+
+int GetDevices                       ( const char        * ppd_dir,
                                        char            *** list,
                                        oyAlloc_f           allocateFunc )
 {
     cups_dest_t *dests, *dest;
 
-    int num_dests;
+    int num_dests = 0;
     int i, p;
 
     int len;
     char ** texts;
 
-    /* Open access to printer(s) installed on system. */
-    num_dests = cupsGetDests2(http, &dests);
-    len = sizeof(char*) * num_dests;
-    texts = allocateFunc( len );
+    /* a local PPD directory replaces the server; each "name.ppd" is a device */
+    if(ppd_dir)
+    {
+      DIR * dir = opendir( ppd_dir );
+      struct dirent * entry;
+      char ** names = NULL;
 
-    memset( texts, 0, len );
+      while(dir && (entry = readdir( dir )) != NULL)
+      {
+        const char * suffix = strrchr( entry->d_name, '.' );
+        if(suffix && suffix != entry->d_name && strcmp( suffix, ".ppd" ) == 0)
+        {
+          char * name = oyStringCopy_( entry->d_name, oyAllocateFunc_ );
+          name[suffix - entry->d_name] = 0;
+          oyStringListAddString_( &names, &num_dests, &name,
+                                  oyAllocateFunc_, oyDeAllocateFunc_ );
+        }
+      }
+      if(dir) closedir( dir );
+
+      len = sizeof(char*) * num_dests;
+      texts = allocateFunc( len + 1 );
+      memset( texts, 0, len + 1 );
+      for(p = 0; p < num_dests; ++p)
+        texts[p] = oyStringCopy_( names[p], allocateFunc );
+      oyStringListRelease_( &names, num_dests, oyDeAllocateFunc_ );
 
-    /* Use CUPS to obtain printer name(s) on the default server. */
-    for (p = 0, i = num_dests, dest = dests; i > 0; i--, dest++, p++)
+      *list = texts;
+      return num_dests;
+    }
+
+    CUPSLock_m()
+    if(!cups_dests_ || cups_dests_time_ + CUPS_DESTS_TTL < oySeconds())
     {
-        texts[p] = allocateFunc(strlen(dest->name)+1); 
-        sprintf( texts[p], "%s", dest->name );
+      char ** names = NULL;
+      int names_n = 0;
+
+      /* Open access to printer(s) installed on system. */
+      num_dests = cupsGetDests2( oyGetCUPSConnection(), &dests );
+
+      /* Use CUPS to obtain printer name(s) on the default server. */
+      for (p = 0, i = num_dests, dest = dests; i > 0; i--, dest++, p++)
+        oyStringListAddStaticString( &names, &names_n, dest->name,
+                                     oyAllocateFunc_, oyDeAllocateFunc_ );
+
+      /* Free memory that is used by CUPS. */
+      cupsFreeDests (num_dests, dests);
+
+      if(cups_dests_)
+        oyStringListRelease_( &cups_dests_, cups_dests_n_, oyDeAllocateFunc_ );
+      cups_dests_ = names;
+      cups_dests_n_ = names_n;
+      cups_dests_time_ = oySeconds();
     }
 
-    /* Free memory that is used by CUPS. */
-    cupsFreeDests (num_dests, dests);
+    num_dests = cups_dests_n_;
+    len = sizeof(char*) * num_dests;
+    texts = allocateFunc( len + 1 );
+
+    memset( texts, 0, len + 1 );
+
+    for (p = 0; p < num_dests; p++)
+        texts[p] = oyStringCopy_( cups_dests_[p], allocateFunc );
+    CUPSUnLock_m()
 
     /* Return printer name(s) and the number of printers installed on system. */
     *list = texts; 
     return num_dests;
 }
 
+/** @internal
+ *  @brief   obtain the parsed PPD of a printer
+ *
+ *  The PPD is parsed again only if its file path, modification time or
+ *  size changed. A server PPD is requested with its last modification time,
+ *  so unchanged PPDs are not downloaded again.
+ *
+ *  The caller holds cups_cache_lock_ until it is done with the PPD.
+ *
+ *  @param[in]     device_name         the printer
+ *  @param[in]     ppd_dir             a local PPD directory or NULL for cupsd
+ *  @param[out]    location            the PPD file; owned by the cache
+ *  @return                            the PPD; owned by the cache
+ */
+static ppd_file_t * CUPSppdGet_      ( const char        * device_name,
+                                       const char        * ppd_dir,
+                                       const char       ** location )
+{
+  CUPSppd_s * e = NULL;
+  struct stat st;
+  char * path = NULL;
+  int i, downloaded = 0;
+  double stats_start;
+
+  *location = NULL;
+  if(!device_name)
+    return NULL;
+
+  for(i = 0; i < cups_ppds_n_; ++i)
+    if(strcmp( cups_ppds_[i].name, device_name ) == 0)
+    {
+      e = &cups_ppds_[i];
+      break;
+    }
+
+  if(!e)
+  {
+    CUPSppd_s * ppds = oyAllocateFunc_( sizeof(CUPSppd_s) * (cups_ppds_n_ + 1) );
+    if(!ppds)
+      return NULL;
+    if(cups_ppds_n_)
+      memcpy( ppds, cups_ppds_, sizeof(CUPSppd_s) * cups_ppds_n_ );
+    if(cups_ppds_) oyDeAllocateFunc_( cups_ppds_ );
+    cups_ppds_ = ppds;
+    e = &cups_ppds_[cups_ppds_n_++];
+    memset( e, 0, sizeof(CUPSppd_s) );
+    e->name = oyStringCopy_( device_name, oyAllocateFunc_ );
+  }
+
+  if(ppd_dir)
+    oyStringAddPrintf( &path, oyAllocateFunc_, oyDeAllocateFunc_,
+                       "%s/%s.ppd", ppd_dir, device_name );
+  else
+  {
+    char buffer[1024] = {0};
+    time_t modtime = 0;
+    http_status_t status;
+
+    if(e->path && e->downloaded)
+    {
+      snprintf( buffer, sizeof(buffer), "%s", e->path );
+      modtime = e->modtime;
+    }
+    status = cupsGetPPD3( oyGetCUPSConnection(), device_name, &modtime,
+                          buffer, sizeof(buffer) );
+    if(status == CUPS_HTTP_NOT_MODIFIED && e->ppd)
+    {
+      *location = e->path;
+      return e->ppd;
+    }
+    if(status != CUPS_HTTP_OK && status != CUPS_HTTP_NOT_MODIFIED)
+    {
+      CUPS_msg( oyMSG_DBG, (oyStruct_s*)0, _DBG_FORMAT_ "\n"
+                "No PPD obtained for %s", _DBG_ARGS_, device_name );
+      return NULL;
+    }
+    path = oyStringCopy_( buffer, oyAllocateFunc_ );
+    downloaded = 1;
+    e->modtime = modtime;
+  }
+
+  if(!path || stat( path, &st ) != 0)
+  {
+    if(path) oyDeAllocateFunc_( path );
+    return NULL;
+  }
+
+  if(e->ppd && e->path && strcmp( e->path, path ) == 0 &&
+     e->mtime == st.st_mtime && e->size == st.st_size)
+  {
+    oyDeAllocateFunc_( path );
+    *location = e->path;
+    return e->ppd;
+  }
+
+  /* parse the new or changed PPD */
+  if(e->ppd) ppdClose( e->ppd );
+  if(e->path && e->downloaded && strcmp( e->path, path ) != 0)
+    unlink( e->path );
+  if(e->path) oyDeAllocateFunc_( e->path );
+  e->path = path;
+  e->downloaded = downloaded;
+  e->mtime = st.st_mtime;
+  e->size = st.st_size;
+  stats_start = oyStatsStart_m();
+  e->ppd = ppdOpenFile( path );
+  oyStatsEnd_m( oySTATS_DEVICE_PARSE, stats_start, (double)st.st_size );
+
+  *location = e->path;
+  return e->ppd;
+}
+
 int          DeviceAttributes_       ( ppd_file_t        * ppd,
                                        oyOptions_s       * options,
                                        oyConfig_s        * device,
@@ -648,18 +887,15 @@ int            Configs_Modify    ( oyConfigs_s       * devices,
 int          LoadDevice              ( oyConfig_s        * device,
                                        oyConfigs_s       * devices,
                                        ppd_file_t        * ppd_file,
+                                       const char        * ppd_file_location,
                                        const char        * device_name,
                                        oyOptions_s       * options )
 {
           int n, j, error = 0;
-          const char * ppd_file_location = NULL;
           oyConfigs_s * devices_ = oyConfigs_New(0);
           oyConfig_s * tmp = oyConfig_Copy( device, 0 );
           oyConfigs_MoveIn( devices_, &tmp, -1 );
 
-          if(device_name)
-            ppd_file_location = cupsGetPPD2( oyGetCUPSConnection(),device_name);
-
           /* Search for CUPS ICC profiles */
           CUPSgetProfiles( device_name, ppd_file, devices_, options );
 
@@ -699,18 +935,15 @@ int            Configs_FromPattern (
   int texts_n = 0, i,
   error = !s;
   const char   * profile_request = 0;
-  http_t * http = 0;
   oyAlloc_f allocateFunc = malloc;
   static char * num = 0;
-  const char * printer_name = 0;
+  const char * printer_name = 0,
+             * ppd_dir = 0;
   oyOption_s * o;
 
   int rank = oyFilterRegistrationMatch( _api8.registration, registration,
                                         oyOBJECT_CMM_API8_S );
 
-  /* Initialize the CUPS server. */
-  http = oyGetCUPSConnection();
-
   if(!num)
     num = malloc( 80 );
 
@@ -722,6 +955,14 @@ int            Configs_FromPattern (
   }
 
   printer_name = oyOptions_FindString( options, "device_name", 0 );
+  ppd_dir = oyOptions_FindString( options, "ppd_dir", 0 );
+
+  if(oyOptions_FindString( options, "cache", "refresh" ))
+  {
+    CUPSLock_m()
+    CUPSCacheClear_();
+    CUPSUnLock_m()
+  }
 
   if(rank && error <= 0)
   {
@@ -729,7 +970,7 @@ int            Configs_FromPattern (
 
     /** common resolving */
     {
-      texts_n = GetDevices( http, &texts, allocateFunc );
+      texts_n = GetDevices( ppd_dir, &texts, allocateFunc );
 
       /* search for a device_context instead of a device_name */
       o = oyOptions_Find( options, "device_context.PPD.ppd_file_t",
@@ -741,7 +982,8 @@ int            Configs_FromPattern (
         const char * device_name = NULL;
 
         device = oyConfig_FromRegistration( CMM_BASE_REG, 0 );
-        error = LoadDevice( device, devices, ppd_file, device_name, options );
+        error = LoadDevice( device, devices, ppd_file, NULL, device_name,
+                            options );
         oyConfigs_MoveIn( devices, &device, -1 );
       }
       else
@@ -760,13 +1002,15 @@ int            Configs_FromPattern (
            oyOptions_FindString( options, "oyNAME_NAME", 0 ) )
         {
           const char * device_name = texts[i];
-          const char * ppd_file_location = cupsGetPPD2( oyGetCUPSConnection(),
-                                                        device_name );
-          ppd_file_t * ppd_file = ppdOpenFile( ppd_file_location );
-
-          error = LoadDevice( device, devices, ppd_file, device_name, options );
-
-          ppdClose( ppd_file ); ppd_file = 0;
+          const char * ppd_file_location = NULL;
+          ppd_file_t * ppd_file;
+
+          /* owned by the PPD cache */
+          CUPSLock_m()
+          ppd_file = CUPSppdGet_( device_name, ppd_dir, &ppd_file_location );
+          error = LoadDevice( device, devices, ppd_file, ppd_file_location,
+                              device_name, options );
+          CUPSUnLock_m()
         }
 
         /* Build oyNAME_NAME */
@@ -810,7 +1054,9 @@ int            Configs_FromPattern (
   }
 
   clean:
-  oyCloseCUPSConnection(); http=0;
+  if(texts)
+    oyStringListRelease_( &texts, texts_n, free );
+  oyCloseCUPSConnection();
   return error;
 }
 
@@ -1259,7 +1505,7 @@ int CUPSgetProfiles                  ( const char        * device_name,
               /* Create a file for the custom profile in a local directory. */
               /* ex. '/home/bob/.config/color/icc/custom.icc' */
               char * profile_path = 0;
-              STRING_ADD( profile_path, getenv("HOME") );
+              STRING_ADD( profile_path, oyEnvGetString(oyENV_HOME) );
               STRING_ADD( profile_path, "/.config/color/icc/" );
               STRING_ADD( profile_path, profile_name );
 
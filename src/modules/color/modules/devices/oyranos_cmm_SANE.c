@@ -16,7 +16,9 @@
  *
  *  SANE is a scanner interface for unix style systems. See as well <a href="http://www.sane-project.org/">www.sane-project.org/</a> .
  *  @{ */
+#include "oyranos_config_internal.h"
 #include "oyranos_cmm.h"
+#include "oyranos_debug.h"
 #include "oyranos_i18n.h"
 #include "oyObject_s_.h"
 #include "oyCMM_s.h"
@@ -34,6 +36,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
 
 
 #include "SANE_help.c"
@@ -215,6 +220,387 @@ int GetDevices(const SANE_Device *** device_list, int *size)
    return 0;
 }
 
+/* --- enumeration cache --- */
+
+/* sane_get_devices() probes all configured backends, which takes seconds with
+ * network or USB scanners. The copied result is served as is during
+ * "freshness" seconds. An older list is still served, while a worker thread
+ * enumerates again. */
+#define SANE_CACHE_FRESHNESS 30.0
+
+typedef struct {
+   char *name, *vendor, *model, *type;
+} SANEDevice_s;
+
+typedef struct {
+   char *key;                          /* SANE_CONFIG_DIR selects the backends */
+   double time;
+   int n;
+   SANEDevice_s *devices;
+} SANEDevices_s;
+
+typedef struct {
+   char *name;
+   double time;
+   oyOptions_s *options;               /* from ColorInfoFromHandle() */
+} SANEProperties_s;
+
+static SANEDevices_s *sane_devices_ = NULL;
+static SANEProperties_s *sane_properties_ = NULL;
+static int sane_properties_n_ = 0;
+static int sane_refreshing_ = 0;
+/* a caller keeps SANE initialised for its device_context or device_handle;
+ * SANE_SESSION_MODULE - this module called sane_init() and calls sane_exit()
+ *                       on "session" "close"
+ * SANE_SESSION_CALLER - the caller passed its driver_version */
+#define SANE_SESSION_MODULE 1
+#define SANE_SESSION_CALLER 2
+static int sane_session_open_ = 0;
+
+#if defined(HAVE_PTHREAD)
+/* sane_lock_ serialises the SANE library between callers and the worker;
+ * sane_cache_lock_ guards the caches, sane_refreshing_ and sane_session_open_;
+ * take sane_lock_ first, when both are needed */
+static pthread_mutex_t sane_lock_ = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t sane_cache_lock_ = PTHREAD_MUTEX_INITIALIZER;
+static pthread_t sane_refresh_thread_;
+static int sane_refresh_thread_joinable_ = 0;
+static int sane_refresh_atexit_ = 0;
+#define SANELock_m(m)   pthread_mutex_lock( &m );
+#define SANEUnLock_m(m) pthread_mutex_unlock( &m );
+#else
+#define SANELock_m(m)
+#define SANEUnLock_m(m)
+#endif
+
+static int SANESessionGet_(void)
+{
+   int open;
+
+   SANELock_m(sane_cache_lock_)
+   open = sane_session_open_;
+   SANEUnLock_m(sane_cache_lock_)
+
+   return open;
+}
+
+/* a session started by this module stays owned by it */
+static void SANESessionSet_(int open)
+{
+   SANELock_m(sane_cache_lock_)
+   if (!open || open == SANE_SESSION_MODULE || !sane_session_open_)
+      sane_session_open_ = open;
+   SANEUnLock_m(sane_cache_lock_)
+}
+
+/* the caller is done with the handles and contexts of former calls */
+static void SANESessionClose_(void)
+{
+   SANELock_m(sane_lock_)
+   if (SANESessionGet_() == SANE_SESSION_MODULE) {
+      printf(PRFX "sane_exit()\n");
+      sane_exit();
+   }
+   SANESessionSet_(0);
+   SANEUnLock_m(sane_lock_)
+}
+
+static const char *SANECacheKey_(void)
+{
+   const char *key = getenv("SANE_CONFIG_DIR");
+   return key ? key : "";
+}
+
+static void SANEDevicesRelease_(SANEDevices_s **snapshot)
+{
+   SANEDevices_s *s = *snapshot;
+   int i;
+
+   if (!s)
+      return;
+
+   for (i = 0; i < s->n; ++i) {
+      free(s->devices[i].name);
+      free(s->devices[i].vendor);
+      free(s->devices[i].model);
+      free(s->devices[i].type);
+   }
+   free(s->devices);
+   free(s->key);
+   free(s);
+   *snapshot = NULL;
+}
+
+static SANEDevices_s *SANEDevicesNew_(int n, const char *key, double time)
+{
+   SANEDevices_s *s = calloc(1, sizeof(SANEDevices_s));
+
+   if (!s)
+      return NULL;
+
+   s->key = oyStringCopy(key, CMMallocateFunc);
+   s->time = time;
+   s->devices = calloc(n + 1, sizeof(SANEDevice_s));
+   if (!s->devices) {
+      SANEDevicesRelease_(&s);
+      return NULL;
+   }
+   s->n = n;
+
+   return s;
+}
+
+static void SANEDeviceSet_(SANEDevice_s *d, const char *name, const char *vendor,
+                           const char *model, const char *type)
+{
+   d->name = oyStringCopy(name, CMMallocateFunc);
+   d->vendor = oyStringCopy(vendor, CMMallocateFunc);
+   d->model = oyStringCopy(model, CMMallocateFunc);
+   d->type = oyStringCopy(type, CMMallocateFunc);
+}
+
+/* copy the list from GetDevices(); SANE frees it in sane_exit() */
+static SANEDevices_s *SANEDevicesFromList_(const SANE_Device **device_list, int n)
+{
+   SANEDevices_s *s = SANEDevicesNew_(n, SANECacheKey_(), oySeconds());
+   int i;
+
+   for (i = 0; s && i < n; ++i)
+      SANEDeviceSet_(&s->devices[i], device_list[i]->name, device_list[i]->vendor,
+                     device_list[i]->model, device_list[i]->type);
+
+   return s;
+}
+
+static SANEDevices_s *SANEDevicesCopy_(const SANEDevices_s *snapshot)
+{
+   SANEDevices_s *s = SANEDevicesNew_(snapshot->n, snapshot->key, snapshot->time);
+   int i;
+
+   for (i = 0; s && i < snapshot->n; ++i)
+      SANEDeviceSet_(&s->devices[i], snapshot->devices[i].name,
+                     snapshot->devices[i].vendor, snapshot->devices[i].model,
+                     snapshot->devices[i].type);
+
+   return s;
+}
+
+/* take over the snapshot as the new cache content */
+static void SANEDevicesSet_(SANEDevices_s **snapshot)
+{
+   SANELock_m(sane_cache_lock_)
+   SANEDevicesRelease_(&sane_devices_);
+   sane_devices_ = *snapshot;
+   *snapshot = NULL;
+   SANEUnLock_m(sane_cache_lock_)
+}
+
+static void SANECacheClear_(void)
+{
+   int i;
+
+   SANELock_m(sane_cache_lock_)
+   SANEDevicesRelease_(&sane_devices_);
+   for (i = 0; i < sane_properties_n_; ++i) {
+      free(sane_properties_[i].name);
+      oyOptions_Release(&sane_properties_[i].options);
+   }
+   free(sane_properties_);
+   sane_properties_ = NULL;
+   sane_properties_n_ = 0;
+   SANEUnLock_m(sane_cache_lock_)
+}
+
+static void *SANERefreshWork_(void *data)
+{
+   const SANE_Device **device_list = NULL;
+   SANEDevices_s *snapshot = NULL;
+   int driver_version = 0, n = 0;
+
+   SANELock_m(sane_lock_)
+   /* sane_exit() would close the handles of a running session */
+   if (!SANESessionGet_() &&
+       sane_init(&driver_version, NULL) == SANE_STATUS_GOOD) {
+      if (GetDevices(&device_list, &n) == 0)
+         snapshot = SANEDevicesFromList_(device_list, n);
+      sane_exit();
+   }
+   SANEUnLock_m(sane_lock_)
+
+   if (snapshot)
+      SANEDevicesSet_(&snapshot);
+
+   SANELock_m(sane_cache_lock_)
+   sane_refreshing_ = 0;
+   SANEUnLock_m(sane_cache_lock_)
+
+   return data;
+}
+
+#if defined(HAVE_PTHREAD)
+/* runs at exit or when the module is unloaded, as the worker would else
+ * continue in unmapped code; the lock is left before joining, as the
+ * worker takes it on its way out */
+static void SANERefreshJoin_(void)
+{
+   int joinable;
+
+   SANELock_m(sane_cache_lock_)
+   joinable = sane_refresh_thread_joinable_;
+   sane_refresh_thread_joinable_ = 0;
+   SANEUnLock_m(sane_cache_lock_)
+
+   if (joinable)
+      pthread_join(sane_refresh_thread_, NULL);
+}
+#endif
+
+/* @return 0 - a background refresh is started or running */
+static int SANERefreshStart_(void)
+{
+#if defined(HAVE_PTHREAD)
+   int error = 0;
+
+   /* A own thread instead of a oyJob_s: finished jobs wait in the queue of
+    * the application until it calls oyJobResult(). The last worker has
+    * left all locks once sane_refreshing_ is reset and is joined here. */
+   SANELock_m(sane_cache_lock_)
+   if (sane_session_open_)
+      error = 1;
+   else if (!sane_refreshing_) {
+      if (sane_refresh_thread_joinable_)
+         pthread_join(sane_refresh_thread_, NULL);
+      sane_refresh_thread_joinable_ =
+         pthread_create(&sane_refresh_thread_, NULL, SANERefreshWork_, NULL) == 0;
+      if (sane_refresh_thread_joinable_) {
+         sane_refreshing_ = 1;
+         if (!sane_refresh_atexit_)
+            sane_refresh_atexit_ = atexit(SANERefreshJoin_) == 0;
+      } else
+         error = 1;
+   }
+   SANEUnLock_m(sane_cache_lock_)
+
+   return error;
+#else
+   return 1;
+#endif
+}
+
+/** @internal
+ * @brief Get a private copy of the enumeration cache
+ *
+ * A outdated cache is served, while a worker enumerates again. Without cache
+ * the devices are enumerated synchronously. Do not hold sane_lock_.
+ *
+ * @param[in]  freshness   seconds until the cache becomes outdated
+ * @return                 the devices or NULL on error; release with
+ *                         SANEDevicesRelease_()
+ */
+static SANEDevices_s *SANEDevicesCached_(double freshness)
+{
+   SANEDevices_s *snapshot = NULL;
+   int stale = 0;
+
+   SANELock_m(sane_cache_lock_)
+   if (sane_devices_ && strcmp(sane_devices_->key, SANECacheKey_()) == 0) {
+      snapshot = SANEDevicesCopy_(sane_devices_);
+      stale = sane_devices_->time + freshness < oySeconds();
+   }
+   SANEUnLock_m(sane_cache_lock_)
+
+   if (snapshot && stale && SANERefreshStart_() != 0)
+      SANEDevicesRelease_(&snapshot);
+
+   if (!snapshot) {
+      const SANE_Device **device_list = NULL;
+      int driver_version = 0, n = 0;
+
+      SANELock_m(sane_lock_)
+      if (sane_init(&driver_version, NULL) == SANE_STATUS_GOOD) {
+         if (GetDevices(&device_list, &n) == 0)
+            snapshot = SANEDevicesFromList_(device_list, n);
+         if (!SANESessionGet_())
+            sane_exit();
+      }
+      SANEUnLock_m(sane_lock_)
+
+      if (snapshot) {
+         SANEDevices_s *cache = SANEDevicesCopy_(snapshot);
+         SANEDevicesSet_(&cache);
+      }
+   }
+
+   return snapshot;
+}
+
+static const SANEDevice_s *SANEDevicesFind_(const SANEDevices_s *snapshot,
+                                            const char *device_name)
+{
+   int i;
+
+   for (i = 0; snapshot && device_name && i < snapshot->n; ++i)
+      if (snapshot->devices[i].name &&
+          strcmp(snapshot->devices[i].name, device_name) == 0)
+         return &snapshot->devices[i];
+
+   return NULL;
+}
+
+/* "test" matches "test:0" */
+static int SANEBackendMatch_(const char *device_name, const char *backend)
+{
+   size_t len = strlen(backend);
+
+   return device_name && strncmp(device_name, backend, len) == 0 &&
+          device_name[len] == ':';
+}
+
+static oyOptions_s *SANEPropertiesGet_(const char *device_name, double freshness)
+{
+   oyOptions_s *options = NULL;
+   int i;
+
+   SANELock_m(sane_cache_lock_)
+   for (i = 0; i < sane_properties_n_; ++i)
+      if (strcmp(sane_properties_[i].name, device_name) == 0) {
+         if (sane_properties_[i].time + freshness >= oySeconds())
+            options = oyOptions_Copy(sane_properties_[i].options, 0);
+         break;
+      }
+   SANEUnLock_m(sane_cache_lock_)
+
+   return options;
+}
+
+static void SANEPropertiesSet_(const char *device_name, oyOptions_s *options)
+{
+   SANEProperties_s *p = NULL;
+   int i;
+
+   SANELock_m(sane_cache_lock_)
+   for (i = 0; i < sane_properties_n_; ++i)
+      if (strcmp(sane_properties_[i].name, device_name) == 0) {
+         p = &sane_properties_[i];
+         oyOptions_Release(&p->options);
+         break;
+      }
+   if (!p) {
+      SANEProperties_s *list = realloc(sane_properties_,
+                                       sizeof(SANEProperties_s) * (sane_properties_n_ + 1));
+      if (list) {
+         sane_properties_ = list;
+         p = &sane_properties_[sane_properties_n_++];
+         p->name = oyStringCopy(device_name, CMMallocateFunc);
+      }
+   }
+   if (p) {
+      p->time = oySeconds();
+      p->options = oyOptions_Copy(options, 0);
+   }
+   SANEUnLock_m(sane_cache_lock_)
+}
+
 /** Function Configs_FromPattern
  *  @brief   CMM_NICK oyCMMapi8_s scanner devices
  *
@@ -235,9 +621,14 @@ int Configs_FromPattern(const char *registration, oyOptions_s * options, oyConfi
               *version_opt = NULL,
               *name_opt = NULL;
    int i, num_devices, g_error = 0, status, call_sane_exit = 0;
-   const char *device_name = 0, *command_list = 0, *command_properties = 0;
+   const char *device_name = 0, *command_list = 0, *command_properties = 0,
+              *backend = 0;
    const SANE_Device **device_list = NULL;
-   int rank;
+   SANEDevices_s *snapshot = NULL;
+   const SANEDevice_s *cached_device = NULL;
+   oyOptions_s *cached_properties = NULL;
+   double freshness = SANE_CACHE_FRESHNESS;
+   int rank, driver_version = 0, cacheable, locked = 0;
    oyAlloc_f allocateFunc = malloc;
 
    printf(PRFX "Entering %s(). Options:\n%s", __func__, oyOptions_GetText(options, oyNAME_NICK));
@@ -285,9 +676,29 @@ int Configs_FromPattern(const char *registration, oyOptions_s * options, oyConfi
    context_opt = oyOptions_Find(options, "device_context", oyNAME_PATTERN);
    handle_opt = oyOptions_Find(options, "device_handle", oyNAME_PATTERN);
    name_opt = oyOptions_Find(options, "oyNAME_NAME", oyNAME_PATTERN);
+   backend = oyOptions_FindString(options, "backend", 0);
+   oyOptions_FindDouble(options, "freshness", 0, &freshness);
+   if (oyOptions_FindString(options, "cache", "refresh"))
+      SANECacheClear_();
+   if (oyOptions_FindString(options, "session", "close"))
+      SANESessionClose_();
+
+   /* The cache serves calls, which leave no SANE session behind. */
+   cacheable = !context_opt && !handle_opt && freshness > 0 &&
+               oyOptions_FindInt(options, "driver_version", 0, &driver_version) != 0;
+   if (cacheable && command_properties) {
+      snapshot = SANEDevicesCached_(freshness);
+      cached_device = SANEDevicesFind_(snapshot, device_name);
+      cached_properties = SANEPropertiesGet_(device_name, freshness);
+   }
 
-   /*Handle "driver_version" option [IN] */
-   check_driver_version(options, &version_opt, &call_sane_exit);
+   if (!(cacheable && command_list) &&
+       !(cached_device && cached_properties)) {
+      SANELock_m(sane_lock_)
+      locked = 1;
+      /*Handle "driver_version" option [IN] */
+      check_driver_version(options, &version_opt, &call_sane_exit);
+   }
 
    devices = oyConfigs_New(0);
    if (command_list) {
@@ -298,9 +709,20 @@ int Configs_FromPattern(const char *registration, oyOptions_s * options, oyConfi
           !name_opt        /*or the oyNAME_NAME description*/
          )
          num_devices = 1;  /*then we can get away without calling GetDevices()*/
-      else if (GetDevices(&device_list, &num_devices) != 0) {
+      else if (cacheable) {
+         snapshot = SANEDevicesCached_(freshness);
+         if (snapshot)
+            num_devices = snapshot->n;
+         else {
+            num_devices = 0;
+            ++g_error;
+         }
+      } else if (GetDevices(&device_list, &num_devices) != 0) {
          num_devices = 0; /*So that for loop will not run*/
          ++g_error;
+      } else {
+         SANEDevices_s *cache = SANEDevicesFromList_(device_list, num_devices);
+         SANEDevicesSet_(&cache);
       }
 
       for (i = 0; i < num_devices; ++i) {
@@ -311,10 +733,17 @@ int Configs_FromPattern(const char *registration, oyOptions_s * options, oyConfi
          if (device_list) {
             sane_name = device_list[i]->name;
             sane_model = device_list[i]->model;
+         } else if (snapshot) {
+            sane_name = snapshot->devices[i].name;
+            sane_model = snapshot->devices[i].model;
          } else {
             sane_name = device_name;
          }
 
+         /*Handle "backend" option [IN] */
+         if (backend && !SANEBackendMatch_(sane_name, backend))
+            continue;
+
          /*Handle "device_name" option [IN] */
          if (device_name &&                        /*device_name is provided*/
              sane_name &&                          /*and sane_name has been retrieved*/
@@ -391,7 +820,8 @@ int Configs_FromPattern(const char *registration, oyOptions_s * options, oyConfi
    } else if (command_properties) {
       /* "properties" call section */
       const SANE_Device *device_context = NULL;
-      SANE_Device *aux_context = NULL;
+      SANE_Device *aux_context = NULL,
+                  cached_context;
       SANE_Handle device_handle = NULL;
 
       /*Return a full list of scanner H/W &
@@ -407,15 +837,20 @@ int Configs_FromPattern(const char *registration, oyOptions_s * options, oyConfi
       }
 
       /*1a. Get the "device_context"*/
-      if (!context_opt) { /*we'll have to get it ourselves*/
+      if (cached_device) {
+         cached_context.name = cached_device->name;
+         cached_context.vendor = cached_device->vendor;
+         cached_context.model = cached_device->model;
+         cached_context.type = cached_device->type;
+         device_context = &cached_context;
+      } else if (!context_opt) { /*we'll have to get it ourselves*/
          if (GetDevices(&device_list, &num_devices) == 0) {
-            device_context = *device_list;
-            while (device_context) {
-               if(device_name && device_context->name &&
-                  strcmp(device_name,device_context->name) == 0)
+            for (i = 0; i < num_devices; ++i)
+               if (device_list[i]->name &&
+                   strcmp(device_name, device_list[i]->name) == 0) {
+                  device_context = device_list[i];
                   break;
-               device_context++;
-            }
+               }
             if (!device_context) {
                printf(PRFX "device_name does not match any installed device.\n");
                g_error++;
@@ -433,7 +868,12 @@ int Configs_FromPattern(const char *registration, oyOptions_s * options, oyConfi
          DeviceInfoFromContext_(device_context, oyConfig_GetOptions(device,"backend_core"));
 
       /*2a. Get the "device_handle"*/
-      if (!handle_opt) {
+      if (cached_properties) {
+         /*2b. Use the cached color options*/
+         oyOptions_AppendOpts(*oyConfig_GetOptions(device,"backend_core"),
+                              cached_properties);
+         oyConfig_SetRankMap( device, _api8.rank_map );
+      } else if (!handle_opt) {
          status = sane_open( device_name, &device_handle );
          if (status != SANE_STATUS_GOOD) {
             printf(PRFX "Unable to open sane device \"%s\": %s\n", device_name, sane_strstatus(status));
@@ -447,11 +887,21 @@ int Configs_FromPattern(const char *registration, oyOptions_s * options, oyConfi
       }
 
       if (device_handle) {
+         oyOptions_s *color_options = NULL;
+
          /*2b. Use the "device_handle"*/
-         ColorInfoFromHandle(device_handle, oyConfig_GetOptions(device,"backend_core"));
+         ColorInfoFromHandle(device_handle, &color_options);
+         SANEPropertiesSet_(device_name, color_options);
+         oyOptions_AppendOpts(*oyConfig_GetOptions(device,"backend_core"),
+                              color_options);
+         oyOptions_Release(&color_options);
 
          /*3. Set the rank map*/
          oyConfig_SetRankMap( device, _api8.rank_map );
+
+         /* nobody else knows about our own handle */
+         if (!handle_opt)
+            sane_close(device_handle);
       }
       oyConfigs_MoveIn(devices, &device, -1);
 
@@ -472,8 +922,17 @@ int Configs_FromPattern(const char *registration, oyOptions_s * options, oyConfi
    if (call_sane_exit) {
       printf(PRFX "sane_exit()\n");
       sane_exit();
+   } else if (version_opt) {
+      driver_version = 0;
+      oyOptions_FindInt(options, "driver_version", 0, &driver_version);
+      SANESessionSet_(driver_version > 0 ? SANE_SESSION_CALLER :
+                                           SANE_SESSION_MODULE);
    }
+   if (locked)
+      SANEUnLock_m(sane_lock_)
 
+   SANEDevicesRelease_(&snapshot);
+   oyOptions_Release(&cached_properties);
    oyOption_Release(&context_opt);
    oyOption_Release(&handle_opt);
    oyOption_Release(&version_opt);
@@ -498,7 +957,9 @@ int Configs_Modify(oyConfigs_s * devices, oyOptions_s * options)
    oyOption_s *version_opt_dev = NULL;
    oyConfig_s *device = NULL;
    int num_devices, g_error = 0;
-   int call_sane_exit = 0;
+   int call_sane_exit = 0,
+       session = SANE_SESSION_CALLER,
+       driver_version = 0;
    const char *command_list = NULL,
               *command_properties = NULL;
 
@@ -537,12 +998,17 @@ int Configs_Modify(oyConfigs_s * devices, oyOptions_s * options)
    /* Handle "driver_version" option [IN] */
    /* Check the first device to see if a positive driver_version is provided. */
    /* If not, consult the input options */
+   SANELock_m(sane_lock_)
    device = oyConfigs_Get(devices, 0);
    version_opt_dev = oyConfig_Find(device, "driver_version");
    if (version_opt_dev && oyOption_GetValueInt(version_opt_dev, 0) > 0)
       call_sane_exit = 0;
-   else
+   else {
+      if (oyOptions_FindInt(options, "driver_version", 0, &driver_version) != 0 ||
+          driver_version <= 0)
+         session = SANE_SESSION_MODULE;
       check_driver_version(options, &version_opt, &call_sane_exit);
+   }
    oyConfig_Release(&device);
    oyOption_Release(&version_opt_dev);
 
@@ -765,7 +1231,9 @@ int Configs_Modify(oyConfigs_s * devices, oyOptions_s * options)
    if (call_sane_exit) {
       printf(PRFX "sane_exit()\n");
       sane_exit();
-   }
+   } else
+      SANESessionSet_(session);
+   SANEUnLock_m(sane_lock_)
 
    oyOption_Release(&version_opt);
 
@@ -448,7 +448,7 @@ int                Configs_FromPattern (
     else
     {
 #ifdef oyX1
-      const char * tmp = getenv("DISPLAY");
+      const char * tmp = oyEnvGetString(oyENV_DISPLAY);
       if(!tmp)
       {
         _msg(oyMSG_WARN, (oyStruct_s*)options, OY_DBG_FORMAT_ "\n "
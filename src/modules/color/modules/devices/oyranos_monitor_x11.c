@@ -13,6 +13,10 @@
  *  @since    2005/01/31
  */
 
+#include "oyranos_config_internal.h"
+#include "oyranos_core.h"
+#include "oyranos_debug.h"
+
 #ifndef OY_UNUSED
 #if   (__GNUC__*100 + __GNUC_MINOR__) >= 406
 #define OY_UNUSED                      __attribute__ ((unused))
@@ -49,6 +53,9 @@
 #include <locale.h>
 #include <errno.h>
 #include <time.h>
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
 
 /* ---  Helpers  --- */
 
@@ -115,6 +122,507 @@ char* oyX1Monitor_getAtomName_         ( oyMonitor_s         * disp,
                                        const char        * base );
 const char *xrandr_edids[] = {"EDID","EDID_DATA",0};
 
+/* --- display cache --- */
+
+/** @internal
+ *  A cached output or root window property. Negative results are kept
+ *  with data == NULL.
+ */
+typedef struct oyX1Property_s oyX1Property_s;
+struct oyX1Property_s {
+  oyX1Property_s * next;
+  int              output;   /**< 1 - XRandR output, 0 - root window */
+  XID              id;       /**< RROutput or Window */
+  Atom             atom;
+  char           * data;
+  size_t           size;
+};
+
+# if defined(HAVE_XRANDR)
+/** @internal
+ *  XRandR screen resources shared by all oyMonitor_s of one connection.
+ *  Stale resources stay until the last oyMonitor_s let them go.
+ */
+typedef struct oyX1Resources_s oyX1Resources_s;
+struct oyX1Resources_s {
+  oyX1Resources_s    * next;
+  XRRScreenResources * res;
+  int                  refs;
+};
+# endif
+
+/** @internal
+ *  A display connection kept open across oyX1Monitor_newFrom_() calls.
+ *  The root windows are watched for property and XRandR changes, which
+ *  drop the affected cache entries.
+ *
+ *  Xlib connections are not shared between threads. Each thread gets
+ *  its own connections, and only the owner touches the Display and
+ *  props; oyX1DisplayFind_() hides the slots of other threads.
+ *  oyX1DisplaysLock_ guards the slots and the res_* lists, as a
+ *  oyMonitor_s may give its resources back from a other thread.
+ */
+typedef struct {
+  char               * name;
+  Display            * display;
+# if defined(HAVE_PTHREAD)
+  pthread_t            owner;
+# endif
+  int                  rr_event_base;  /**< -1 without XRandR events */
+  oyX1Property_s     * props;
+# if defined(HAVE_XRANDR)
+  oyX1Resources_s    * res_list;
+  oyX1Resources_s    * res_current;    /**< NULL after a screen change */
+# endif
+} oyX1Display_s;
+
+#define oyX1DISPLAY_CACHE_MAX 8
+static oyX1Display_s oyX1Displays_[oyX1DISPLAY_CACHE_MAX];
+
+#if defined(HAVE_PTHREAD)
+static pthread_mutex_t oyX1DisplaysLock_ = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t oyX1DisplaysOnce_ = PTHREAD_ONCE_INIT;
+static pthread_key_t oyX1DisplaysKey_;
+#define oyX1Lock_m()   pthread_mutex_lock( &oyX1DisplaysLock_ );
+#define oyX1UnLock_m() pthread_mutex_unlock( &oyX1DisplaysLock_ );
+#define oyX1IsOwner_m(d) pthread_equal( (d)->owner, pthread_self() )
+#else
+#define oyX1Lock_m()
+#define oyX1UnLock_m()
+#define oyX1IsOwner_m(d) 1
+#endif
+
+/* the slot of display of any thread; the caller holds oyX1DisplaysLock_ */
+static oyX1Display_s * oyX1DisplaySlot_( Display           * display )
+{
+  int i;
+  if(!display)
+    return NULL;
+  for(i = 0; i < oyX1DISPLAY_CACHE_MAX; ++i)
+    if(oyX1Displays_[i].display == display)
+      return &oyX1Displays_[i];
+  return NULL;
+}
+
+/* the slot of display, if the calling thread owns it */
+static oyX1Display_s * oyX1DisplayFind_( Display           * display )
+{
+  oyX1Display_s * d;
+  oyX1Lock_m()
+  d = oyX1DisplaySlot_( display );
+  if(d && !oyX1IsOwner_m( d ))
+    d = NULL;
+  oyX1UnLock_m()
+  return d;
+}
+
+static void  oyX1PropertyDrop_       ( oyX1Display_s     * d,
+                                       int                 output,
+                                       XID                 id,
+                                       Atom                atom )
+{
+  oyX1Property_s ** p = d ? &d->props : NULL;
+  while(p && *p)
+  {
+    oyX1Property_s * e = *p;
+    if(e->output == output && e->id == id && e->atom == atom)
+    {
+      *p = e->next;
+      if(e->data) free( e->data );
+      free( e );
+    } else
+      p = &e->next;
+  }
+}
+
+static void  oyX1PropertiesClear_    ( oyX1Display_s     * d )
+{
+  while(d && d->props)
+  {
+    oyX1Property_s * e = d->props;
+    d->props = e->next;
+    if(e->data) free( e->data );
+    free( e );
+  }
+}
+
+static void  oyX1DisplayInvalidate_  ( oyX1Display_s     * d )
+{
+  if(!d)
+    return;
+
+  oyX1PropertiesClear_( d );
+# if defined(HAVE_XRANDR)
+  /* other threads might give references back */
+  oyX1Lock_m()
+  d->res_current = NULL;
+  {
+    oyX1Resources_s ** r = &d->res_list;
+    while(*r)
+    {
+      oyX1Resources_s * e = *r;
+      if(e->refs <= 0)
+      {
+        *r = e->next;
+        XRRFreeScreenResources( e->res );
+        free( e );
+      } else
+        r = &e->next;
+    }
+  }
+  oyX1UnLock_m()
+# endif
+  if(oy_debug) fprintf( stderr, OY_DBG_FORMAT_ "invalidated %s\n", OY_DBG_ARGS_, noE(d->name) );
+}
+
+/** @internal
+ *  Close a cached connection and free its slot. The caller holds
+ *  oyX1DisplaysLock_.
+ */
+static void  oyX1DisplayClose_       ( oyX1Display_s     * d )
+{
+  if(!d || !d->display)
+    return;
+
+  oyX1PropertiesClear_( d );
+# if defined(HAVE_XRANDR)
+  while(d->res_list)
+  {
+    oyX1Resources_s * e = d->res_list;
+    d->res_list = e->next;
+    /* still referenced ones are freed in oyX1DisplayResourcesRelease_() */
+    if(e->refs <= 0)
+      XRRFreeScreenResources( e->res );
+    free( e );
+  }
+# endif
+  XCloseDisplay( d->display );
+  if(oy_debug) fprintf( stderr, OY_DBG_FORMAT_ "closed display %s\n", OY_DBG_ARGS_, noE(d->name) );
+  free( d->name );
+  memset( d, 0, sizeof(oyX1Display_s) );
+}
+
+/** @internal
+ *  Close all cached connections; runs at exit or when the module is
+ *  unloaded. The thread key goes away too, as its destructor would
+ *  point into unmapped code after dlclose().
+ */
+static void  oyX1DisplaysRelease_    ( void )
+{
+  int i;
+  oyX1Lock_m()
+  for(i = 0; i < oyX1DISPLAY_CACHE_MAX; ++i)
+    oyX1DisplayClose_( &oyX1Displays_[i] );
+#if defined(HAVE_PTHREAD)
+  {
+    static const pthread_once_t once = PTHREAD_ONCE_INIT;
+    pthread_key_delete( oyX1DisplaysKey_ );
+    oyX1DisplaysOnce_ = once;
+  }
+#endif
+  oyX1UnLock_m()
+}
+
+#if defined(HAVE_PTHREAD)
+/** @internal
+ *  Close the connections of a finishing thread and give their slots free.
+ */
+static void  oyX1DisplaysThreadEnd_  ( void              * dummy OY_UNUSED )
+{
+  int i;
+  oyX1Lock_m()
+  for(i = 0; i < oyX1DISPLAY_CACHE_MAX; ++i)
+    if(oyX1Displays_[i].display && oyX1IsOwner_m( &oyX1Displays_[i] ))
+      oyX1DisplayClose_( &oyX1Displays_[i] );
+  oyX1UnLock_m()
+}
+
+static void  oyX1DisplaysInit_       ( void )
+{
+  pthread_key_create( &oyX1DisplaysKey_, oyX1DisplaysThreadEnd_ );
+  atexit( oyX1DisplaysRelease_ );
+}
+#endif
+
+/** @internal
+ *  Read queued events without blocking and drop what they touch.
+ *  Output and crtc changes can alter EDIDs and geometry, so they clear
+ *  all of the display.
+ */
+static void  oyX1DisplayUpdate_      ( oyX1Display_s     * d )
+{
+  int changed = 0;
+
+  if(!d)
+    return;
+
+  while(XPending( d->display ))
+  {
+    XEvent event;
+    XNextEvent( d->display, &event );
+
+    if(event.type == PropertyNotify)
+      oyX1PropertyDrop_( d, 0, event.xproperty.window, event.xproperty.atom );
+# if defined(HAVE_XRANDR)
+    else if(d->rr_event_base >= 0 &&
+            event.type == d->rr_event_base + RRScreenChangeNotify)
+    {
+      XRRUpdateConfiguration( &event );
+      changed = 1;
+    }
+    else if(d->rr_event_base >= 0 &&
+            event.type == d->rr_event_base + RRNotify)
+    {
+      XRRNotifyEvent * ne = (XRRNotifyEvent*) &event;
+      if(ne->subtype == RRNotify_OutputProperty)
+      {
+        XRROutputPropertyNotifyEvent * pe = (XRROutputPropertyNotifyEvent*) &event;
+        oyX1PropertyDrop_( d, 1, pe->output, pe->property );
+      } else
+        changed = 1;
+    }
+# endif
+  }
+
+  if(changed)
+    oyX1DisplayInvalidate_( d );
+}
+
+/** @internal
+ *  Return a cached connection to name or open and register a new one.
+ *  Without a free slot the connection stays uncached and will be
+ *  closed in oyX1Monitor_release_().
+ */
+static Display * oyX1DisplayOpen_    ( const char        * name )
+{
+  Display * display;
+  oyX1Display_s * d = NULL;
+  double stats_start = oyStatsStart_m();
+  int i;
+
+#if defined(HAVE_PTHREAD)
+  pthread_once( &oyX1DisplaysOnce_, oyX1DisplaysInit_ );
+#else
+  {
+    static int init = 0;
+    if(!init)
+    {
+      init = 1;
+      atexit( oyX1DisplaysRelease_ );
+    }
+  }
+#endif
+
+  oyX1Lock_m()
+  for(i = 0; name && i < oyX1DISPLAY_CACHE_MAX; ++i)
+  {
+    oyX1Display_s * c = &oyX1Displays_[i];
+    if(c->display && oyX1IsOwner_m( c ) && strcmp( c->name, name ) == 0)
+    {
+      oyX1UnLock_m()
+      oyX1DisplayUpdate_( c );
+      oyStatsEnd_m( oySTATS_CACHE_HIT, stats_start, i + 1 );
+      return c->display;
+    }
+  }
+  oyX1UnLock_m()
+
+  display = XOpenDisplay( name );
+  if(!display || !name)
+  {
+    oyStatsEnd_m( oySTATS_DEVICE_OPEN, stats_start, 0 );
+    return display;
+  }
+
+  /* take a slot only now, as XOpenDisplay() can block for a while */
+  oyX1Lock_m()
+  for(i = 0; i < oyX1DISPLAY_CACHE_MAX; ++i)
+    if(!oyX1Displays_[i].display)
+    {
+      d = &oyX1Displays_[i];
+      memset( d, 0, sizeof(oyX1Display_s) );
+      d->name = strdup( name );
+      d->display = display;
+# if defined(HAVE_PTHREAD)
+      d->owner = pthread_self();
+# endif
+      d->rr_event_base = -1;
+      break;
+    }
+  oyX1UnLock_m()
+
+  oyStatsEnd_m( oySTATS_DEVICE_OPEN, stats_start, d ? 1 : 0 );
+  if(!d)
+    return display;
+
+#if defined(HAVE_PTHREAD)
+  /* let oyX1DisplaysThreadEnd_() run for this thread */
+  pthread_setspecific( oyX1DisplaysKey_, d );
+#endif
+
+  for(i = 0; i < ScreenCount( display ); ++i)
+    XSelectInput( display, RootWindow( display, i ), PropertyChangeMask );
+# if defined(HAVE_XRANDR)
+  {
+    int event_base = 0, error_base = 0, major = 0, minor = 0;
+    if(XRRQueryExtension( display, &event_base, &error_base ) &&
+       XRRQueryVersion( display, &major, &minor ) &&
+       major*100 + minor >= 102)
+    {
+      d->rr_event_base = event_base;
+      for(i = 0; i < ScreenCount( display ); ++i)
+        XRRSelectInput( display, RootWindow( display, i ),
+                        RRScreenChangeNotifyMask | RRCrtcChangeNotifyMask |
+                        RROutputChangeNotifyMask | RROutputPropertyNotifyMask );
+    }
+  }
+# endif
+
+  if(oy_debug) fprintf( stderr, OY_DBG_FORMAT_ "cached display %s\n", OY_DBG_ARGS_, name );
+
+  return display;
+}
+
+/** @internal
+ *  Look up a property. On a hit *prop receives a copy owned by the
+ *  caller or NULL for a known to be empty property.
+ *
+ *  @return                            1 - hit, 0 - miss
+ */
+static int   oyX1PropertyGet_        ( Display           * display,
+                                       int                 output,
+                                       XID                 id,
+                                       Atom                atom,
+                                       char             ** prop,
+                                       size_t            * prop_size )
+{
+  oyX1Display_s * d = oyX1DisplayFind_( display );
+  oyX1Property_s * e;
+
+  if(!d)
+    return 0;
+
+  for(e = d->props; e; e = e->next)
+    if(e->output == output && e->id == id && e->atom == atom)
+    {
+      *prop = NULL;
+      if(e->data)
+      {
+        oyX1Alloc( *prop, e->size, return 0; )
+        memcpy( *prop, e->data, e->size );
+        *prop_size = e->size;
+      }
+      return 1;
+    }
+
+  return 0;
+}
+
+static void  oyX1PropertySet_        ( Display           * display,
+                                       int                 output,
+                                       XID                 id,
+                                       Atom                atom,
+                                       const unsigned char * data,
+                                       size_t              size )
+{
+  oyX1Display_s * d = oyX1DisplayFind_( display );
+  oyX1Property_s * e = NULL;
+
+  if(!d)
+    return;
+
+  oyX1PropertyDrop_( d, output, id, atom );
+
+  oyX1Alloc( e, sizeof(oyX1Property_s), return; )
+  memset( e, 0, sizeof(oyX1Property_s) );
+  e->output = output;
+  e->id = id;
+  e->atom = atom;
+  if(data && size)
+  {
+    oyX1Alloc( e->data, size, free( e ); return; )
+    memcpy( e->data, data, size );
+    e->size = size;
+  }
+  e->next = d->props;
+  d->props = e;
+}
+
+# if defined(HAVE_XRANDR)
+/** @internal
+ *  Obtain XRandR screen resources. The reference is given back by
+ *  oyX1DisplayResourcesRelease_().
+ */
+static XRRScreenResources * oyX1DisplayResources_ (
+                                       Display           * display,
+                                       Window              w )
+{
+  oyX1Display_s * d = oyX1DisplayFind_( display );
+  oyX1Resources_s * r = NULL;
+  XRRScreenResources * res;
+
+  if(d)
+  {
+    res = NULL;
+    oyX1Lock_m()
+    if(d->res_current)
+    {
+      ++d->res_current->refs;
+      res = d->res_current->res;
+    }
+    oyX1UnLock_m()
+    if(res)
+      return res;
+  }
+
+  res = XRRGetScreenResources( display, w );
+  if(!d || !res)
+    return res;
+
+  oyX1Alloc( r, sizeof(oyX1Resources_s), return res; )
+  r->res = res;
+  r->refs = 1;
+  oyX1Lock_m()
+  r->next = d->res_list;
+  d->res_list = d->res_current = r;
+  oyX1UnLock_m()
+
+  return res;
+}
+
+static void  oyX1DisplayResourcesRelease_ (
+                                       Display           * display,
+                                       XRRScreenResources* res )
+{
+  oyX1Display_s * d;
+  oyX1Resources_s ** r;
+
+  /* a oyMonitor_s can be released in a other thread than its owner */
+  oyX1Lock_m()
+  d = oyX1DisplaySlot_( display );
+  r = d ? &d->res_list : NULL;
+  while(r && *r)
+  {
+    oyX1Resources_s * e = *r;
+    if(e->res == res)
+    {
+      if(--e->refs <= 0 && e != d->res_current)
+      {
+        *r = e->next;
+        free( e );
+      } else
+        res = NULL;
+      break;
+    }
+    r = &e->next;
+  }
+  oyX1UnLock_m()
+
+  if(res)
+    XRRFreeScreenResources( res );
+}
+# endif
+
 
 
 
@@ -146,6 +654,7 @@ char *   oyX1Monitor_getProperty_    ( oyMonitor_s       * disp,
   if(!error)
   {
     display = oyX1Monitor_device_( disp );
+    oyX1DisplayUpdate_( oyX1DisplayFind_( display ) );
 # if defined(HAVE_XRANDR)
     if( oyX1Monitor_infoSource_( disp ) == oyX11INFO_SOURCE_XRANDR )
     {
@@ -158,6 +667,15 @@ char *   oyX1Monitor_getProperty_    ( oyMonitor_s       * disp,
       else
         atom = XInternAtom( display, prop_name, True );
 
+      if(atom &&
+         oyX1PropertyGet_( display, 1, oyX1Monitor_xrrOutput_( disp ), atom,
+                           &prop, prop_size ))
+      {
+        if(prop)
+          nitems_return = *prop_size;
+        if(oy_debug) fprintf( stderr, "cached output atom: %ld prop_name: %s %lu\n",
+                  atom, prop_name, nitems_return );
+      } else
       if(atom)
       {
         error =
@@ -171,6 +689,9 @@ char *   oyX1Monitor_getProperty_    ( oyMonitor_s       * disp,
           fprintf( stderr,"%s nitems_return: %lu, bytes_after_return: %lu %d\n",
                    "found issues", nitems_return, bytes_after_return,
                    error );
+        else
+          oyX1PropertySet_( display, 1, oyX1Monitor_xrrOutput_( disp ), atom,
+                            prop_return, nitems_return );
         if(oy_debug)
           atom_name = XGetAtomName(display, atom);
         if(oy_debug) fprintf( stderr, "root: %d atom: %ld atom_name: %s prop_name: %s %lu %lu\n",
@@ -192,12 +713,21 @@ char *   oyX1Monitor_getProperty_    ( oyMonitor_s       * disp,
         atom = XInternAtom(display, atom_name, True);
       if(atom)
         w = RootWindow( display, oyX1Monitor_deviceScreen_( disp ) );
+      if(w && oyX1PropertyGet_( display, 0, w, atom, &prop, prop_size ))
+      {
+        if(prop)
+          nitems_return = *prop_size;
+      } else
       if(w)
+      {
         /* AnyPropertyType does not work for XCM_ICC_V0_3_TARGET_PROFILE_IN_X_BASE ---vvvvvvvvvv */
         XGetWindowProperty( display, w, atom, 0, INT_MAX, False,
                      AnyPropertyType,
                      &a, &actual_format_return, &nitems_return, 
                      &bytes_after_return, &prop_return );
+        if(bytes_after_return == 0)
+          oyX1PropertySet_( display, 0, w, atom, prop_return, nitems_return );
+      }
       if(bytes_after_return != 0) fprintf( stderr,"%s bytes_after_return: %lu\n",
                                           "found issues",bytes_after_return);
       if(oy_debug) fprintf( stderr, "root: %d atom: %ld atom_name: %s prop_name: %s %lu %lu\n",
@@ -247,6 +777,8 @@ int      oyX1Monitor_setProperty_    ( oyMonitor_s       * disp,
           if(oy_debug) fprintf( stderr,"XRRChangeOutputProperty[%s] = %lu\n", prop_name, prop_size);
           if(prop_size == 0)
           XRRDeleteOutputProperty( display, oyX1Monitor_xrrOutput_( disp ), atom );
+          oyX1PropertyDrop_( oyX1DisplayFind_( display ), 1,
+                             oyX1Monitor_xrrOutput_( disp ), atom );
         }
       }
     }
@@ -266,8 +798,11 @@ int      oyX1Monitor_setProperty_    ( oyMonitor_s       * disp,
         w = RootWindow( display, oyX1Monitor_deviceScreen_( disp ) );
       if(w)
         /* AnyPropertyType does not work for XCM_ICC_V0_3_TARGET_PROFILE_IN_X_BASE ---vvvvvvvvvv */
+      {
         error = XChangeProperty( display, w, atom, XA_CARDINAL,
                        8, PropModeReplace, (unsigned char*)prop, (int)prop_size );
+        oyX1PropertyDrop_( oyX1DisplayFind_( display ), 0, w, atom );
+      }
       if(oy_debug) fprintf( stderr,"XChangeProperty[%s] = %lu\n", atom_name, prop_size);
       if(atom_name)
         free( atom_name );
@@ -287,6 +822,10 @@ int      oyX1GetMonitorEdid          ( oyMonitor_s       * disp,
   char * prop = 0;
   size_t prop_size = 0;
   int error = 0;
+
+  /* reread from the server */
+  if(refresh_edid && disp)
+    oyX1PropertiesClear_( oyX1DisplayFind_( oyX1Monitor_device_( disp ) ) );
  
 #if !defined(IGNORE_EDID)
   prop = oyX1Monitor_getProperty_( disp, "XFree86_DDC_EDID1_RAWDATA",
@@ -937,6 +1476,7 @@ int      oyX1SetupMonitorProfile     ( oyMonitor_s       * disp,
       oyX1Monitor_setCompatibility( disp, profile_name );
 
       XFlush( display );
+      oyX1PropertiesClear_( oyX1DisplayFind_( display ) );
     }
 
     free( text );
@@ -1211,6 +1751,7 @@ int      oyX1UnsetMonitorProfile     ( oyMonitor_s       * disp )
       oyX1Monitor_setCompatibility( disp, NULL );
 
       XFlush( display );
+      oyX1PropertiesClear_( oyX1DisplayFind_( display ) );
 
       free( atom_name );
 
@@ -1512,7 +2053,7 @@ Display *    oyX1OpenDisplay         ( const char        * display_name,
       name = strdup( ":0" );
   }
 
-  display = XOpenDisplay (name);
+  display = oyX1DisplayOpen_( name );
 
   /* switch to Xinerama mode */
   if( !display )
@@ -1520,7 +2061,7 @@ Display *    oyX1OpenDisplay         ( const char        * display_name,
     char *text = oyX1ChangeScreenName_( name, 0 );
     if(!text) return display;
 
-    display = XOpenDisplay( text );
+    display = oyX1DisplayOpen_( text );
 
     if( !display )
     {
@@ -1664,7 +2205,7 @@ oyMonitor_s* oyX1Monitor_newFrom_      ( const char        * display_name,
       {
         /* a havily expensive call */
         if(oy_debug) fprintf( stderr,OY_DBG_FORMAT_ "going to call XRRGetScreenResources()\n", OY_DBG_ARGS_);
-        res = XRRGetScreenResources(display, w);
+        res = oyX1DisplayResources_( display, w );
         if(res)
           n = res->noutput;
         if(oy_debug) fprintf( stderr,OY_DBG_FORMAT_ "end of call XRRGetScreenResources() n = %d\n", OY_DBG_ARGS_, n);
@@ -1743,7 +2284,7 @@ oyMonitor_s* oyX1Monitor_newFrom_      ( const char        * display_name,
       }
 
       if(res)
-      { XRRFreeScreenResources(res); res = 0; }
+      { oyX1DisplayResourcesRelease_( display, res ); res = 0; }
 
       if(oyX1Monitor_infoSource_( disp ) == oyX11INFO_SOURCE_XRANDR)
       {
@@ -1856,9 +2397,22 @@ int          oyX1Monitor_release_      ( oyMonitor_s        ** obj )
     if(s->output_info)
     { XRRFreeOutputInfo( s->output_info ); s->output_info = 0; }
     if(s->res)
-    { XRRFreeScreenResources( s->res ); s->res = 0; }
+    { oyX1DisplayResourcesRelease_( s->display, s->res ); s->res = 0; }
 #  endif
-    XCloseDisplay( s->display );
+    /* cached connections stay open; send pending property changes */
+    {
+      oyX1Display_s * d;
+      int owner = 0;
+      oyX1Lock_m()
+      d = oyX1DisplaySlot_( s->display );
+      if(d)
+        owner = oyX1IsOwner_m( d );
+      oyX1UnLock_m()
+      if(!d)
+        XCloseDisplay( s->display );
+      else if(owner)
+        XFlush( s->display );
+    }
     s->display=0;
   }
 
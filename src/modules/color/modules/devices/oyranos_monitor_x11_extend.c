@@ -199,7 +199,8 @@ oyCMMapi10_s_    oyX1_api10_color_server_active_handler = {
   oyX1InfoGetTextMyHandlerA,             /**< getText */
   (char**)oyX1_texts_color_server_active, /**<texts; list of arguments to getText*/
  
-  oyX1ColorServer_Handle               /**< oyMOptions_Handle_f oyMOptions_Handle */
+  oyX1ColorServer_Handle,              /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                 /**< commands; none */
 };
 
 
@@ -381,7 +382,8 @@ oyCMMapi10_s_    oyX1_api10_clean_profiles_handler = {
   oyX1InfoGetTextMyHandlerC,             /**< getText */
   (char**)oyX1_texts_clean_profiles, /**<texts; list of arguments to getText*/
  
-  oyX1CleanOptions_Handle               /**< oyMOptions_Handle_f oyMOptions_Handle */
+  oyX1CleanOptions_Handle,              /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                  /**< commands; none */
 };
 
 int  oyMoveColorServerProfiles       ( const char        * display_name,
@@ -573,7 +575,8 @@ oyCMMapi10_s_    oyX1_api10_move_color_server_profiles_handler = {
   oyX1InfoGetTextMyHandlerM,             /**< getText */
   (char**)oyX1_texts_move_color_server_profiles, /**<texts; list of arguments to getText*/
  
-  oyX1MoveOptions_Handle               /**< oyMOptions_Handle_f oyMOptions_Handle */
+  oyX1MoveOptions_Handle,              /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                 /**< commands; none */
 };
 
 
@@ -758,7 +761,8 @@ oyCMMapi10_s_    oyX1_api10_send_native_update_event_handler = {
   oyX1InfoGetTextMyHandlerU,             /**< getText */
   (char**)oyX1_texts_send_native_update_event, /**<texts; list of arguments to getText*/
  
-  oyX1UpdateOptions_Handle               /**< oyMOptions_Handle_f oyMOptions_Handle */
+  oyX1UpdateOptions_Handle,              /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                   /**< commands; none */
 };
 
 
@@ -1025,6 +1029,7 @@ oyCMMapi10_s_    oyX1_api10_set_xcm_region_handler = {
   oyX1InfoGetTextMyHandler,             /**< getText */
   (char**)oyX1_texts_set_xcm_region,       /**<texts; list of arguments to getText*/
  
-  oyX1MOptions_Handle                  /**< oyMOptions_Handle_f oyMOptions_Handle */
+  oyX1MOptions_Handle,                 /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                 /**< commands; none */
 };
 
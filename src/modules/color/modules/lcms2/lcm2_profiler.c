@@ -60,58 +60,62 @@ typedef struct {
   cmsHTRANSFORM in2MySpace;
   cmsHTRANSFORM mySpace2Out;
   lcm2Sampler_f sampler;
+  lcm2SamplerBatch_f batch;
   void * sampler_variables;
   int channelsIn;
   int channelsProcess;
   int channelsOut;
 } lcm2Cargo_s;
 
+/* the CLUTs are 3 -> 3 */
+#define lcm2GRID_CHANNELS 3
 
-int  lcm2samplerDouble               ( double              in[],
-                                       double              out[],
+/* collected grid points of one CLUT */
+typedef struct {
+  lcm2Cargo_s * cargo;
+  double * in;
+  double * out;
+  size_t   pos;
+} lcm2Grid_s;
+
+int  lcm2GridCollect16               ( const cmsUInt16Number In[],
+                                       cmsUInt16Number   Out[] OY_UNUSED,
                                        void              * Cargo )
 {
   int i;
-  lcm2Cargo_s * d = (lcm2Cargo_s*) Cargo;
+  lcm2Grid_s * g = (lcm2Grid_s*) Cargo;
+  double * in = &g->in[g->pos++ * lcm2GRID_CHANNELS];
 
-  // color convert from input space to prcess color space
-  if(d->in2MySpace)
-    cmsDoTransform( d->in2MySpace, in, in, 1 );
+  for(i = 0; i < lcm2GRID_CHANNELS; ++i)
+    in[i] = In[i] / 65536.0;
 
-  // custom data processing
-  d->sampler(in,out,d->sampler_variables);
+  return TRUE;
+}
 
-  // converting from process space to output space
-  if(d->mySpace2Out)
-    cmsDoTransform( d->mySpace2Out, out, out, 1 );
+int  lcm2GridCollectFloat            ( const cmsFloat32Number In[],
+                                       cmsFloat32Number  Out[] OY_UNUSED,
+                                       void              * Cargo )
+{
+  int i;
+  lcm2Grid_s * g = (lcm2Grid_s*) Cargo;
+  double * in = &g->in[g->pos++ * lcm2GRID_CHANNELS];
 
-  // clipping
-  for(i = 0; i < d->channelsOut; ++i)
-  {
-    if(out[i] > 1.0)
-      out[i] = 1.0;
-    if(out[i] < 0.0)
-      out[i] = 0.0;
-  }
+  for(i = 0; i < lcm2GRID_CHANNELS; ++i)
+    in[i] = In[i];
 
   return TRUE;
 }
 
-int lcm2sampler16      (const cmsUInt16Number In[],
-                              cmsUInt16Number Out[],
-                        void                * Cargo)
+int  lcm2GridWrite16                 ( const cmsUInt16Number In[] OY_UNUSED,
+                                       cmsUInt16Number   Out[],
+                                       void              * Cargo )
 {
-  int i, v, result = TRUE;
-  double in[max_channels], out[max_channels],
+  int i, v;
+  lcm2Grid_s * g = (lcm2Grid_s*) Cargo;
+  double * out = &g->out[g->pos++ * lcm2GRID_CHANNELS],
          scaler = 65536.0;
-  lcm2Cargo_s * d = (lcm2Cargo_s*) Cargo;
-
-  for(i = 0; i < d->channelsIn; ++i)
-    in[i] = In[i] / scaler;
-
-  result = lcm2samplerDouble( in, out, Cargo );
 
-  for(i = 0; i < d->channelsOut; ++i)
+  for(i = 0; i < g->cargo->channelsOut && i < lcm2GRID_CHANNELS; ++i)
   {
     v = out[i] * scaler;
     // integer clipping
@@ -121,27 +125,62 @@ int lcm2sampler16      (const cmsUInt16Number In[],
       Out[i] = v;
   }
 
-  return result;
+  return TRUE;
 }
 
-
-int  lcm2samplerFloat                ( const cmsFloat32Number In[],
-                                             cmsFloat32Number Out[],
+int  lcm2GridWriteFloat              ( const cmsFloat32Number In[] OY_UNUSED,
+                                       cmsFloat32Number  Out[],
                                        void              * Cargo )
 {
-  int i, result = TRUE;
-  double in[max_channels], out[max_channels];
-  lcm2Cargo_s * d = (lcm2Cargo_s*) Cargo;
+  int i;
+  lcm2Grid_s * g = (lcm2Grid_s*) Cargo;
+  double * out = &g->out[g->pos++ * lcm2GRID_CHANNELS];
 
-  for(i = 0; i < d->channelsIn; ++i)
-    in[i] = In[i];
+  for(i = 0; i < g->cargo->channelsOut && i < lcm2GRID_CHANNELS; ++i)
+    Out[i] = out[i];
 
-  result = lcm2samplerDouble( in, out, Cargo );
+  return TRUE;
+}
 
-  for(i = 0; i < d->channelsOut; ++i)
-    Out[i] = out[i];
+/* evaluate n grid points with one transform call per direction */
+void lcm2GridEvaluate                ( lcm2Cargo_s       * d,
+                                       double            * in,
+                                       double            * out,
+                                       int                 n )
+{
+  int i, j;
 
-  return result;
+  // color convert from input space to prcess color space
+  if(d->in2MySpace)
+    cmsDoTransform( d->in2MySpace, in, in, n );
+
+  // custom data processing
+  if(d->batch)
+    d->batch( in, out, n, d->sampler_variables );
+  else
+    for(j = 0; j < n; ++j)
+    {
+      double i_[max_channels], o_[max_channels];
+      memset( o_, 0, sizeof(o_) );
+      memcpy( i_, &in[j * lcm2GRID_CHANNELS], sizeof(double) * lcm2GRID_CHANNELS );
+      d->sampler( i_, o_, d->sampler_variables );
+      memcpy( &out[j * lcm2GRID_CHANNELS], o_, sizeof(double) * lcm2GRID_CHANNELS );
+    }
+
+  // converting from process space to output space
+  if(d->mySpace2Out)
+    cmsDoTransform( d->mySpace2Out, out, out, n );
+
+  // clipping
+  for(j = 0; j < n; ++j)
+    for(i = 0; i < d->channelsOut && i < lcm2GRID_CHANNELS; ++i)
+    {
+      double * v = &out[j * lcm2GRID_CHANNELS + i];
+      if(*v > 1.0)
+        *v = 1.0;
+      if(*v < 0.0)
+        *v = 0.0;
+    }
 }
 
 /** \addtogroup profiler ICC profiler API
@@ -1047,6 +1086,134 @@ void         lcm2SamplerProofD       ( const double        i[],
   o[2] = (Lab2.b + 128.0) / 257.0;
 }
 
+/** Function  lcm2SamplerProofBatch
+ *  @brief    Lab -> proofing profile -> Lab
+ *
+ *  Same like lcm2SamplerProof(), but converts all colors with one
+ *  cmsDoTransform() call.
+ *
+ *  @param[in]     i                   n input PCS.Lab triples
+ *  @param[out]    o                   n output PCS.Lab triples
+ *  @param[in]     n                   number of colors
+ *  @param[out]    data                see lcm2SamplerProof()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2018/04/12 (Oyranos: 0.9.7)
+ *  @date    2018/04/12
+ */
+void         lcm2SamplerProofBatch   ( const double        i[],
+                                             double        o[],
+                                       int                 n,
+                                       void              * data )
+{
+  cmsCIELab Lab1, Lab2;
+  double d;
+  cmsFloat32Number * i_ = (cmsFloat32Number*) malloc( sizeof(cmsFloat32Number) * 6 * n ),
+                   * o_ = i_ + 3 * n;
+  void ** ptr = (void**)data;
+  int j;
+
+  if(!i_) return;
+
+  for(j = 0; j < n; ++j)
+  {
+    i_[j*3+0] = i[j*3+0] * 100.0;
+    i_[j*3+1] = i[j*3+1] * 257.0 - 128.0;
+    i_[j*3+2] = i[j*3+2] * 257.0 - 128.0;
+  }
+
+  cmsDoTransform( ptr[0], i_, o_, n );
+
+  for(j = 0; j < n; ++j)
+  {
+    Lab1.L = i[j*3+0] * 100.0;
+    Lab1.a = i[j*3+1] * 257.0 - 128.0;
+    Lab1.b = i[j*3+2] * 257.0 - 128.0;
+    Lab2.L = o_[j*3+0]; Lab2.a = o_[j*3+1]; Lab2.b = o_[j*3+2];
+
+    d = cmsDeltaE( &Lab1, &Lab2 );
+    if((fabs(d) > 10) && ptr[1] != NULL)
+    {
+      Lab2.L = 50.0;
+      Lab2.a = Lab2.b = 0.0;
+    }
+
+    o[j*3+0] = Lab2.L/100.0; 
+    o[j*3+1] = (Lab2.a + 128.0) / 257.0;
+    o[j*3+2] = (Lab2.b + 128.0) / 257.0;
+  }
+
+  free( i_ );
+}
+
+/** Function  lcm2SamplerProofDBatch
+ *  @brief    Lab -> proofing profile -> Lab
+ *
+ *  Same like lcm2SamplerProofD(), but converts all colors with one
+ *  cmsDoTransform() call.
+ *
+ *  @param[in]     i                   n input PCS.Lab triples
+ *  @param[out]    o                   n output PCS.Lab triples
+ *  @param[in]     n                   number of colors
+ *  @param[out]    data                see lcm2SamplerProofD()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2018/04/12 (Oyranos: 0.9.7)
+ *  @date    2018/04/12
+ */
+void         lcm2SamplerProofDBatch  ( const double        i[],
+                                             double        o[],
+                                       int                 n,
+                                       void              * data )
+{
+  cmsCIELab Lab1, Lab2;
+  double d;
+  cmsFloat64Number * i_ = (cmsFloat64Number*) malloc( sizeof(cmsFloat64Number) * 6 * n ),
+                   * o_ = i_ + 3 * n;
+  void ** ptr = (void**)data;
+  int j;
+
+  if(!i_) return;
+
+  for(j = 0; j < n; ++j)
+  {
+    i_[j*3+0] = i[j*3+0] * 100.0;
+    i_[j*3+1] = i[j*3+1] * 257.0 - 128.0;
+    i_[j*3+2] = i[j*3+2] * 257.0 - 128.0;
+  }
+
+  cmsDoTransform( ptr[0], i_, o_, n );
+
+  for(j = 0; j < n; ++j)
+  {
+    Lab1.L = i_[j*3+0]; Lab1.a = i_[j*3+1]; Lab1.b = i_[j*3+2];
+    Lab2.L = o_[j*3+0]; Lab2.a = o_[j*3+1]; Lab2.b = o_[j*3+2];
+
+    d = cmsDeltaE( &Lab1, &Lab2 );
+    if((fabs(d) > 10) && ptr[1] != NULL)
+    {
+      Lab2.L = 50.0;
+      Lab2.a = Lab2.b = 0.0;
+    }
+
+    o[j*3+0] = Lab2.L/100.0; 
+    o[j*3+1] = (Lab2.a + 128.0) / 257.0;
+    o[j*3+2] = (Lab2.b + 128.0) / 257.0;
+  }
+
+  free( i_ );
+}
+
+/* batch variants of the above samplers */
+lcm2SamplerBatch_f lcm2SamplerGetBatch ( lcm2Sampler_f     sampler )
+{
+  if(sampler == lcm2SamplerProof)
+    return lcm2SamplerProofBatch;
+  if(sampler == lcm2SamplerProofD)
+    return lcm2SamplerProofDBatch;
+  return NULL;
+}
+
 /** @} */ /* samplers */
 
 /** Function  lcm2CreateProfileLutByFunc
@@ -1116,41 +1283,9 @@ int          lcm2CreateProfileLutByFunc (
   return error;
 }
 
-/** Function  lcm2CreateProfileLutByFuncAndCurves
- *  @brief    Generate a ICC profile LUT
- *
- *  This function takes a series of parameters and functions to create a
- *  ICC profile from. The sampler function operates in a input space and
- *  and creates colors in a output space. These values are filled into the
- *  profile LUT. It is possible to create effect profiles of class abstract
- *  or LUT profiles in any other color space including device links.
- *
- *  For some already available sampler funtions see @ref samplers.
- *
- *  @param[in,out] profile             profile to add LUT table
- *  @param[in]     samplerMySpace      the function to fill the LUT with color
- *  @param[in]     samplerArg          data pointer to samplerMySpace
- *  @param[in]     in_curves           input curves
- *  @param[in]     out_curves          output curves
- *  @param[in]     my_space_profile    operating color space
- *                                     for samplerMySpace(); for wildcards see
- *                                     lcm2OpenProfileFile()
- *  @param[in]     in_space_profile    input color space
- *                                     for samplerMySpace(); for wildcards see
- *                                     lcm2OpenProfileFile()
- *  @param[in]     out_space_profile   output color space
- *                                     for samplerMySpace(); for wildcards see
- *                                     lcm2OpenProfileFile()
- *  @param[in]     grid_size           dimensions of the created LUT; e.g. 33
- *  @param[in]     tag_sig             tag signature for the generated LUT;
- *
- *  @version Oyranos: 0.9.6
- *  @date    2017/05/17
- *  @since   2009/11/04 (Oyranos: 0.1.10)
- */
-int          lcm2CreateProfileLutByFuncAndCurves (
-                                       cmsHPROFILE         profile,
+static int   lcm2CreateProfileLut_   ( cmsHPROFILE         profile,
                                        lcm2Sampler_f       samplerMySpace,
+                                       lcm2SamplerBatch_f  batchMySpace,
                                        void              * samplerArg,
                                        cmsToneCurve      * in_curves[],
                                        cmsToneCurve      * out_curves[],
@@ -1170,7 +1305,10 @@ int          lcm2CreateProfileLutByFuncAndCurves (
               * gmt_pl16 = cmsPipelineAlloc( 0,3,3 );
  
   lcm2Cargo_s cargo;
-  int i;
+  lcm2Grid_s grid16, gridf;
+  double * in = NULL, * out = NULL;
+  size_t points = (size_t)grid_size * grid_size * grid_size;
+  int i, slices_n = 2 * grid_size;
   int error = 0;
   int in_layout, my_layout, out_layout;
   in_layout = my_layout = out_layout = (FLOAT_SH(1)|CHANNELS_SH(3)|BYTES_SH(0));
@@ -1205,31 +1343,44 @@ int          lcm2CreateProfileLutByFuncAndCurves (
   cargo.in2MySpace = tr_In2MySpace;
   cargo.mySpace2Out = tr_MySpace2Out;
   cargo.sampler = samplerMySpace;
+  cargo.batch = batchMySpace;
   cargo.sampler_variables = samplerArg,
   cargo.channelsIn = h_in_space ? cmsChannelsOf( cmsGetColorSpace( h_in_space ) ) : 3;
   cargo.channelsProcess = h_my_space ? cmsChannelsOf( cmsGetColorSpace( h_my_space ) ) : 3;
   cargo.channelsOut = h_out_space ? cmsChannelsOf( cmsGetColorSpace( h_out_space ) ) : 3;
 
-#pragma omp parallel for
-  for(i = 0; i < 2; ++i)
+  gmt_lut16 = cmsStageAllocCLut16bit( 0, grid_size, 3,3,0 );
+  gmt_lut = cmsStageAllocCLutFloat( 0, grid_size, 3,3,0 );
+  in  = (double*) calloc( sizeof(double), points * 2 * lcm2GRID_CHANNELS );
+  out = (double*) calloc( sizeof(double), points * 2 * lcm2GRID_CHANNELS );
+  if(!gmt_lut16 || !gmt_lut || !in || !out)
+  { lcm2msg_p( 300, NULL, "no grid memory"); error = 1; goto lcm2CreateProfileLutByFuncAndCurvesClean; }
+
+  /* collect the grid points of both tables in lcms order */
+  grid16.cargo = gridf.cargo = &cargo;
+  grid16.in  = in;  gridf.in  = in  + points * lcm2GRID_CHANNELS;
+  grid16.out = out; gridf.out = out + points * lcm2GRID_CHANNELS;
+  grid16.pos = gridf.pos = 0;
+  cmsStageSampleCLut16bit( gmt_lut16, lcm2GridCollect16, &grid16, SAMPLER_INSPECT );
+  cmsStageSampleCLutFloat( gmt_lut, lcm2GridCollectFloat, &gridf, SAMPLER_INSPECT );
+
+  /* one slice has grid_size^2 points */
+#pragma omp parallel for schedule(dynamic)
+  for(i = 0; i < slices_n; ++i)
   {
-    if(i)
-    {
-      gmt_lut16 = cmsStageAllocCLut16bit( 0, grid_size, 3,3,0 );
-      cmsStageSampleCLut16bit( gmt_lut16, lcm2sampler16, &cargo, 0 );
-
-    } else
-    {
-      gmt_lut = cmsStageAllocCLutFloat( 0, grid_size, 3,3,0 );
-      cmsStageSampleCLutFloat( gmt_lut, lcm2samplerFloat, &cargo, 0 );
-    }
+    size_t start = (size_t)i * grid_size * grid_size;
+    lcm2GridEvaluate( &cargo, &in[start * lcm2GRID_CHANNELS],
+                      &out[start * lcm2GRID_CHANNELS], grid_size * grid_size );
   }
 
+  grid16.pos = gridf.pos = 0;
+  cmsStageSampleCLut16bit( gmt_lut16, lcm2GridWrite16, &grid16, 0 );
+  cmsStageSampleCLutFloat( gmt_lut, lcm2GridWriteFloat, &gridf, 0 );
 
   /* 16-bit int */
   cmsPipelineInsertStage( gmt_pl16, cmsAT_BEGIN,
                           cmsStageAllocToneCurves( 0, cargo.channelsIn, in_curves ) );
-  cmsPipelineInsertStage( gmt_pl16, cmsAT_END, gmt_lut16 );
+  cmsPipelineInsertStage( gmt_pl16, cmsAT_END, gmt_lut16 ); gmt_lut16 = 0;
   cmsPipelineInsertStage( gmt_pl16, cmsAT_END,
                           cmsStageAllocToneCurves( 0, cargo.channelsOut, out_curves ) );
   cmsWriteTag( profile, (tag_sig!=0)?tag_sig:cmsSigAToB0Tag, gmt_pl16 );
@@ -1238,7 +1389,7 @@ int          lcm2CreateProfileLutByFuncAndCurves (
   /* cmsPipeline owns the cmsStage memory */
   cmsPipelineInsertStage( gmt_pl, cmsAT_BEGIN,
                           cmsStageAllocToneCurves( 0, cargo.channelsIn, in_curves ) );
-  cmsPipelineInsertStage( gmt_pl, cmsAT_END, gmt_lut );
+  cmsPipelineInsertStage( gmt_pl, cmsAT_END, gmt_lut ); gmt_lut = 0;
   cmsPipelineInsertStage( gmt_pl, cmsAT_END,
                           cmsStageAllocToneCurves( 0, cargo.channelsOut, out_curves ) );
   //cmsWriteTag( gmt, cmsSigDToB0Tag, gmt_pl );
@@ -1250,12 +1401,112 @@ lcm2CreateProfileLutByFuncAndCurvesClean:
   if(h_out_space) {cmsCloseProfile( h_out_space );} h_out_space = 0;
   if(tr_In2MySpace) {cmsDeleteTransform( tr_In2MySpace );} tr_In2MySpace = 0;
   if(tr_MySpace2Out) {cmsDeleteTransform( tr_MySpace2Out );} tr_MySpace2Out = 0;
+  if(gmt_lut16) cmsStageFree( gmt_lut16 );
+  if(gmt_lut) cmsStageFree( gmt_lut );
+  lcm2Free_m( in );
+  lcm2Free_m( out );
   if(gmt_pl16) cmsPipelineFree( gmt_pl16 );
   if(gmt_pl) cmsPipelineFree( gmt_pl );
 
   return error;
 }
 
+/** Function  lcm2CreateProfileLutByFuncAndCurves
+ *  @brief    Generate a ICC profile LUT
+ *
+ *  This function takes a series of parameters and functions to create a
+ *  ICC profile from. The sampler function operates in a input space and
+ *  and creates colors in a output space. These values are filled into the
+ *  profile LUT. It is possible to create effect profiles of class abstract
+ *  or LUT profiles in any other color space including device links.
+ *
+ *  For some already available sampler funtions see @ref samplers.
+ *
+ *  The grid is evaluated in slices in parallel. Samplers with a batch
+ *  variant, like lcm2SamplerProof(), are switched to that automatically.
+ *
+ *  @param[in,out] profile             profile to add LUT table
+ *  @param[in]     samplerMySpace      the function to fill the LUT with color
+ *  @param[in]     samplerArg          data pointer to samplerMySpace
+ *  @param[in]     in_curves           input curves
+ *  @param[in]     out_curves          output curves
+ *  @param[in]     my_space_profile    operating color space
+ *                                     for samplerMySpace(); for wildcards see
+ *                                     lcm2OpenProfileFile()
+ *  @param[in]     in_space_profile    input color space
+ *                                     for samplerMySpace(); for wildcards see
+ *                                     lcm2OpenProfileFile()
+ *  @param[in]     out_space_profile   output color space
+ *                                     for samplerMySpace(); for wildcards see
+ *                                     lcm2OpenProfileFile()
+ *  @param[in]     grid_size           dimensions of the created LUT; e.g. 33
+ *  @param[in]     tag_sig             tag signature for the generated LUT;
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/12
+ *  @since   2009/11/04 (Oyranos: 0.1.10)
+ */
+int          lcm2CreateProfileLutByFuncAndCurves (
+                                       cmsHPROFILE         profile,
+                                       lcm2Sampler_f       samplerMySpace,
+                                       void              * samplerArg,
+                                       cmsToneCurve      * in_curves[],
+                                       cmsToneCurve      * out_curves[],
+                                       const char        * in_space_profile,
+                                       const char        * my_space_profile,
+                                       const char        * out_space_profile,
+                                       int                 grid_size,
+                                       cmsTagSignature     tag_sig
+                                     )
+{
+  return lcm2CreateProfileLut_( profile, samplerMySpace,
+                                lcm2SamplerGetBatch( samplerMySpace ),
+                                samplerArg, in_curves, out_curves,
+                                in_space_profile, my_space_profile,
+                                out_space_profile, grid_size, tag_sig );
+}
+
+/** Function  lcm2CreateProfileLutByBatchAndCurves
+ *  @brief    Generate a ICC profile LUT from a batch sampler
+ *
+ *  Same like lcm2CreateProfileLutByFuncAndCurves(), but the sampler
+ *  receives whole grid slices.
+ *
+ *  @param[in,out] profile             profile to add LUT table
+ *  @param[in]     batchMySpace        the function to fill the LUT with color
+ *  @param[in]     samplerArg          data pointer to batchMySpace
+ *  @param[in]     in_curves           input curves
+ *  @param[in]     out_curves          output curves
+ *  @param[in]     in_space_profile    input color space
+ *  @param[in]     my_space_profile    operating color space
+ *  @param[in]     out_space_profile   output color space
+ *  @param[in]     grid_size           dimensions of the created LUT; e.g. 33
+ *  @param[in]     tag_sig             tag signature for the generated LUT;
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/12
+ *  @since   2018/04/12 (Oyranos: 0.9.7)
+ */
+int          lcm2CreateProfileLutByBatchAndCurves (
+                                       cmsHPROFILE         profile,
+                                       lcm2SamplerBatch_f  batchMySpace,
+                                       void              * samplerArg,
+                                       cmsToneCurve      * in_curves[],
+                                       cmsToneCurve      * out_curves[],
+                                       const char        * in_space_profile,
+                                       const char        * my_space_profile,
+                                       const char        * out_space_profile,
+                                       int                 grid_size,
+                                       cmsTagSignature     tag_sig
+                                     )
+{
+  if(!batchMySpace) return 1;
+  return lcm2CreateProfileLut_( profile, NULL, batchMySpace,
+                                samplerArg, in_curves, out_curves,
+                                in_space_profile, my_space_profile,
+                                out_space_profile, grid_size, tag_sig );
+}
+
 /** Function  lcm2CreateAbstractProfile
  *  @brief    Create a effect profile of type abstract in ICC*Lab PCS
  *
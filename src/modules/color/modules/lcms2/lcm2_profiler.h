@@ -37,6 +37,15 @@
 typedef void (*lcm2Sampler_f)        ( const double        i[],
                                              double        o[],
                                        void              * vars);
+/** @brief Manipulation function type for many colors
+ *
+ *  Like lcm2Sampler_f, but i and o contain n colors with three channels
+ *  each. The grid is passed in slices.
+ */
+typedef void (*lcm2SamplerBatch_f)   ( const double        i[],
+                                             double        o[],
+                                       int                 n,
+                                       void              * vars);
 /** @} */ /* profiler */
 
 int          lcm2CreateAbstractProfile (
@@ -138,6 +147,20 @@ int          lcm2CreateProfileLutByFuncAndCurves (
                                        cmsTagSignature     tag_sig
                                      );
 
+int          lcm2CreateProfileLutByBatchAndCurves (
+                                       cmsHPROFILE         profile,
+                                       lcm2SamplerBatch_f  batchMySpace,
+                                       void              * samplerArg,
+                                       cmsToneCurve      * in_curves[],
+                                       cmsToneCurve      * out_curves[],
+                                       const char        * in_space_profile,
+                                       const char        * my_space_profile,
+                                       const char        * out_space_profile,
+                                       int                 grid_size,
+                                       cmsTagSignature     tag_sig
+                                     );
+lcm2SamplerBatch_f lcm2SamplerGetBatch ( lcm2Sampler_f     sampler );
+
 
 /* PCS color space conversions */
 void         lcm2iccLab2CIEXYZ       ( const double      * icc_Lab,
@@ -193,6 +216,14 @@ void         lcm2SamplerProof        ( const double        i[],
 void         lcm2SamplerProofD       ( const double        i[],
                                              double        o[],
                                        void              * data );
+void         lcm2SamplerProofBatch   ( const double        i[],
+                                             double        o[],
+                                       int                 n,
+                                       void              * data );
+void         lcm2SamplerProofDBatch  ( const double        i[],
+                                             double        o[],
+                                       int                 n,
+                                       void              * data );
 
 
 
@@ -71,8 +71,14 @@ void* oyAllocateWrapFunc_       (size_t        size,
                                  oyAlloc_f     allocate_func);
 void  oyDeAllocateFunc_         (void *        data);
 
+#include <ctype.h>                     /* isalnum() */
+#include <limits.h>                    /* INT_MAX */
+#include <locale.h>                    /* localeconv() */
 #include <math.h>
 #include <string.h>                    /* memcpy */
+#if !defined(_WIN32)
+#include <unistd.h>                    /* getpid() */
+#endif
 
 
 /* --- internal definitions --- */
@@ -115,6 +121,7 @@ typedef struct l2cmsProfileWrap_s_ {
   oyPointer    l2cms;                  /**< cmsHPROFILE struct */
   icColorSpaceSignature sig;           /**< ICC profile signature */
   oyProfile_s *dbg_profile;            /**< only for debugging */
+  char       * cache_file;             /**< user cache copy of block */
 } l2cmsProfileWrap_s;
 
 /** @struct  l2cmsTransformWrap_s
@@ -167,7 +174,9 @@ cmsHPROFILE  l2cmsGamutCheckAbstract ( oyProfile_s       * proof,
                                        cmsUInt32Number     flags,
                                        int                 intent,
                                        int                 intent_proof,
-                                       uint32_t            icc_profile_flags );
+                                       uint32_t            icc_profile_flags ,
+                                       int                 grid_size,
+                                       int                 batch );
 oyPointer  l2cmsCMMColorConversion_ToMem_ (
                                        cmsHTRANSFORM     * xform,
                                        oyOptions_s       * opts,
@@ -184,7 +193,9 @@ l2cmsProfileWrap_s * l2cmsAddProofProfile
                                        cmsUInt32Number     flags,
                                        int                 intent,
                                        int                 intent_proof,
-                                       uint32_t            icc_profile_flags );
+                                       uint32_t            icc_profile_flags ,
+                                       int                 grid_size,
+                                       int                 batch );
 oyPointer l2cmsFilterNode_CmmIccContextToMem (
                                        oyFilterNode_s    * node,
                                        size_t            * size,
@@ -304,6 +315,7 @@ static cmsUInt32Number   (*l2cmsStageInputChannels)         (const cmsStage* sta
 static cmsUInt32Number   (*l2cmsStageOutputChannels)        (const cmsStage* stage) = NULL;
 static cmsStage*(*l2cmsStageAllocCLut16bit)(cmsContext ContextID, cmsUInt32Number nGridPoints, cmsUInt32Number inputChan, cmsUInt32Number outputChan, const cmsUInt16Number* Table) = NULL;
 static cmsStage*(*l2cmsStageAllocCLutFloat)(cmsContext ContextID, cmsUInt32Number nGridPoints, cmsUInt32Number inputChan, cmsUInt32Number outputChan, const cmsFloat32Number* Table) = NULL;
+static void (*l2cmsStageFree)(cmsStage* mpe) = NULL;
 static cmsBool (*l2cmsStageSampleCLut16bit)(cmsStage* mpe,    cmsSAMPLER16 Sampler, void* Cargo, cmsUInt32Number dwFlags) = NULL;
 static cmsBool (*l2cmsStageSampleCLutFloat)(cmsStage* mpe, cmsSAMPLERFLOAT Sampler, void* Cargo, cmsUInt32Number dwFlags) = NULL;
 static cmsStage*(*l2cmsStageAllocToneCurves)(cmsContext ContextID, cmsUInt32Number nChannels, cmsToneCurve* const Curves[]) = NULL;
@@ -472,6 +484,7 @@ int                l2cmsCMMInit       ( oyStruct_s        * filter OY_UNUSED )
       LOAD_FUNC( cmsStageOutputChannels, NULL );
       LOAD_FUNC( cmsStageAllocCLut16bit, NULL );
       LOAD_FUNC( cmsStageAllocCLutFloat, NULL );
+      LOAD_FUNC( cmsStageFree, NULL );
       LOAD_FUNC( cmsStageSampleCLut16bit, NULL );
       LOAD_FUNC( cmsStageSampleCLutFloat, NULL );
       LOAD_FUNC( cmsStageAllocToneCurves, NULL );
@@ -592,6 +605,7 @@ int                l2cmsCMMInit       ( oyStruct_s        * filter OY_UNUSED )
 #define cmsStageOutputChannels l2cmsStageOutputChannels
 #define cmsStageAllocCLut16bit l2cmsStageAllocCLut16bit
 #define cmsStageAllocCLutFloat l2cmsStageAllocCLutFloat
+#define cmsStageFree l2cmsStageFree
 #define cmsStageSampleCLut16bit l2cmsStageSampleCLut16bit
 #define cmsStageSampleCLutFloat l2cmsStageSampleCLutFloat
 #define cmsStageAllocToneCurves l2cmsStageAllocToneCurves
@@ -720,6 +734,8 @@ int l2cmsCMMProfileReleaseWrap(oyPointer *p)
 #endif
     CMMProfileRelease_M (s->l2cms);
     oyProfile_Release( &s->dbg_profile );
+    if(s->cache_file)
+      oyFree_m_( s->cache_file );
 
     s->l2cms = 0;
     s->type = 0;
@@ -1104,6 +1120,7 @@ cmsHTRANSFORM  l2cmsCMMConversionContextCreate_ (
   const char * o_txt = 0;
   double adaption_state = 0.0;
   int multi_profiles_n = profiles_n;
+  double stats_start = oyStatsStart_m();
 
   if(!lps || !profiles_n || !oy_pixel_layout_in || !oy_pixel_layout_out)
     return 0;
@@ -1192,7 +1209,8 @@ cmsHTRANSFORM  l2cmsCMMConversionContextCreate_ (
         {
           l2cmsProfileWrap_s * wrap = l2cmsAddProofProfile( 
                                              oyProfiles_Get(simulation,i),flags,
-                                             intent, intent_proof, 0);
+                                             intent, intent_proof, 0,
+                                             l2cmsPROOF_LUT_GRID_RASTER, 1 );
           merge[profiles_n-1 + i] = wrap->l2cms;
         }
 
@@ -1307,6 +1325,7 @@ cmsHTRANSFORM  l2cmsCMMConversionContextCreate_ (
                                   oy_pixel_layout_in, oy_pixel_layout_out, oy );
 
   end:
+  oyStatsEnd_m( oySTATS_TRANSFORM_BUILD, stats_start, profiles_n );
   return xform;
 }
 
@@ -1446,6 +1465,81 @@ oyConnectorImaging_s_ l2cms_cmmIccPlug_connector = {
 };
 oyConnectorImaging_s_* l2cms_cmmIccPlug_connectors[2]={&l2cms_cmmIccPlug_connector,0};
 
+/* proofing abstracts in the user cache; one file per content key */
+static char *      l2cmsProofCacheFileName_( const char      * key )
+{
+  char * cache_path = oyResolveDirFileName_( OS_CACHE_USER_DIR "proofing" ),
+       * file_name = NULL;
+
+  if(cache_path)
+  {
+    oyStringAddPrintf( &file_name, 0,0, "%s" OY_SLASH "%s.icc", cache_path, key );
+    oyFree_m_( cache_path );
+  }
+
+  return file_name;
+}
+
+/* returns a malloced complete ICC profile or NULL */
+static oyPointer   l2cmsProofCacheRead_( const char        * file_name,
+                                       size_t            * size )
+{
+  unsigned char * block = NULL;
+
+  if(!file_name || !oyIsFile_( file_name ))
+    return NULL;
+
+  block = (unsigned char*) oyReadFileToMem_( file_name, size, malloc );
+  if(block &&
+     (*size < 132 || memcmp( &block[36], "acsp", 4 ) != 0 ||
+      (size_t)((block[0] << 24) | (block[1] << 16) | (block[2] << 8) | block[3]) != *size))
+  {
+    l2cms_msg( oyMSG_WARN, 0, OY_DBG_FORMAT_ " ignoring broken cache file: %s",
+               OY_DBG_ARGS_, file_name );
+    free( block ); block = NULL;
+    *size = 0;
+  }
+
+  return block;
+}
+
+/* other processes see either no file or the complete profile */
+static int         l2cmsProofCacheWrite_( const char       * file_name,
+                                       oyPointer           block,
+                                       size_t              size )
+{
+  char * tmp_name = NULL;
+  int error = !file_name || !block || !size;
+
+  if(error)
+    return error;
+
+  oyStringAddPrintf( &tmp_name, 0,0, "%s.tmp-%d", file_name, (int)OY_GETPID() );
+  error = oyWriteMemToFile_( tmp_name, block, size );
+  if(!error && rename( tmp_name, file_name ) != 0)
+    /* a concurrent writer came first on systems without replacing rename */
+    error = !oyIsFile_( file_name );
+  if(oyIsFile_( tmp_name ))
+    remove( tmp_name );
+  oyFree_m_( tmp_name );
+
+  return error;
+}
+
+static cmsHPROFILE l2cmsProofOpen_     ( oyProfile_s       * proof,
+                                       oyPointer           block,
+                                       size_t              size )
+{
+#if LCMS_VERSION < 2060
+  return CMMProfileOpen_M( proof, block, size );
+#else
+  oyProfile_s * proof2 = oyProfile_Copy( proof, NULL );
+  cmsContext tc = l2cmsCreateContext( NULL, proof2 ); /* threading context */
+  l2cmsSetLogErrorHandlerTHR( tc, l2cmsErrorHandlerFunction );
+  return CMMProfileOpen_M( tc, block, size );
+#endif
+}
+
 /** Function l2cmsAddProofProfile
  *  @brief   add a abstract proofing profile to the l2cms profile stack 
  *
@@ -1453,22 +1547,35 @@ oyConnectorImaging_s_* l2cms_cmmIccPlug_connectors[2]={&l2cms_cmmIccPlug_connect
  *  new abstract profile containing the proofing profiles changes. This can be
  *  a proofing color space simulation or out of gamut marking.
  *
- *  @version Oyranos: 0.9.6
- *  @date    2016/05/02
+ *  The key is the proofing profiles content hash together with the intents,
+ *  flags, grid size, sampler and ICC version. So in memory profiles are
+ *  cached the same way as files. Generated profiles are kept in the users
+ *  cache directory under "proofing/" and are shared with later processes.
+ *
+ *  @param         grid_size           grid points per channel, usually
+ *                                     l2cmsPROOF_LUT_GRID_RASTER
+ *  @param         batch               0 - sample each grid point alone;
+ *                                     1 - convert the grid in one batch
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/18
  *  @since   2009/11/05 (Oyranos: 0.1.10)
  */
 l2cmsProfileWrap_s*l2cmsAddProofProfile( oyProfile_s     * proof,
                                        cmsUInt32Number     flags,
                                        int                 intent,
                                        int                 intent_proof,
-                                       uint32_t            icc_profile_flags )
+                                       uint32_t            icc_profile_flags,
+                                       int                 grid_size,
+                                       int                 batch )
 {
   int error = 0;
   cmsHPROFILE * hp = 0;
   oyPointer_s * cmm_ptr = 0;
   l2cmsProfileWrap_s * s = 0;
   char * hash_text = 0,
-       num[12];
+       * cache_key = 0;
+  uint32_t md5[4] = {0,0,0,0};
 
   if(!proof || proof->type_ != oyOBJECT_PROFILE_S)
   {
@@ -1478,26 +1585,30 @@ l2cmsProfileWrap_s*l2cmsAddProofProfile( oyProfile_s     * proof,
     return 0;
   }
 
-  /* build hash text */
+  /* build hash text from the profile content */
+  error = oyProfile_GetMD5( proof, 0, md5 );
+  if(error > 0)
+  {
+    l2cms_msg( oyMSG_WARN, (oyStruct_s*)proof, OY_DBG_FORMAT_
+              "no profile hash %s", OY_DBG_ARGS_,
+              oyProfile_GetText( proof, oyNAME_DESCRIPTION ) );
+    return 0;
+  }
+  error = 0;
+  oyStringAddPrintf( &cache_key, 0,0,
+                     "%08x%08x%08x%08x-i%d-p%d-f%x-g%d%s-v%d-lcms%d",
+                     md5[0], md5[1], md5[2], md5[3], intent, intent_proof,
+                     (unsigned int)flags, grid_size, batch ? "" : "p",
+                     icc_profile_flags & OY_ICC_VERSION_2 ? 2 : 4, LCMS_VERSION );
   STRING_ADD( hash_text, "abstract proofing profile " );
-  STRING_ADD( hash_text, oyObject_GetName( proof->oy_, oyNAME_NICK ) );
-  STRING_ADD( hash_text, " intent:" );
-  sprintf( num, "%d", intent );
-  STRING_ADD( hash_text, num );
-  STRING_ADD( hash_text, " intent_proof:" );
-  sprintf( num, "%d", intent_proof );
-  STRING_ADD( hash_text, num );
-  STRING_ADD( hash_text, " flags|gmtCheck|softPrf:" );
-  sprintf( num, "%d|%d|%d", (int)flags, (flags & cmsFLAGS_GAMUTCHECK)?1:0,
-                                        (flags & cmsFLAGS_SOFTPROOFING)?1:0 );
-  STRING_ADD( hash_text, num );
+  STRING_ADD( hash_text, cache_key );
 
   /* cache look up */
   cmm_ptr = oyPointer_LookUpFromText( hash_text, l2cmsPROFILE );
 
   oyPointer_Set( cmm_ptr, CMM_NICK, 0,0,0,0 );
 
-  /* for empty profile create a new abstract one */
+  /* for empty profile look in the user cache or create a new abstract one */
   if(!oyPointer_GetPointer(cmm_ptr))
   {
     oyPointer_s * oy = cmm_ptr;
@@ -1508,38 +1619,56 @@ l2cmsProfileWrap_s*l2cmsAddProofProfile( oyProfile_s     * proof,
     oyPointer block = 0;
     l2cmsProfileWrap_s * s = calloc(sizeof(l2cmsProfileWrap_s), 1);
 
-    if(oy_debug > 3)
-      fprintf( stderr, OY_DBG_FORMAT_" created: \"%s\"",
-               OY_DBG_ARGS_, hash_text );
-    else
-    l2cms_msg( oyMSG_DBG, (oyStruct_s*)proof,
+    s->cache_file = l2cmsProofCacheFileName_( cache_key );
+    block = l2cmsProofCacheRead_( s->cache_file, &size );
+    if(block)
+    {
+      s->l2cms = l2cmsProofOpen_( proof, block, size );
+      if(s->l2cms)
+        l2cms_msg( oyMSG_DBG, (oyStruct_s*)proof,
+             OY_DBG_FORMAT_" loaded abstract proofing profile: \"%s\"",
+             OY_DBG_ARGS_, s->cache_file );
+      else
+      {
+        free( block ); block = 0;
+        size = 0;
+        oyRemoveFile_( s->cache_file );
+      }
+    }
+
+    if(!block)
+    {
+      if(oy_debug > 3)
+        fprintf( stderr, OY_DBG_FORMAT_" created: \"%s\"",
+                 OY_DBG_ARGS_, hash_text );
+      else
+      l2cms_msg( oyMSG_DBG, (oyStruct_s*)proof,
              OY_DBG_FORMAT_" created abstract proofing profile: \"%s\"",
              OY_DBG_ARGS_, hash_text );
  
-    /* create */
-    hp = l2cmsGamutCheckAbstract( proof, flags, intent, intent_proof, icc_profile_flags );
-    if(hp)
-    {
-      /* save to memory */
-      block = lcm2WriteProfileToMem( hp, &size, malloc );
-      l2cmsCloseProfile( hp ); hp = 0;
+      /* create */
+      hp = l2cmsGamutCheckAbstract( proof, flags, intent, intent_proof, icc_profile_flags,
+                                    grid_size, batch );
+      if(hp)
+      {
+        /* save to memory */
+        block = lcm2WriteProfileToMem( hp, &size, malloc );
+        l2cmsCloseProfile( hp ); hp = 0;
+      }
+
+      /* reopen */
+      s->l2cms = l2cmsProofOpen_( proof, block, size );
+
+      if(s->l2cms && l2cmsProofCacheWrite_( s->cache_file, block, size ))
+        l2cms_msg( oyMSG_DBG, (oyStruct_s*)proof,
+             OY_DBG_FORMAT_" could not write cache file: \"%s\"",
+             OY_DBG_ARGS_, oyNoEmptyString_m_(s->cache_file) );
     }
 
     s->type = type;
     s->size = size;
     s->block = block;
 
-    /* reopen */
-#if LCMS_VERSION < 2060
-    s->l2cms = CMMProfileOpen_M( proof, block, size );
-#else
-    {
-      oyProfile_s * proof2 = oyProfile_Copy( proof, NULL );
-      cmsContext tc = l2cmsCreateContext( NULL, proof2 ); /* threading context */
-      l2cmsSetLogErrorHandlerTHR( tc, l2cmsErrorHandlerFunction );
-      s->l2cms = CMMProfileOpen_M( tc, block, size );
-    }
-#endif
     error = oyPointer_Set( oy, 0,
                           l2cmsPROFILE, s, CMMToString_M(CMMProfileOpen_M),
                           l2cmsCMMProfileReleaseWrap );
@@ -1554,6 +1683,8 @@ l2cmsProfileWrap_s*l2cmsAddProofProfile( oyProfile_s     * proof,
   oyPointer_Release( &cmm_ptr );
   if(hash_text)
     oyFree_m_(hash_text);
+  if(cache_key)
+    oyFree_m_(cache_key);
 
   if(!error)
     return s;
@@ -2803,6 +2934,7 @@ int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
       int array_in_height = oyArray2d_GetHeight(array_in),
           array_out_height = oyArray2d_GetHeight(array_out),
           lines = OY_MIN(array_in_height, array_out_height);
+      double stats_start = oyStatsStart_m();
       if(lines > threads_n * 10)
       {
 #if defined(USE_OPENMP)
@@ -2893,12 +3025,13 @@ int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
         }
     /*l2cms_msg(oyMSG_WARN,(oyStruct_s*)ticket, "%s: %d End width: %d",
             __FILE__,__LINE__, n);*/
+      oyStatsEnd_m( oySTATS_PIXEL_RUN, stats_start, (double)n * lines );
     }
 
     if(array_in_tmp)
       oyDeAllocateFunc_( array_in_tmp );
 
-    if(getenv("OY_DEBUG_WRITE"))
+    if(oyEnvGetString(oyENV_DEBUG_WRITE))
     {
       char * t = 0; oyStringAddPrintf( &t, 0,0,
       "%04d-%s-array_in[%d].ppm", ++oy_debug_write_id,CMM_NICK,oyStruct_GetId((oyStruct_s*)array_in));
@@ -3216,19 +3349,559 @@ int l2cmsGetOptionsUI                ( oyCMMapiFilter_s   * module OY_UNUSED,
 
 /* OY_LCM2_PARSE_CGATS -------------------------- */
 
-/** @brief   TODO: Parse a CGATS text
+/* a token inside the CGATS text; not zero terminated */
+typedef struct {
+  const char * text;
+  int          len;
+  int          new_line;               /**< a line break came before */
+} lcm2CgatsToken_s;
+
+/* growing text buffer for the per patch string columns */
+typedef struct {
+  char       * text;
+  size_t       len;
+  size_t       size;
+} lcm2CgatsText_s;
+
+#define lcm2CGATS_MAX_FIELDS 1024
+
+static const char * lcm2CgatsNext_   ( const char        * p,
+                                       lcm2CgatsToken_s  * t )
+{
+  t->text = NULL;
+  t->len = 0;
+  t->new_line = 0;
+
+  while(*p)
+  {
+    if(*p == '\n' || *p == '\r')
+      t->new_line = 1;
+    else if(*p == '#')
+    {
+      while(*p && *p != '\n' && *p != '\r')
+        ++p;
+      continue;
+    } else if(*p != ' ' && *p != '\t')
+      break;
+    ++p;
+  }
+
+  if(*p == '"' || *p == '\'')
+  {
+    char q = *p++;
+    t->text = p;
+    /* a unterminated quote ends with the line */
+    while(*p && *p != q && *p != '\n' && *p != '\r')
+      ++p;
+    t->len = (int)(p - t->text);
+    if(*p == q)
+      ++p;
+  } else if(*p)
+  {
+    t->text = p;
+    while(*p && *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r')
+      ++p;
+    t->len = (int)(p - t->text);
+  }
+
+  return p;
+}
+
+static int   lcm2CgatsIs_            ( lcm2CgatsToken_s  * t,
+                                       const char        * word )
+{
+  int len = strlen( word );
+  return t->len == len && memcmp( t->text, word, len ) == 0;
+}
+
+/* locale independent number conversion; short numbers are computed
+ * directly, others go through strtod() with the locales decimal point */
+static int   lcm2CgatsNumber_        ( const char        * text,
+                                       int                 len,
+                                       double            * d )
+{
+  static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+    1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+    1e20, 1e21, 1e22 };
+  const char * p = text, * end = text + len;
+  unsigned long long mantissa = 0;
+  int negative = 0, digits = 0, exponent = 0, exp_sign = 1, exp_value = 0,
+      any = 0;
+  char t[64], * endptr = NULL;
+  const char * decimal_point = ".";
+  struct lconv * lc;
+  int i, j, dp_len;
+
+  if(p < end && (*p == '-' || *p == '+')) { negative = *p == '-'; ++p; }
+  while(p < end && *p >= '0' && *p <= '9')
+  {
+    if(mantissa || *p != '0') ++digits;
+    mantissa = mantissa * 10 + (unsigned)(*p - '0');
+    ++p; any = 1;
+    if(digits > 18) goto slow;
+  }
+  if(p < end && *p == '.')
+  {
+    ++p;
+    while(p < end && *p >= '0' && *p <= '9')
+    {
+      if(mantissa || *p != '0') ++digits;
+      mantissa = mantissa * 10 + (unsigned)(*p - '0');
+      --exponent;
+      ++p; any = 1;
+      if(digits > 18) goto slow;
+    }
+  }
+  if(any && p < end && (*p == 'e' || *p == 'E'))
+  {
+    ++p;
+    if(p < end && (*p == '-' || *p == '+'))
+    {
+      if(*p == '-') exp_sign = -1;
+      ++p;
+    }
+    while(p < end && *p >= '0' && *p <= '9')
+    {
+      exp_value = exp_value * 10 + (*p - '0');
+      ++p;
+      if(exp_value > 1000) goto slow;
+    }
+    exponent += exp_sign * exp_value;
+  }
+  if(!any || p != end)
+    return 1;
+
+  if(mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22)
+  {
+    double v = (double) mantissa;
+    if(exponent < 0)
+      v /= pow10[-exponent];
+    else
+      v *= pow10[exponent];
+    *d = negative ? -v : v;
+    return 0;
+  }
+
+slow:
+  lc = localeconv();
+  if(lc && lc->decimal_point && lc->decimal_point[0])
+    decimal_point = lc->decimal_point;
+  dp_len = strlen( decimal_point );
+  for(i = 0, j = 0; i < len && j + dp_len < (int)sizeof(t); ++i)
+  {
+    if(text[i] == '.')
+    {
+      memcpy( &t[j], decimal_point, dp_len );
+      j += dp_len;
+    }
+    else
+      t[j++] = text[i];
+  }
+  if(i < len)
+    return 1;
+  t[j] = '\000';
+  *d = strtod( t, &endptr );
+
+  return !(endptr && endptr != t && *endptr == '\000');
+}
+
+static int   lcm2CgatsTextAdd_       ( lcm2CgatsText_s   * b,
+                                       const char        * text,
+                                       int                 len )
+{
+  if(b->len + len + 2 > b->size)
+  {
+    size_t size = b->size ? b->size * 2 : 4096;
+    char * t;
+    while(size < b->len + len + 2)
+      size *= 2;
+    t = realloc( b->text, size );
+    if(!t)
+      return 1;
+    b->text = t;
+    b->size = size;
+  }
+  if(b->len)
+    b->text[b->len++] = '\n';
+  memcpy( &b->text[b->len], text, len );
+  b->len += len;
+  b->text[b->len] = '\000';
+  return 0;
+}
+
+/* keywords become image tags; skip what does not fit into a registration */
+static int   lcm2CgatsSetTag_        ( oyOptions_s      ** tags,
+                                       const char        * key,
+                                       int                 key_len,
+                                       const char        * value,
+                                       int                 value_len )
+{
+  char reg[128+sizeof("//" OY_TYPE_STD "/cgats/")], * v;
+  int i, error;
+
+  if(key_len <= 0 || key_len > 128)
+    return 1;
+  for(i = 0; i < key_len; ++i)
+    if(!(isalnum( (unsigned char)key[i] ) || key[i] == '_' || key[i] == '-'))
+      return 1;
+
+  sprintf( reg, "//" OY_TYPE_STD "/cgats/%.*s", key_len, key );
+  v = malloc( value_len + 1 );
+  if(!v) return 1;
+  memcpy( v, value, value_len );
+  v[value_len] = '\000';
+  error = oyOptions_SetFromString( tags, reg, v, OY_CREATE_NEW );
+  free( v );
+
+  return error;
+}
+
+/* per patch text like "A1" or "Paper white" */
+static int   lcm2CgatsIsTextField_   ( const char        * name,
+                                       int                 len )
+{
+  int i;
+  if(len == 9 && memcmp( name, "SAMPLE_ID", 9 ) == 0)
+    return 1;
+  for(i = 0; i + 4 <= len; ++i)
+    if(memcmp( &name[i], "NAME", 4 ) == 0 || 
+       (i + 6 <= len && memcmp( &name[i], "STRING", 6 ) == 0))
+      return 1;
+  return 0;
+}
+
+static int   lcm2CgatsHasPrefix_     ( lcm2CgatsToken_s  * t,
+                                       const char        * prefix )
+{
+  int len = strlen( prefix );
+  return t->len > len && memcmp( t->text, prefix, len ) == 0;
+}
+
+/** @brief   Parse a CGATS text
+ *
+ *  The text is read in one pass. Header keywords, the data format and the
+ *  values are taken directly from the text without intermediate strings.
+ *
+ *  The numeric fields of each patch become the channels of one pixel in a
+ *  oyDOUBLE image of NUMBER_OF_SETS x 1 pixels, in the order of
+ *  BEGIN_DATA_FORMAT. The first numeric field group selects the image
+ *  profile: RGB_, CMYK_, XYZ_, LAB_ and GRAY_ map to the assumed profiles,
+ *  other fields to Lab. The remaining fields, e.g. Lab after CMYK or
+ *  SPECTRAL_NM values, are extra channels.
+ *
+ *  The color channels are scaled to the 0.0 - 1.0 range of Oyranos:
+ *  CMYK, GRAY and XYZ divided by 100, Lab L by 100 and a, b as
+ *  (a + 128) / 257. RGB is divided by rgb_scale, else by the value of a
+ *  RGB_SCALE header keyword, else by 100 as CGATS uses percent. Color
+ *  channels of other leading fields and all extra channels keep the
+ *  CGATS units.
+ *
+ *  The image tags contain under "//" OY_TYPE_STD "/cgats/":
+ *  - "sheet_type" - the first token, e.g. "CGATS.17" or "ECI2002"
+ *  - every header keyword with its value, e.g. "ORIGINATOR"
+ *  - "DATA_FORMAT" - all field names space separated
+ *  - "channels" - the field names of the image channels
+ *  - "color_scale" and "color_offset" - the applied scaling per color
+ *    channel as value = (cgats + offset) / scale, e.g. "255 255 255" and
+ *    "0 0 0"; missing for unscaled data
+ *  - SAMPLE_ID, SAMPLE_NAME and other text fields as line separated lists
+ *
+ *  Only the first table of a multi table file is read.
+ *
+ *  @param[in]     cgats               the CGATS text
+ *  @param[in]     rgb_scale           the RGB maximum, e.g. 255;
+ *                                     0 - use RGB_SCALE or 100
+ *  @return                            the patches or NULL
  *
  *  @version Oyranos: 0.9.7
  *  @since   2017/11/26 (Oyranos: 0.9.7)
- *  @date    2017/11/26
+ *  @date    2018/04/20
  */
-oyImage_s* lcm2ParseCGATS          ( const char        * cgats )
+oyImage_s* lcm2ParseCGATS          ( const char        * cgats,
+                                       double              rgb_scale )
 {
   int error = !cgats;
   oyImage_s * spec = NULL;
+  oyOptions_s * tags = NULL;
+  oyProfile_s * prof = NULL;
+  lcm2CgatsToken_s t, fields[lcm2CGATS_MAX_FIELDS];
+  lcm2CgatsText_s * text_columns = NULL;
+  int * column = NULL;                 /* field -> channel or -(text + 1) */
+  int fields_n = 0, channels_n = 0, texts_n = 0,
+      sets_n = 0, sets_declared = 0, in_data = 0, data_done = 0,
+      value_pos = 0, bad_numbers = 0, i;
+  size_t values_size = 0;
+  double * values = NULL, rgb_scale_header = 0.0;
+  const char * p;
+  char * names = NULL;
+
   if(error) return spec;
 
-  /** @todo implement CGATS parsing with cmsCGATS */
+  /* sheet type */
+  p = lcm2CgatsNext_( cgats, &t );
+  if(!t.len)
+    return spec;
+  lcm2CgatsSetTag_( &tags, "sheet_type", 10, t.text, t.len );
+
+  while(!error && !data_done)
+  {
+    p = lcm2CgatsNext_( p, &t );
+    if(!t.len)
+      break;
+
+    if(lcm2CgatsIs_( &t, "BEGIN_DATA_FORMAT" ))
+    {
+      fields_n = 0;
+      while(1)
+      {
+        p = lcm2CgatsNext_( p, &t );
+        if(!t.len || lcm2CgatsIs_( &t, "END_DATA_FORMAT" ))
+          break;
+        if(fields_n < lcm2CGATS_MAX_FIELDS)
+          fields[fields_n++] = t;
+        else
+          error = 1;
+      }
+      if(error)
+        l2cms_msg( oyMSG_WARN, 0, OY_DBG_FORMAT_ "more than %d fields",
+                   OY_DBG_ARGS_, lcm2CGATS_MAX_FIELDS );
+    }
+    else if(lcm2CgatsIs_( &t, "BEGIN_DATA" ))
+    {
+      if(!fields_n)
+      {
+        l2cms_msg( oyMSG_WARN, 0, OY_DBG_FORMAT_ "BEGIN_DATA without DATA_FORMAT",
+                   OY_DBG_ARGS_ );
+        error = 1;
+        break;
+      }
+
+      /* map fields to channels and text columns */
+      column = calloc( fields_n, sizeof(int) );
+      text_columns = calloc( fields_n, sizeof(lcm2CgatsText_s) );
+      if(!column || !text_columns) { error = 1; break; }
+      for(i = 0; i < fields_n; ++i)
+      {
+        if(lcm2CgatsIsTextField_( fields[i].text, fields[i].len ))
+          column[i] = -(++texts_n);
+        else
+          column[i] = channels_n++;
+        STRING_ADD( names, i ? " " : "" );
+        oyStringAddPrintf( &names, 0,0, "%.*s", fields[i].len, fields[i].text );
+      }
+      lcm2CgatsSetTag_( &tags, "DATA_FORMAT", 11, names, strlen(names) );
+      oyFree_m_( names );
+
+      if(!channels_n)
+      {
+        l2cms_msg( oyMSG_WARN, 0, OY_DBG_FORMAT_ "no numeric fields",
+                   OY_DBG_ARGS_ );
+        error = 1;
+        break;
+      }
+
+      /* NUMBER_OF_SETS sizes the buffer, as far as the text can hold it */
+      {
+        size_t rest = strlen( p ) / 2 / fields_n + 1;
+        size_t sets = sets_declared > 0 ? (size_t)sets_declared : 256;
+        values_size = (sets < rest ? sets : rest) * channels_n;
+      }
+      values = malloc( values_size * sizeof(double) );
+      if(!values) { error = 1; break; }
+
+      in_data = 1;
+      while(!error)
+      {
+        int field;
+        double d = 0.0;
+
+        p = lcm2CgatsNext_( p, &t );
+        if(!t.len || lcm2CgatsIs_( &t, "END_DATA" ))
+          break;
+
+        field = value_pos % fields_n;
+        if(field == 0 && (size_t)(sets_n + 1) * channels_n > values_size)
+        {
+          double * v = realloc( values, values_size * 2 * sizeof(double) );
+          if(!v) { error = 1; break; }
+          values = v;
+          values_size *= 2;
+        }
+
+        if(column[field] >= 0)
+        {
+          if(lcm2CgatsNumber_( t.text, t.len, &d ))
+          {
+            if(!bad_numbers++)
+              l2cms_msg( oyMSG_WARN, 0, OY_DBG_FORMAT_
+                         "not a number in set %d field %.*s: \"%.*s\"",
+                         OY_DBG_ARGS_, sets_n + 1,
+                         fields[field].len, fields[field].text, t.len, t.text );
+            d = NAN;
+          }
+          values[(size_t)sets_n * channels_n + column[field]] = d;
+        } else
+          error = lcm2CgatsTextAdd_( &text_columns[-column[field] - 1],
+                                     t.text, t.len );
+
+        ++value_pos;
+        if(value_pos % fields_n == 0)
+          ++sets_n;
+      }
+      if(value_pos % fields_n)
+        l2cms_msg( oyMSG_WARN, 0, OY_DBG_FORMAT_ "incomplete last set %d",
+                   OY_DBG_ARGS_, sets_n + 1 );
+      if(sets_declared && sets_declared != sets_n)
+        l2cms_msg( oyMSG_WARN, 0, OY_DBG_FORMAT_
+                   "NUMBER_OF_SETS %d but %d sets found",
+                   OY_DBG_ARGS_, sets_declared, sets_n );
+      data_done = 1;
+    }
+    else if(lcm2CgatsIs_( &t, "KEYWORD" ))
+      /* declares a custom keyword; the declaration is not kept */
+      p = lcm2CgatsNext_( p, &t );
+    else
+    {
+      /* keyword with the value on the same line */
+      lcm2CgatsToken_s key = t;
+      const char * next = lcm2CgatsNext_( p, &t );
+      if(t.len && !t.new_line)
+      {
+        /* unquoted values run to the line end */
+        if(t.text[-1] != '"' && t.text[-1] != '\'')
+        {
+          next = t.text + t.len;
+          while(*next && *next != '\n' && *next != '\r' && *next != '#')
+            ++next;
+          t.len = (int)(next - t.text);
+          while(t.len && (t.text[t.len-1] == ' ' || t.text[t.len-1] == '\t'))
+            --t.len;
+        }
+        p = next;
+        if(lcm2CgatsIs_( &key, "NUMBER_OF_SETS" ))
+        {
+          double d = 0;
+          if(!lcm2CgatsNumber_( t.text, t.len, &d ) && d > 0 && d < INT_MAX)
+            sets_declared = (int)d;
+        }
+        if(lcm2CgatsIs_( &key, "RGB_SCALE" ))
+        {
+          double d = 0;
+          if(!lcm2CgatsNumber_( t.text, t.len, &d ) && d > 0)
+            rgb_scale_header = d;
+        }
+        lcm2CgatsSetTag_( &tags, key.text, key.len, t.text, t.len );
+      } else
+        lcm2CgatsSetTag_( &tags, key.text, key.len, "", 0 );
+    }
+  }
+
+  if(!error && (!in_data || !sets_n))
+  {
+    l2cms_msg( oyMSG_WARN, 0, OY_DBG_FORMAT_ "no data sets found",
+               OY_DBG_ARGS_ );
+    error = 1;
+  }
+
+  if(!error)
+  {
+    oyPROFILE_e type = oyASSUMED_LAB;
+    int first = 0, color_n = 3, scaled = 1;
+    double rgb_max = rgb_scale > 0 ? rgb_scale :
+                     rgb_scale_header > 0 ? rgb_scale_header : 100.0;
+    char * scales = NULL, * offsets = NULL;
+    while(column[first] < 0)
+      ++first;
+    if(lcm2CgatsHasPrefix_( &fields[first], "RGB_" ))
+    { type = oyASSUMED_RGB; color_n = 3; }
+    else if(lcm2CgatsHasPrefix_( &fields[first], "CMYK_" ))
+    { type = oyASSUMED_CMYK; color_n = 4; }
+    else if(lcm2CgatsHasPrefix_( &fields[first], "XYZ_" ))
+    { type = oyASSUMED_XYZ; color_n = 3; }
+    else if(lcm2CgatsHasPrefix_( &fields[first], "GRAY_" ))
+    { type = oyASSUMED_GRAY; color_n = 1; }
+    else if(!lcm2CgatsHasPrefix_( &fields[first], "LAB_" ))
+      scaled = 0;
+    if(channels_n < color_n)
+    { type = oyASSUMED_GRAY; color_n = 1; }
+
+    /* the color channels to the 0.0 - 1.0 range */
+    for(i = 0; scaled && i < color_n; ++i)
+    {
+      double scale = 100.0, offset = 0.0;
+      int s;
+      if(type == oyASSUMED_RGB)
+        scale = rgb_max;
+      else if(type == oyASSUMED_LAB && i)
+      { scale = 257.0; offset = 128.0; }
+      for(s = 0; s < sets_n; ++s)
+      {
+        double * v = &values[(size_t)s * channels_n + i];
+        *v = (*v + offset) / scale;
+      }
+      oyStringAddPrintf( &scales, 0,0, "%s%g", i ? " " : "", scale );
+      oyStringAddPrintf( &offsets, 0,0, "%s%g", i ? " " : "", offset );
+    }
+    if(scales && offsets)
+    {
+      lcm2CgatsSetTag_( &tags, "color_scale", 11, scales, strlen(scales) );
+      lcm2CgatsSetTag_( &tags, "color_offset", 12, offsets, strlen(offsets) );
+    }
+    if(scales) oyFree_m_( scales );
+    if(offsets) oyFree_m_( offsets );
+
+    prof = oyProfile_FromStd( type, 0, 0 );
+    spec = oyImage_Create( sets_n, 1, NULL,
+                           oyChannels_m(channels_n) | oyDataType_m(oyDOUBLE),
+                           prof, 0 );
+    error = !spec;
+  }
+
+  if(!error)
+  {
+    oyArray2d_s * a = (oyArray2d_s*) oyImage_GetPixelData( spec );
+    uint8_t ** rows = a ? oyArray2d_GetData( a ) : NULL;
+    oyOptions_s * image_tags;
+
+    if(rows && rows[0])
+      memcpy( rows[0], values, (size_t)sets_n * channels_n * sizeof(double) );
+    else
+      error = 1;
+    oyArray2d_Release( &a );
+
+    for(i = 0; i < fields_n; ++i)
+    {
+      if(column[i] >= 0)
+      {
+        STRING_ADD( names, column[i] ? " " : "" );
+        oyStringAddPrintf( &names, 0,0, "%.*s", fields[i].len, fields[i].text );
+      } else if(text_columns[-column[i] - 1].text)
+        lcm2CgatsSetTag_( &tags, fields[i].text, fields[i].len,
+                          text_columns[-column[i] - 1].text,
+                          text_columns[-column[i] - 1].len );
+    }
+    lcm2CgatsSetTag_( &tags, "channels", 8, names, strlen(names) );
+    oyFree_m_( names );
+
+    image_tags = oyImage_GetTags( spec );
+    oyOptions_AppendOpts( image_tags, tags );
+    oyOptions_Release( &image_tags );
+  }
+
+  if(error)
+    oyImage_Release( &spec );
+
+  if(text_columns)
+  {
+    for(i = 0; i < fields_n; ++i)
+      if(text_columns[i].text)
+        free( text_columns[i].text );
+    free( text_columns );
+  }
+  if(column) free( column );
+  if(values) free( values );
+  oyOptions_Release( &tags );
+  oyProfile_Release( &prof );
 
   return spec;
 }
@@ -3241,6 +3914,9 @@ oyImage_s* lcm2ParseCGATS          ( const char        * cgats )
  *
  *  @param[in]     options             expects at least one options
  *                                     - "cgats": The option shall be a string.
+ *                                     - "rgb_scale": RGB maximum, e.g. 255;
+ *                                       overrides the RGB_SCALE keyword;
+ *                                       optional double
  *  @param[in]     command             "//" OY_TYPE_STD "/parse_cgats"
  *  @param[out]    result              will contain a oyImage_s in "colors"
  *
@@ -3248,7 +3924,7 @@ oyImage_s* lcm2ParseCGATS          ( const char        * cgats )
  *
  *  @version Oyranos: 0.9.7
  *  @since   2017/11/26 (Oyranos: 0.9.7)
- *  @date    2017/11/26
+ *  @date    2018/04/20
  */
 int          l2cmsMOptions_Handle5   ( oyOptions_s       * options,
                                        const char        * command,
@@ -3267,14 +3943,16 @@ int          l2cmsMOptions_Handle5   ( oyOptions_s       * options,
     else
       return -1;
   }
-  else if(oyFilterRegistrationMatch(command,"parse_cgats.cgats", 0))
+  else if(oyFilterRegistrationMatch(command,"parse_cgats", 0))
   {
     oyImage_s * spec = NULL;
     const char * cgats = NULL;
+    double rgb_scale = 0.0;
 
     cgats = oyOptions_FindString( options, "cgats", 0 );
+    oyOptions_FindDouble( options, "rgb_scale", 0, &rgb_scale );
 
-    spec = lcm2ParseCGATS( cgats );
+    spec = lcm2ParseCGATS( cgats, rgb_scale );
 
     if(spec)
     {
@@ -3317,7 +3995,7 @@ const char * l2cmsInfoGetTextProfileC5(const char        * select,
     else if(type == oyNAME_NAME)
       return _("Parse CGATS text.");
     else
-      return _("The littleCMS \"parse_cgats\" command lets you parse CGATS files. The filter expects a oyOption_s object with name \"cgats\" containing a string value. The result will appear in \"colors\" as a oyImage_s.");
+      return _("The littleCMS \"parse_cgats\" command lets you parse CGATS files. The filter expects a oyOption_s object with name \"cgats\" containing a string value. The result will appear in \"colors\" as a oyImage_s. The color channels are scaled to 0.0 - 1.0, extra channels keep the CGATS units. RGB values are divided by the optional \"rgb_scale\" double option, by the RGB_SCALE keyword or by 100. The image tags \"color_scale\" and \"color_offset\" tell the applied scaling.");
   } else if(strcmp(select, "help")==0)
   {
          if(type == oyNAME_NICK)
@@ -3331,6 +4009,22 @@ const char * l2cmsInfoGetTextProfileC5(const char        * select,
 }
 const char *l2cms_texts_parse_cgats[4] = {"can_handle","parse_cgats","help",0};
 
+/* declared "parse_cgats" entry; checks the options as the "can_handle"
+ * probe does, which oyOptions_Handle() skips for declared commands */
+static int   l2cmsMOptions_Handle5Command (
+                                       oyOptions_s       * options,
+                                       const char        * command,
+                                       oyOptions_s      ** result )
+{
+  if(!oyOptions_FindString( options, "cgats", 0 ))
+    return 1;
+  return l2cmsMOptions_Handle5( options, command, result );
+}
+oyCMMapi10Command_s l2cms_commands_parse_cgats[2] = {
+  {"parse_cgats", l2cmsMOptions_Handle5Command},
+  {0,0}
+};
+
 /** l2cms_api10_cmm5
  *  @brief   Node for Parsing a CGATS text
  *
@@ -3363,7 +4057,8 @@ oyCMMapi10_s_    l2cms_api10_cmm5 = {
   l2cmsInfoGetTextProfileC5,            /**< getText */
   (char**)l2cms_texts_parse_cgats,      /**<texts; list of arguments to getText*/
  
-  l2cmsMOptions_Handle5                 /**< oyMOptions_Handle_f oyMOptions_Handle */
+  l2cmsMOptions_Handle5,                /**< oyMOptions_Handle_f oyMOptions_Handle */
+  l2cms_commands_parse_cgats            /**< commands; dispatched directly */
 };
 
 /* OY_LCM2_PARSE_CGATS -------------------------- */
@@ -3431,7 +4126,7 @@ oyProfile_s* lcm2AbstractWhitePointBradford (
     if(data && size) oyFree_m_( data );
   }
 
-  if(oy_debug && getenv("OY_DEBUG_WRITE"))
+  if(oy_debug && oyEnvGetString(oyENV_DEBUG_WRITE))
   {
       char * t = 0; oyStringAddPrintf( &t, 0,0,
       "%04d-%s-abstract-wtptB[%d]", ++oy_debug_write_id,CMM_NICK,oyStruct_GetId((oyStruct_s*)prof));
@@ -3579,6 +4274,25 @@ const char * l2cmsInfoGetTextProfile4(const char        * select,
   return 0;
 }
 
+/* declared "create_profile.white_point_adjust.bradford" entry; checks the
+ * options as the "can_handle" probe does */
+static int   l2cmsMOptions_Handle4Command (
+                                       oyOptions_s       * options,
+                                       const char        * command,
+                                       oyOptions_s      ** result )
+{
+  double src_iccXYZ = -1, illu_iccXYZ = -1;
+
+  if(!(oyOptions_FindDouble( options,  "src_iccXYZ", 2,  &src_iccXYZ ) == 0 &&
+       oyOptions_FindDouble( options, "illu_iccXYZ", 2, &illu_iccXYZ ) == 0))
+    return 1;
+  return l2cmsMOptions_Handle4( options, command, result );
+}
+oyCMMapi10Command_s l2cms_commands_white_point_bradford[2] = {
+  {"create_profile.white_point_adjust.bradford", l2cmsMOptions_Handle4Command},
+  {0,0}
+};
+
 /** l2cms_api10_cmm4
  *  @brief   Node for Creating White Point Effect Profiles
  *
@@ -3611,7 +4325,8 @@ oyCMMapi10_s_    l2cms_api10_cmm4 = {
   l2cmsInfoGetTextProfile4,            /**< getText */
   (char**)l2cms_texts_profile_create,  /**<texts; list of arguments to getText*/
  
-  l2cmsMOptions_Handle4                 /**< oyMOptions_Handle_f oyMOptions_Handle */
+  l2cmsMOptions_Handle4,                /**< oyMOptions_Handle_f oyMOptions_Handle */
+  l2cms_commands_white_point_bradford   /**< commands; dispatched directly */
 };
 
 /* OY_LCM2_CREATE_ABSTRACT_WHITE_POINT_BRADFORD_REGISTRATION -------------------------- */
@@ -3668,7 +4383,7 @@ oyProfile_s* lcm2AbstractWhitePoint  ( double              cie_a,
     if(data && size) oyFree_m_( data );
   }
 
-  if(oy_debug && getenv("OY_DEBUG_WRITE"))
+  if(oy_debug && oyEnvGetString(oyENV_DEBUG_WRITE))
   {
       char * t = 0; oyStringAddPrintf( &t, 0,0,
       "%04d-%s-abstract-wtptL[%d]", ++oy_debug_write_id,CMM_NICK,oyStruct_GetId((oyStruct_s*)prof));
@@ -3817,13 +4532,23 @@ oyCMMapi10_s_    l2cms_api10_cmm3 = {
   l2cmsInfoGetTextProfileC3,            /**< getText */
   (char**)l2cms_texts_profile_create,   /**<texts; list of arguments to getText*/
  
-  l2cmsMOptions_Handle3                 /**< oyMOptions_Handle_f oyMOptions_Handle */
+  l2cmsMOptions_Handle3,                /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                  /**< commands; none */
 };
 
 /* OY_LCM2_CREATE_ABSTRACT_WHITE_POINT_LAB_REGISTRATION -------------------------- */
 
 /* OY_LCM2_CREATE_ABSTRACT_PROOFING_REGISTRATION -------------------------- */
 
+/* lcm2SamplerProof() behind a own pointer, which keeps
+ * lcm2CreateProfileLutByFuncAndCurves() on the per grid point path */
+static void  l2cmsSamplerProofPoint_ ( const double        i[],
+                                             double        o[],
+                                       void              * data )
+{
+  lcm2SamplerProof( i, o, data );
+}
+
 /** Function l2cmsGamutCheckAbstract
  *  @brief   convert a proofing profile into a abstract one
  *
@@ -3835,16 +4560,21 @@ oyCMMapi10_s_    l2cms_api10_cmm3 = {
  *  @param         intent              rendering intent
  *  @param         intent_proof        proof rendering intent
  *  @param         icc_profile_flags   profile flags
+ *  @param         grid_size           grid points per channel
+ *  @param         batch               0 - use the per grid point sampler;
+ *                                     1 - use lcm2SamplerProofBatch()
  *
- *  @version Oyranos: 0.1.11
+ *  @version Oyranos: 0.9.7
  *  @since   2009/11/04 (Oyranos: 0.1.10)
- *  @date    2010/08/14
+ *  @date    2018/04/18
  */
 cmsHPROFILE  l2cmsGamutCheckAbstract  ( oyProfile_s       * proof,
                                        cmsUInt32Number     flags,
                                        int                 intent,
                                        int                 intent_proof,
-                                       uint32_t            icc_profile_flags )
+                                       uint32_t            icc_profile_flags,
+                                       int                 grid_size,
+                                       int                 batch )
 {
       int error = 0;
 #if LCMS_VERSION >= 2060
@@ -3874,8 +4604,13 @@ cmsHPROFILE  l2cmsGamutCheckAbstract  ( oyProfile_s       * proof,
       hproof = l2cmsAddProfile( proof );
 #else
       {
-        const char * fn = oyProfile_GetFileName( proof, -1 );
-        hproof = l2cmsOpenProfileFromFileTHR( tc, fn, "r" );
+        /* memory works for file based and in memory only profiles */
+        size_t size = 0;
+        oyPointer block = oyProfile_GetMem( proof, &size, 0, oyAllocateFunc_ );
+        if(block && size)
+          hproof = l2cmsOpenProfileFromMemTHR( tc, block, size );
+        if(block)
+          oyDeAllocateFunc_( block );
       }
 #endif
 
@@ -3916,9 +4651,10 @@ cmsHPROFILE  l2cmsGamutCheckAbstract  ( oyProfile_s       * proof,
         };
         const char * desc = oyProfile_GetText( proof, oyNAME_DESCRIPTION );
         lcm2CreateAbstractProfile (
-                             lcm2SamplerProof, ptr,
+                             batch ? lcm2SamplerProof : l2cmsSamplerProofPoint_,
+                             ptr,
                              "*lab", // CIE*Lab
-                             l2cmsPROOF_LUT_GRID_RASTER,
+                             grid_size,
                              icc_profile_flags & OY_ICC_VERSION_2 ? 2.4 : 4.2,
                              "proofing",
                              NULL,
@@ -3942,7 +4678,7 @@ cmsHPROFILE  l2cmsGamutCheckAbstract  ( oyProfile_s       * proof,
         goto clean;
       }
 
-  if(oy_debug && getenv("OY_DEBUG_WRITE"))
+  if(oy_debug && oyEnvGetString(oyENV_DEBUG_WRITE))
   {
       char * t = 0; oyStringAddPrintf( &t, 0,0,
       "%04d-%s-abstract-proof[%d]", ++oy_debug_write_id,CMM_NICK,oyStruct_GetId((oyStruct_s*)proof));
@@ -3953,6 +4689,9 @@ cmsHPROFILE  l2cmsGamutCheckAbstract  ( oyProfile_s       * proof,
   clean:
       if(hLab) { l2cmsCloseProfile( hLab ); hLab = 0; }
       if(tr) { l2cmsDeleteTransform( tr ); tr = 0; }
+#if LCMS_VERSION >= 2060
+      if(hproof) { l2cmsCloseProfile( hproof ); hproof = 0; }
+#endif
 
   return gmt;
 }
@@ -3964,14 +4703,17 @@ cmsHPROFILE  l2cmsGamutCheckAbstract  ( oyProfile_s       * proof,
  *                                     - "proofing_profile": The option shall be a oyProfile_s.
  *                                     - "icc_profile_flags"  ::OY_ICC_VERSION_2 and ::OY_ICC_VERSION_4 let select version 2 and 4 profiles separately.
  *                                     This option shall be a integer.
+ *                                     - "proofing_grid": grid points per channel, 2-255; default 53; integer
+ *                                     - "proofing_batch": 0 samples each grid point alone, for checking the batch path; default 1; integer
  *  @param[in]     command             "//" OY_TYPE_STD "/create_profile.proofing_profile"
  *  @param[out]    result              will contain a oyProfile_s in "icc_profile.create_profile.proofing_profile"
+ *                                     and the user cache file in "file_name"
  *
  *  This function uses internally l2cmsAddProofProfile().
  *
- *  @version Oyranos: 0.3.0
+ *  @version Oyranos: 0.9.7
  *  @since   2011/02/21 (Oyranos: 0.3.0)
- *  @date    2011/02/21
+ *  @date    2018/04/12
  */
 int          l2cmsMOptions_Handle2    ( oyOptions_s       * options,
                                        const char        * command,
@@ -4011,10 +4753,19 @@ int          l2cmsMOptions_Handle2    ( oyOptions_s       * options,
       int intent = l2cmsIntentFromOptions( options,0 ),
       intent_proof = l2cmsIntentFromOptions( options,1 ),
       flags = l2cmsFlagsFromOptions( options );
+      int32_t grid_size = l2cmsPROOF_LUT_GRID_RASTER,
+              batch = 1;
       oyOption_s * o;
+      l2cmsProfileWrap_s * wrap;
+
+      oyOptions_FindInt( options, "proofing_grid", 0, &grid_size );
+      if(grid_size < 2 || grid_size > 255)
+        grid_size = l2cmsPROOF_LUT_GRID_RASTER;
+      oyOptions_FindInt( options, "proofing_batch", 0, &batch );
 
-      l2cmsProfileWrap_s * wrap = l2cmsAddProofProfile( p, flags | cmsFLAGS_SOFTPROOFING,
-                                            intent, intent_proof, icc_profile_flags );
+      wrap = l2cmsAddProofProfile( p, flags | cmsFLAGS_SOFTPROOFING,
+                                   intent, intent_proof, icc_profile_flags,
+                                   grid_size, batch != 0 );
       oyProfile_Release( &p );
 
       prof = oyProfile_FromMem( wrap->size, wrap->block, 0, 0 );
@@ -4025,6 +4776,9 @@ int          l2cmsMOptions_Handle2    ( oyOptions_s       * options,
       if(!*result)
         *result = oyOptions_New(0);
       oyOptions_MoveIn( *result, &o, -1 );
+      if(wrap->cache_file)
+        oyOptions_SetFromString( result, OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH "file_name.create_profile.proofing_effect._" CMM_NICK,
+                                 wrap->cache_file, OY_CREATE_NEW );
     } else
         l2cms_msg( oyMSG_WARN, (oyStruct_s*)options, OY_DBG_FORMAT_ " "
                  "no option \"proofing_effect\" of type oyProfile_s found",
@@ -4059,7 +4813,7 @@ const char * l2cmsInfoGetTextProfileC2(const char        * select,
     else if(type == oyNAME_NAME)
       return _("Create a ICC abstract proofing profile.");
     else
-      return _("The littleCMS \"create_profile.proofing_effect\" command lets you create ICC abstract profiles from a given ICC profile for proofing. The filter expects a oyOption_s object with name \"proofing_profile\" containing a oyProfile_s as value. The options \"rendering_intent\", \"rendering_intent_proof\", \"rendering_bpc\", \"rendering_gamut_warning\", \"precalculation\", \"precalculation_curves\", \"cmyk_cmyk_black_preservation\", \"adaption_state\"  and \"no_white_on_white_fixup\" are honoured. The result will appear in \"icc_profile\" with the additional attributes \"create_profile.proofing_effect\" as a oyProfile_s object.");
+      return _("The littleCMS \"create_profile.proofing_effect\" command lets you create ICC abstract profiles from a given ICC profile for proofing. The filter expects a oyOption_s object with name \"proofing_profile\" containing a oyProfile_s as value. The options \"rendering_intent\", \"rendering_intent_proof\", \"rendering_bpc\", \"rendering_gamut_warning\", \"precalculation\", \"precalculation_curves\", \"cmyk_cmyk_black_preservation\", \"adaption_state\"  and \"no_white_on_white_fixup\" are honoured. The integer options \"proofing_grid\" set the grid points per channel and \"proofing_batch\" = 0 samples each grid point alone. The result will appear in \"icc_profile\" with the additional attributes \"create_profile.proofing_effect\" as a oyProfile_s object.");
   } else if(strcmp(select, "help")==0)
   {
          if(type == oyNAME_NICK)
@@ -4107,7 +4861,8 @@ oyCMMapi10_s_    l2cms_api10_cmm2 = {
   l2cmsInfoGetTextProfileC2,            /**< getText */
   (char**)l2cms_texts_profile_create,   /**<texts; list of arguments to getText*/
  
-  l2cmsMOptions_Handle2                 /**< oyMOptions_Handle_f oyMOptions_Handle */
+  l2cmsMOptions_Handle2,                /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                  /**< commands; none */
 };
 
 /* OY_LCM2_CREATE_ABSTRACT_PROOFING_REGISTRATION -------------------------- */
@@ -4323,7 +5078,8 @@ oyCMMapi10_s_    l2cms_api10_cmm = {
   l2cmsInfoGetTextProfileC,             /**< getText */
   (char**)l2cms_texts_profile_create,   /**<texts; list of arguments to getText*/
  
-  l2cmsMOptions_Handle                  /**< oyMOptions_Handle_f oyMOptions_Handle */
+  l2cmsMOptions_Handle,                 /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                  /**< commands; none */
 };
 
 /* OY_LCM2_CREATE_MATRIX_REGISTRATION ------------------------------------- */
@@ -921,7 +921,9 @@ oyDbAPI_s elDBopeniccDbAPI = {
 
   /* setString */ elDBSetString,
   /* searchEmptyKeyname */ elDBSearchEmptyKeyname,
-  /* eraseKey */ elDBEraseKey
+  /* eraseKey */ elDBEraseKey,
+  /* transactionBegin */ NULL,
+  /* transactionCommit */ NULL
 };
 
 /**
@@ -1021,7 +1023,8 @@ oyCMMapi10_s_    elDB_api10_cmm = {
   elDBInfoGetTextDBC,             /**< getText */
   (char**)elDB_texts_profile_create,   /**<texts; list of arguments to getText*/
  
-  elDBMOptions_Handle                  /**< oyMOptions_Handle_f oyMOptions_Handle */
+  elDBMOptions_Handle,                 /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                 /**< commands; none */
 };
 
 
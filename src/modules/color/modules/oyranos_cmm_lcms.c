@@ -1207,7 +1207,7 @@ cmsHPROFILE  lcmsGamutCheckAbstract  ( oyProfile_s       * proof,
       lcmsAddTag( gmt, icSigMediaWhitePointTag, lcmsD50_XYZ() );
       lcmsAddTag( gmt, icSigAToB0Tag, gmt_lut );
 
-  if(oy_debug && getenv("OY_DEBUG_WRITE"))
+  if(oy_debug && oyEnvGetString(oyENV_DEBUG_WRITE))
   {
       l_cmsSaveProfileToMem( gmt, 0, &size );
       data = oyAllocateFunc_( size );
@@ -2565,7 +2565,8 @@ oyCMMapi10_s_  lcms_api10_cmm2 = {
   lcmsInfoGetTextProfileC2,            /**< getText */
   (char**)lcms_texts_profile_create,   /**<texts; list of arguments to getText*/
  
-  lcmsMOptions_Handle2                 /**< oyMOptions_Handle_f oyMOptions_Handle */
+  lcmsMOptions_Handle2,                /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                 /**< commands; none */
 };
 
 /**
@@ -2636,7 +2637,8 @@ oyCMMapi10_s_  lcms_api10_cmm = {
   lcmsInfoGetTextProfileC,             /**< getText */
   (char**)lcms_texts_profile_create,   /**<texts; list of arguments to getText*/
  
-  lcmsMOptions_Handle                  /**< oyMOptions_Handle_f oyMOptions_Handle */
+  lcmsMOptions_Handle,                 /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                 /**< commands; none */
 };
 
 
@@ -46,6 +46,13 @@
 #include <libraw/libraw.h>
 #include <libraw/libraw_types.h>
 
+#if defined(HAVE_JPEG)
+#include <csetjmp>   /* libjpeg specific error handling */
+extern "C" {
+#include <jpeglib.h>
+}
+#endif
+
 /* --- internal definitions --- */
 
 #define CMM_NICK "lraw"
@@ -315,6 +322,174 @@ extern "C" {
 int              oyArray2d_ToPPM_    ( oyArray2d_s       * array,
                                        const char        * file_name ); }
 
+/* preview modes of the "preview" node option */
+#define LRAW_PREVIEW_NONE      0       /* full size demosaic */
+#define LRAW_PREVIEW_THUMBNAIL 1       /* embedded thumbnail, if a bitmap */
+#define LRAW_PREVIEW_HALF_SIZE 2       /* demosaic 2x2 blocks into one pixel */
+
+#if defined(HAVE_JPEG)
+typedef struct lraw_jpeg_error_mgr {
+  struct jpeg_error_mgr pub;
+  jmp_buf setjmp_buffer;
+} * lraw_jpeg_error_ptr;
+
+static void lrawJpegErrorExit_       ( j_common_ptr        cinfo )
+{
+  lraw_jpeg_error_ptr err = (lraw_jpeg_error_ptr) cinfo->err;
+  (*cinfo->err->output_message) (cinfo);
+  longjmp( err->setjmp_buffer, 1 );
+}
+
+/* decode a JPEG thumbnail from memory into 8 bit samples */
+static int lrawThumbnailJpeg_        ( const libraw_thumbnail_t & thumb,
+                                       uint8_t          ** buf,
+                                       int               * width,
+                                       int               * height,
+                                       int               * spp,
+                                       int               * byteps )
+{
+  struct jpeg_decompress_struct cinfo;
+  struct lraw_jpeg_error_mgr jerr;
+  /* survives the longjmp() */
+  uint8_t * volatile data = NULL;
+  size_t stride;
+
+  if(!thumb.thumb || !thumb.tlength)
+    return 1;
+
+  cinfo.err = jpeg_std_error( &jerr.pub );
+  jerr.pub.error_exit = lrawJpegErrorExit_;
+  if(setjmp( jerr.setjmp_buffer ))
+  {
+    jpeg_destroy_decompress( &cinfo );
+    if(data) oyDeAllocateFunc_( data );
+    return 1;
+  }
+
+  jpeg_create_decompress( &cinfo );
+  jpeg_mem_src( &cinfo, (unsigned char*) thumb.thumb, thumb.tlength );
+  jpeg_read_header( &cinfo, TRUE );
+  /* CMYK previews are rare and fall back to the half size decode */
+  if(cinfo.num_components != 1 && cinfo.num_components != 3)
+  {
+    jpeg_destroy_decompress( &cinfo );
+    return 1;
+  }
+  cinfo.out_color_space = cinfo.num_components == 1 ? JCS_GRAYSCALE : JCS_RGB;
+  jpeg_start_decompress( &cinfo );
+
+  stride = (size_t)cinfo.output_width * cinfo.output_components;
+  data = (uint8_t*) oyAllocateFunc_( stride * cinfo.output_height );
+  if(!data)
+  {
+    jpeg_destroy_decompress( &cinfo );
+    return 1;
+  }
+  while(cinfo.output_scanline < cinfo.output_height)
+  {
+    JSAMPROW row = &data[stride * cinfo.output_scanline];
+    jpeg_read_scanlines( &cinfo, &row, 1 );
+  }
+
+  *width = cinfo.output_width;
+  *height = cinfo.output_height;
+  *spp = cinfo.output_components;
+  *byteps = 1;
+  *buf = data;
+
+  jpeg_finish_decompress( &cinfo );
+  jpeg_destroy_decompress( &cinfo );
+
+  return 0;
+}
+#endif
+
+/* decode a embedded thumbnail; JPEG ones need libjpeg */
+static int lrawThumbnail_            ( LibRaw            & rip,
+                                       uint8_t          ** buf,
+                                       int               * width,
+                                       int               * height,
+                                       int               * spp,
+                                       int               * byteps )
+{
+  libraw_processed_image_t * thumb;
+  int error = rip.unpack_thumb();
+
+  if(error)
+    return 1;
+
+#if defined(HAVE_JPEG)
+  if(rip.imgdata.thumbnail.tformat == LIBRAW_THUMBNAIL_JPEG)
+    return lrawThumbnailJpeg_( rip.imgdata.thumbnail, buf, width, height,
+                               spp, byteps );
+#endif
+  if(rip.imgdata.thumbnail.tformat != LIBRAW_THUMBNAIL_BITMAP)
+    return 1;
+
+  thumb = rip.dcraw_make_mem_thumb( &error );
+  if(!thumb || thumb->type != LIBRAW_IMAGE_BITMAP ||
+     thumb->colors < 1 || thumb->colors > 3)
+  {
+    LibRaw::dcraw_clear_mem( thumb );
+    return 1;
+  }
+
+  *width = thumb->width;
+  *height = thumb->height;
+  *spp = thumb->colors;
+  *byteps = thumb->bits == 16 ? 2 : 1;
+  oyAllocHelper_m_( *buf, uint8_t, thumb->data_size, 0, LibRaw::dcraw_clear_mem( thumb ); return 1 );
+  memcpy( *buf, thumb->data, thumb->data_size );
+  LibRaw::dcraw_clear_mem( thumb );
+
+  return 0;
+}
+
+/* box filter by a integer factor in place, until the longest side fits */
+static void lrawDownscale_           ( uint8_t           * buf,
+                                       int               * width,
+                                       int               * height,
+                                       int                 spp,
+                                       int                 byteps,
+                                       int                 size )
+{
+  int f = 1, w, h, x, y, i, j, c;
+  int longest = *width > *height ? *width : *height;
+  uint16_t * b16 = (uint16_t*) buf;
+
+  while(longest / f > size)
+    ++f;
+  if(f == 1)
+    return;
+
+  w = *width / f;
+  h = *height / f;
+  if(!w) w = 1;
+  if(!h) h = 1;
+
+  /* each target pixel lies in front of the source pixels still to be read */
+  for(y = 0; y < h; ++y)
+    for(x = 0; x < w; ++x)
+      for(c = 0; c < spp; ++c)
+      {
+        double sum = 0;
+        for(j = 0; j < f; ++j)
+          for(i = 0; i < f; ++i)
+          {
+            size_t pos = ((size_t)(y * f + j) * *width + x * f + i) * spp + c;
+            sum += byteps == 2 ? b16[pos] : buf[pos];
+          }
+        sum = sum / (f * f) + 0.5;
+        if(byteps == 2)
+          b16[((size_t)y * w + x) * spp + c] = (uint16_t) sum;
+        else
+          buf[((size_t)y * w + x) * spp + c] = (uint8_t) sum;
+      }
+
+  *width = w;
+  *height = h;
+}
+
 /** Function lrawFilterPlug_ImageInputRAWRun
  *  @brief   implement oyCMMFilter_GetNext_f()
  *
@@ -337,10 +512,11 @@ int      lrawFilterPlug_ImageInputRAWRun (
   oyPixel_t pixel_type = 0;
   uint8_t * buf = 0;
   size_t  mem_n = 0;   /* needed memory in bytes */
+  int32_t preview = LRAW_PREVIEW_NONE,
+          preview_size = 0;
 
   int info_good = 1;
 
-  int type = 0;        /* PNM type */
   int width = 0;
   int height = 0;
   int spp = 0;         /* samples per pixel */
@@ -350,7 +526,6 @@ int      lrawFilterPlug_ImageInputRAWRun (
   oyOptions_s * options = 0;
 
   LibRaw rip;
-  libraw_processed_image_t * image_rgb = 0;
 
   libraw_output_params_t * params = rip.output_params_ptr();
 
@@ -367,7 +542,6 @@ int      lrawFilterPlug_ImageInputRAWRun (
           params->output_color, params->output_bps, params->no_auto_bright,
           params->gamm[0], params->gamm[1]);
 
-  /* render at half size */
   params->half_size = 0;
   params->four_color_rgb = 0;
 
@@ -389,6 +563,8 @@ int      lrawFilterPlug_ImageInputRAWRun (
     {
       oyOptions_s * opts = oyFilterNode_GetOptions( node, 0 );
       filename = oyOptions_FindString( opts, "filename", 0 );
+      oyOptions_FindInt( opts, "preview", 0, &preview );
+      oyOptions_FindInt( opts, "preview_size", 0, &preview_size );
       oyOptions_Release( &opts );
     }
 
@@ -403,46 +579,65 @@ int      lrawFilterPlug_ImageInputRAWRun (
     return 1;
   }
 
-  double clck = oyClock();
-  error = rip.unpack();
-  clck = oyClock() - clck;
-  DBG_NUM1_S("rip.unpack(): %g", clck/1000000.0 );
-
-  params->output_color = 0;    /* raw_color */
-  params->output_bps = 16;     /* linear space */
-  params->gamm[0] = 1.0; params->gamm[1] = 1.0;
-  params->user_qual = 3;
-  params->use_camera_wb = 1;
-  params->no_auto_bright = 1;
-
   oyOptions_s * node_options = oyFilterNode_GetOptions( node, 0 );
   int render = oyOptions_FindString( node_options, "render", "0" ) == NULL ? 1 : 0;
   int32_t icc_profile_flags = 0;
   oyOptions_FindInt( node_options, "icc_profile_flags", 0, &icc_profile_flags );
+  double clck;
+  int thumbnail = 0;
 
-  if(render)
+  if(render && preview == LRAW_PREVIEW_THUMBNAIL)
   {
     clck = oyClock();
-    error = rip.dcraw_process();
+    if(lrawThumbnail_( rip, &buf, &width, &height, &spp, &byteps ) == 0)
+    {
+      if(byteps == 2)
+        data_type = oyUINT16;
+      thumbnail = 1;
+      render = 0;
+    } else
+      preview = LRAW_PREVIEW_HALF_SIZE;
     clck = oyClock() - clck;
-    DBG_NUM1_S("rip.dcraw_process(): %g", clck/1000000.0 );
+    DBG_NUM1_S("rip.unpack_thumb(): %g", clck/1000000.0 );
   }
 
+  /* a downscale target of at most half the sensor size needs no full demosaic */
+  if(!thumbnail && preview_size > 0 &&
+     OY_MAX( rip.imgdata.sizes.width, rip.imgdata.sizes.height ) >= 2 * preview_size)
+    preview = LRAW_PREVIEW_HALF_SIZE;
+  if(preview == LRAW_PREVIEW_HALF_SIZE)
+    params->half_size = 1;
+
   if(render)
   {
     clck = oyClock();
-    image_rgb = rip.dcraw_make_mem_image();
+    error = rip.unpack();
     clck = oyClock() - clck;
-    DBG_NUM1_S("rip.dcraw_make_mem_image(): %g", clck/1000000.0 );
+    DBG_NUM1_S("rip.unpack(): %g", clck/1000000.0 );
   }
 
-  if(image_rgb)
+  params->output_color = 0;    /* raw_color */
+  params->output_bps = 16;     /* linear space */
+  params->gamm[0] = 1.0; params->gamm[1] = 1.0;
+  params->user_qual = 3;
+  params->use_camera_wb = 1;
+  params->no_auto_bright = 1;
+
+  if(render && !error)
   {
-    width = image_rgb->width;
-    height = image_rgb->height;
-    spp = image_rgb->colors;
+    clck = oyClock();
+    error = rip.dcraw_process();
+    clck = oyClock() - clck;
+    DBG_NUM1_S("rip.dcraw_process(): %g", clck/1000000.0 );
+  }
 
-    if(image_rgb->bits == 16)
+  /* write the processed pixels straight into the later image array */
+  if(render && !error)
+  {
+    int bits = 0;
+    clck = oyClock();
+    rip.get_mem_image_format( &width, &height, &spp, &bits );
+    if(bits == 16)
     {
       data_type = oyUINT16;
       byteps = 2;
@@ -451,29 +646,35 @@ int      lrawFilterPlug_ImageInputRAWRun (
              OY_DBG_FORMAT_ " maxval: %g",
              OY_DBG_ARGS_, maxval );
     }
+    mem_n = (size_t)width*height*byteps*spp;
+    if(mem_n)
+      oyAllocHelper_m_( buf, uint8_t, mem_n, 0, return 1);
+    if(buf)
+      error = rip.copy_mem_image( buf, width*spp*byteps, 0 );
+    clck = oyClock() - clck;
+    DBG_NUM1_S("rip.copy_mem_image(): %g", clck/1000000.0 );
+  }
 
-  } else
+  if(!buf || error)
   {
     info_good = 0;
+    oyFree_m_( buf );
+    width = height = 0;
   }
 
     switch(spp)
     {
       case 1:
            profile_type = oyASSUMED_GRAY;
-           type = 5;
            break;
       case 2:
            profile_type = oyASSUMED_GRAY;
-           type = 5;
            break;
       case 3:
            profile_type = oyASSUMED_RGB;
-           type = 6;
            break;
       case 4:
            profile_type = oyASSUMED_RGB;
-           type = 6;
            break;
     }
 
@@ -486,97 +687,8 @@ int      lrawFilterPlug_ImageInputRAWRun (
     return FALSE;
   }
 
-  /* check if the file can hold the expected data (for raw only) */
-  mem_n = width*height*byteps*spp;
-  if( image_rgb )
-    error = mem_n != image_rgb->data_size;
-
-  if(info_good)
-    oyAllocHelper_m_( buf, uint8_t, mem_n, 0, return 1);
-
-  /* the following code is almost completely taken from ku.b's ppm CP plug-in */
-  /* ... and then copied from the input_ppm Oyranos filter */
-  if(info_good)
-  {
-    int h, j_h = 0, p, n_samples, n_bytes;
-    int byte_swap = 0; /*!oyBigEndian();*/
-    unsigned char *d_8 = 0;
-    unsigned char *src = image_rgb->data;
-
-    uint16_t *d_16;
-    float  *d_f;
-
-#pragma omp parallel for
-    for(h = 0; h < height; ++h)
-    {
-        n_samples = 1 * width * spp;
-        n_bytes = n_samples * byteps;
-
-        d_8  = buf;
-        d_16 = (uint16_t*)buf;
-        d_f  = (float*)buf;
-
-        /*  TODO 1 bit raw and ascii */
-        if (type == 1 || type == 4) {
-
-        /*  TODO ascii  */
-        } else if (type == 2 || type == 3) {
-
-
-        /*  raw and floats */
-        } else if (type == 5 || type == 6 ||
-                   type == -5 || type == -6 ||
-                   type == 7 )
-        {
-          if(byteps == 1) {
-            d_8 = &src[ h * width * spp * byteps ];
-          } else if(byteps == 2) {
-            d_16 = (uint16_t*)& src[ h * width * spp * byteps ];
-          } else if(byteps == 4) {
-            d_f = (float*)&src[ h * width * spp * byteps ];
-          }
-          memcpy (&buf[ h * width * spp * byteps ],
-                  &src[ (j_h + h) * width * spp * byteps ],
-                  1 * width * spp * byteps);
-        }
-
-        /* normalise and byteswap */
-        if( byte_swap )
-        {
-          unsigned char *c_buf = &buf[ h * width * spp * byteps ];
-          char  tmp;
-          if (byteps == 2) {         /* 16 bit */
-            for (p = 0; p < n_bytes; p += 2)
-            {
-              tmp = c_buf[p];
-              c_buf[p] = c_buf[p+1];
-              c_buf[p+1] = tmp;
-            }
-          } else if (byteps == 4) {  /* float */
-            for (p = 0; p < n_bytes; p += 4)
-            {
-              tmp = c_buf[p];
-              c_buf[p] = c_buf[p+3];
-              c_buf[p+3] = tmp;
-              tmp = c_buf[p+1];
-              c_buf[p+1] = c_buf[p+2];
-              c_buf[p+2] = tmp;
-            }
-          }
-        }
-
-        if (byteps == 1 && maxval < 255) {         /*  8 bit */
-          for (p = 0; p < n_samples; ++p)
-            d_8[p] = (d_8[p] * 255) / maxval;
-        } else if (byteps == 2 && maxval < 65535) {/* 16 bit */
-          for (p = 0; p < n_samples; ++p)
-            d_16 [p] = (d_16[p] * 65535) / maxval;
-        } else if (byteps == 4 && maxval != 1.0) {  /* float */
-          for (p = 0; p < n_samples; ++p)
-            d_f[p] = d_f[p] * maxval;
-        }
-    }
-  }
+  if(info_good && preview_size > 0)
+    lrawDownscale_( buf, &width, &height, spp, byteps, preview_size );
 
   pixel_type = oyChannels_m(spp) | oyDataType_m(data_type);
   int32_t n = 0;
@@ -584,9 +696,15 @@ int      lrawFilterPlug_ImageInputRAWRun (
                       oyBOOLEAN_INTERSECTION, "///config",node_options);
   if(icc_profile_flags)
     oyOptions_SetFromInt( &options, "///icc_profile_flags", icc_profile_flags, 0, OY_CREATE_NEW | OY_MATCH_KEY );
-  device = oyREgetColorInfo( filename, params, options );
-  error = oyDeviceGetProfile( device, options, &prof );
-  if(!prof || error != 0)
+  /* the camera renders thumbnails for the web */
+  if(thumbnail)
+    prof = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, 0 );
+  else
+  {
+    device = oyREgetColorInfo( filename, params, options );
+    error = oyDeviceGetProfile( device, options, &prof );
+  }
+  if(!thumbnail && (!prof || error != 0))
   {
     if(prof)
       oyProfile_Release( &prof );
@@ -636,7 +754,7 @@ int      lrawFilterPlug_ImageInputRAWRun (
   }
   oyConfig_Release( &device );
 
-  if(oy_debug && image_in && getenv("OY_DEBUG_WRITE"))
+  if(oy_debug && image_in && oyEnvGetString(oyENV_DEBUG_WRITE))
   {
     oyArray2d_s * a = (oyArray2d_s*)oyImage_GetPixelData( image_in );
     oyArray2d_ToPPM_( a, "test_oy_dbg_lraw.ppm" );
@@ -658,6 +776,12 @@ int      lrawFilterPlug_ImageInputRAWRun (
   error = oyOptions_SetFromString( &image_in_tags,
                               "//" OY_TYPE_STD OY_SLASH CMM_NICK "/filename",
                                  filename, OY_CREATE_NEW | OY_MATCH_KEY);
+  /* the preview mode, which was actually decoded */
+  if(preview != LRAW_PREVIEW_NONE)
+    oyOptions_SetFromInt( &image_in_tags,
+                          "//" OY_TYPE_STD OY_SLASH CMM_NICK "/preview",
+                          thumbnail ? LRAW_PREVIEW_THUMBNAIL : LRAW_PREVIEW_HALF_SIZE,
+                          0, OY_CREATE_NEW | OY_MATCH_KEY );
 
   if(error <= 0)
   {
@@ -712,6 +836,12 @@ const char lraw_extra_options[] = {
      <" CMM_NICK ">\n\
       <half_size.advanced>0</half_size.advanced>\n\
      </" CMM_NICK ">\n\
+     <" CMM_NICK ">\n\
+      <preview>0</preview>\n\
+     </" CMM_NICK ">\n\
+     <" CMM_NICK ">\n\
+      <preview_size>0</preview_size>\n\
+     </" CMM_NICK ">\n\
      <" CMM_NICK ">\n\
       <highlight.advanced>0</highlight.advanced>\n\
      </" CMM_NICK ">\n\
@@ -781,6 +911,35 @@ int  lrawUiGet                       ( oyCMMapiFilter_s  * module OY_UNUSED,
         <xf:value>16</xf:value>\n\
         <xf:label>");
   A(             _("16-bit"));
+  A(                     "</xf:label>\n\
+       </xf:item>\n\
+      </xf:choices>\n\
+     </xf:select1>\n");
+  A("\
+     <xf:select1 ref=\"/" OY_TOP_SHARED "/" OY_DOMAIN_INTERNAL "/" OY_TYPE_STD "/" CMM_NICK "/preview\">\n\
+      <xf:label>" );
+  A(          _("Preview"));
+  A(                              "</xf:label>\n\
+      <xf:help>" );
+  A(          _("A preview decodes much faster than the full image. Cameras embed JPEG thumbnails mostly. Without JPEG support those are read at half size instead."));
+  A(                              "</xf:help>\n\
+      <xf:choices>\n\
+       <xf:item>\n\
+        <xf:value>0</xf:value>\n\
+        <xf:label>");
+  A(             _("No"));
+  A(                     "</xf:label>\n\
+       </xf:item>\n\
+       <xf:item>\n\
+        <xf:value>1</xf:value>\n\
+        <xf:label>");
+  A(             _("Embedded Thumbnail"));
+  A(                     "</xf:label>\n\
+       </xf:item>\n\
+       <xf:item>\n\
+        <xf:value>2</xf:value>\n\
+        <xf:label>");
+  A(             _("Half Size"));
   A(                     "</xf:label>\n\
        </xf:item>\n\
       </xf:choices>\n\
@@ -856,8 +1015,12 @@ const char * oyraApi4UiImageInputLibrawGetText (
                "with value \"1\" requestests a oyConfig_s object containing "
                "typical device informations about the cameraRAW file. "
                "The option \"render\" with value \"0\" will skip some of the "
-               "data processing. The resulting image will be tagged with "
-               "\"filename\"=string.");
+               "data processing. The option \"preview\" with value \"1\" "
+               "reads a uncompressed embedded thumbnail and with value \"2\" "
+               "demosaics at half size. The option \"preview_size\" limits "
+               "the longest side in pixels. The resulting image will be "
+               "tagged with \"filename\"=string and for previews with "
+               "\"preview\"=int, the decoded mode.");
   }
   return 0;
 }
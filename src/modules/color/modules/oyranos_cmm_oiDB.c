@@ -30,10 +30,15 @@
 
 #include "oyranos_cmm.h"         /* the API's this CMM implements */
 #include "oyranos_config.h"            /* oyDB_s stuff */
+#include "oyranos_config_internal.h"
 #include "oyranos_db.h"
 #include "oyranos_i18n.h"
 #include "oyranos_string.h"
 
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
 /*
 oyCMM_s         oiDB_cmm_module;
 oyCMMapi10_s    oiDB_api10_cmm;
@@ -75,6 +80,8 @@ char*    oiDBSearchEmptyKeyname      ( const char        * keyParentName,
                                        oySCOPE_e           scope );
 int      oiDBEraseKey                ( const char        * key_name,
                                        oySCOPE_e           scope );
+int      oiDBTransactionBegin        ( oySCOPE_e           scope );
+int      oiDBTransactionCommit       ( oySCOPE_e           scope );
 
 
 oyMessage_f oiDB_msg = oyMessageFunc;
@@ -242,13 +249,130 @@ char **  oiDB_getKeyNamesOneLevel    ( oyDB_s            * db,
   return keys; 
 }
 
+/* the open write batch of a thread; oySCOPE_USER_SYS keys are prefixed by
+ * the caller and go into the batch scope */
+typedef struct {
+  openiccDBTransaction_s * tr;
+  oySCOPE_e                scope;
+  int                      level;
+} oiDBTransaction_s;
+#define oiDBTransactionFor_m(t,scope) \
+  (t && t->tr && (scope == t->scope || scope == oySCOPE_USER_SYS))
+
+#if defined(HAVE_PTHREAD)
+/* each thread batches its own writes; keys set by other threads meanwhile
+ * go directly to the DB */
+static pthread_key_t oiDB_transaction_key_;
+static pthread_once_t oiDB_transaction_once_ = PTHREAD_ONCE_INIT;
+
+/* drops a batch, which its thread left open */
+static void oiDBTransactionFree_     ( void              * ptr )
+{
+  oiDBTransaction_s * t = (oiDBTransaction_s*) ptr;
+  if(t && t->tr)
+    openiccDBTransactionRelease( &t->tr );
+  free( t );
+}
+static void oiDBTransactionKeyCreate_( void )
+{
+  pthread_key_create( &oiDB_transaction_key_, oiDBTransactionFree_ );
+}
+static oiDBTransaction_s * oiDBTransactionGet_ ( int      create )
+{
+  oiDBTransaction_s * t;
+
+  pthread_once( &oiDB_transaction_once_, oiDBTransactionKeyCreate_ );
+  t = (oiDBTransaction_s*) pthread_getspecific( oiDB_transaction_key_ );
+  if(!t && create)
+  {
+    t = (oiDBTransaction_s*) calloc( sizeof(oiDBTransaction_s), 1 );
+    if(t && pthread_setspecific( oiDB_transaction_key_, t ) != 0)
+    {
+      free( t );
+      t = NULL;
+    }
+  }
+  return t;
+}
+#else
+static oiDBTransaction_s oiDB_transaction_ = { NULL, oySCOPE_USER_SYS, 0 };
+static oiDBTransaction_s * oiDBTransactionGet_ ( int      create OY_UNUSED )
+{
+  return &oiDB_transaction_;
+}
+#endif
+
+/** Function oiDBTransactionBegin
+ *  @brief   collect key writes of a scope
+ *
+ *  Nested calls for the same scope are counted. The batch belongs to the
+ *  calling thread.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/17
+ *  @since   2018/04/05 (Oyranos: 0.9.7)
+ */
+int      oiDBTransactionBegin        ( oySCOPE_e           scope )
+{
+  oiDBTransaction_s * t = oiDBTransactionGet_( 1 );
+
+  if(!t)
+    return 1;
+
+  if(t->tr)
+  {
+    if(scope != t->scope)
+    {
+      oiDB_msg( oyMSG_WARN, 0, OY_DBG_FORMAT_ "transaction for scope %d already open",
+                OY_DBG_ARGS_, t->scope );
+      return 1;
+    }
+    ++t->level;
+    return 0;
+  }
+
+  t->tr = openiccDBTransactionBegin( (openiccSCOPE_e)scope );
+  if(!t->tr)
+    return 1;
+  t->scope = scope;
+  t->level = 1;
+  return 0;
+}
+
+/** Function oiDBTransactionCommit
+ *  @brief   write the collected keys in one go
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/17
+ *  @since   2018/04/05 (Oyranos: 0.9.7)
+ */
+int      oiDBTransactionCommit       ( oySCOPE_e           scope )
+{
+  oiDBTransaction_s * t = oiDBTransactionGet_( 0 );
+  int error;
+
+  if(!t || !t->tr || scope != t->scope)
+    return 1;
+  if(--t->level > 0)
+    return 0;
+
+  error = openiccDBTransactionCommit( t->tr );
+  openiccDBTransactionRelease( &t->tr );
+  return error;
+}
+
 int oiDBSetString                    ( const char        * key_name,
                                        oySCOPE_e           scope,
                                        const char        * value,
                                        const char        * comment)
 {
   char * oi = oiOyranosToOpenicc( key_name, 0 );
-  int error = openiccDBSetString( oi, (openiccSCOPE_e)scope, value, comment );
+  oiDBTransaction_s * t = oiDBTransactionGet_( 0 );
+  int error;
+  if(oiDBTransactionFor_m(t,scope))
+    error = openiccDBTransactionSetString( t->tr, oi, value, comment );
+  else
+    error = openiccDBSetString( oi, (openiccSCOPE_e)scope, value, comment );
   if(oi) oyFree_m_(oi);
   return error;
 }
@@ -266,7 +390,12 @@ int      oiDBEraseKey                ( const char        * key_name,
                                        oySCOPE_e           scope )
 {
   char * oi = oiOyranosToOpenicc( key_name, 0 );
-  int error = openiccDBSetString( oi, (openiccSCOPE_e)scope, NULL, "delete" );
+  oiDBTransaction_s * t = oiDBTransactionGet_( 0 );
+  int error;
+  if(oiDBTransactionFor_m(t,scope))
+    error = openiccDBTransactionSetString( t->tr, oi, NULL, "delete" );
+  else
+    error = openiccDBSetString( oi, (openiccSCOPE_e)scope, NULL, "delete" );
   if(oi) oyFree_m_(oi);
   return error;
 }
@@ -376,7 +505,9 @@ oyDbAPI_s oiDBopeniccDbAPI = {
 
   /* setString */ oiDBSetString,
   /* searchEmptyKeyname */ oiDBSearchEmptyKeyname,
-  /* eraseKey */ oiDBEraseKey
+  /* eraseKey */ oiDBEraseKey,
+  /* transactionBegin */ oiDBTransactionBegin,
+  /* transactionCommit */ oiDBTransactionCommit
 };
 
 /**
@@ -476,7 +607,8 @@ oyCMMapi10_s_    oiDB_api10_cmm = {
   oiDBInfoGetTextDBC,             /**< getText */
   (char**)oiDB_texts_profile_create,   /**<texts; list of arguments to getText*/
  
-  oiDBMOptions_Handle                  /**< oyMOptions_Handle_f oyMOptions_Handle */
+  oiDBMOptions_Handle,                 /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                 /**< commands; none */
 };
 
 
@@ -27,8 +27,11 @@
 #include "oyCMM_s.h"
 #include "oyCMMapi9_s_.h"
 #include "oyCMMobjectType_s_.h"
+#include "oyHash_s.h"
+#include "oyPointer_s.h"
 #include "oyProfiles_s.h"
 
+#include "oyranos_cache.h"
 #include "oyranos_cmm.h"
 #include "oyranos_definitions.h"
 #include "oyranos_helper.h"
@@ -720,15 +723,16 @@ oyCMMobjectType_s_ * icc_objects[] = {
 };
 
 
+/* db_o is borrowed from the policy snapshot and is not modified */
 void             oiccChangeNodeOption( oyOptions_s       * f_options,
-                                       oyOptions_s       * db_options,
+                                       oyOption_s        * db_o,
                                        const char        * key,
                                        oyConversion_s    * cc OY_UNUSED,
                                        int                 verbose,
                                        int                 flags,
                                        int                 type )
 {
-  oyOption_s * o, * db_o;
+  oyOption_s * o;
   const char * tmp = 0;
   char * text = 0;
 
@@ -740,13 +744,13 @@ void             oiccChangeNodeOption( oyOptions_s       * f_options,
                   !(oyOption_GetFlags(o) & oyOPTIONATTRIBUTE_EDIT)) ||
                  !o)
               {
-                db_o = oyOptions_Find( db_options, key, oyNAME_PATTERN );
                 if(db_o)
                 {
                   if(!o)
                   {
-                    oyOption_SetFlags(db_o, oyOption_GetFlags(db_o) | oyOPTIONATTRIBUTE_AUTOMATIC);
-                    oyOptions_MoveIn( f_options, &db_o, -1 );
+                    oyOption_s * copy = oyOption_Copy( db_o, f_options->oy_ );
+                    oyOption_SetFlags(copy, oyOption_GetFlags(copy) | oyOPTIONATTRIBUTE_AUTOMATIC);
+                    oyOptions_MoveIn( f_options, &copy, -1 );
                   }
                   else
                   {
@@ -776,6 +780,8 @@ void             oiccChangeNodeOption( oyOptions_s       * f_options,
                                  strrchr(__FILE__,'/') + 1 : __FILE__ ,__LINE__,
                          key, tmp?tmp:"????");
               }
+
+  oyOption_Release( &o );
 }
 
 void     oiccFilterGraph_CountNodes  ( oyFilterGraph_s   * g,
@@ -865,6 +871,134 @@ void     oiccFilterNode_OptionsPrint ( oyFilterNode_s    * node,
               }
 }
 
+/* policy keys merged from the DB into the first ICC node */
+static const struct { const char * key; int type; } oicc_policy_keys_[] = {
+  { "proof_soft",              oyOPTIONATTRIBUTE_ADVANCED },
+  { "proof_hard",              oyOPTIONATTRIBUTE_ADVANCED },
+  { "rendering_intent",        0 },
+  { "rendering_bpc",           0 },
+  { "rendering_intent_proof",  oyOPTIONATTRIBUTE_ADVANCED },
+  { "rendering_gamut_warning", oyOPTIONATTRIBUTE_ADVANCED },
+  { "effect_switch",           0 },
+  { "display_white_point",     0 }
+};
+#define OICC_POLICY_KEYS_N (int)(sizeof(oicc_policy_keys_)/sizeof(oicc_policy_keys_[0]))
+
+/** @internal
+ *  @brief   resolved policy for one node registration and flags
+ *
+ *  The snapshot is not modified after creation. It is kept in the module
+ *  cache and rebuilt after the DB cache generation changed.
+ */
+typedef struct {
+  int            generation;           /**< get_oy_db_cache_generation_() */
+  oyOptions_s  * db_options;           /**< oyOptions_ForFilter() result */
+  oyOption_s   * options[OICC_POLICY_KEYS_N]; /**< per oicc_policy_keys_ */
+  oyProfile_s  * effect;               /**< oyPROFILE_EFFECT */
+  oyProfile_s  * proof;                /**< oyPROFILE_PROOF */
+} oiccPolicy_s;
+
+static int   oiccPolicy_Release_     ( oyPointer         * ptr )
+{
+  oiccPolicy_s * policy;
+  int i;
+
+  if(!ptr || !*ptr)
+    return 1;
+
+  policy = (oiccPolicy_s*) *ptr;
+  for(i = 0; i < OICC_POLICY_KEYS_N; ++i)
+    oyOption_Release( &policy->options[i] );
+  oyOptions_Release( &policy->db_options );
+  oyProfile_Release( &policy->effect );
+  oyProfile_Release( &policy->proof );
+  oyDeAllocateFunc_( policy );
+  *ptr = NULL;
+
+  return 0;
+}
+
+static oiccPolicy_s * oiccPolicy_New_( const char        * reg,
+                                       uint32_t            flags,
+                                       int                 generation )
+{
+  uint32_t icc_profile_flags = oyICCProfileSelectionFlagsFromRegistration( reg );
+  oiccPolicy_s * policy = (oiccPolicy_s*) oyAllocateFunc_( sizeof(oiccPolicy_s) );
+  int i;
+
+  if(!policy)
+    return NULL;
+  memset( policy, 0, sizeof(oiccPolicy_s) );
+
+  policy->generation = generation;
+  policy->db_options = oyOptions_ForFilter( reg, flags, 0 );
+  for(i = 0; i < OICC_POLICY_KEYS_N; ++i)
+    policy->options[i] = oyOptions_Find( policy->db_options,
+                                         oicc_policy_keys_[i].key,
+                                         oyNAME_PATTERN );
+  policy->effect = oyProfile_FromStd( oyPROFILE_EFFECT, icc_profile_flags, 0 );
+  policy->proof = oyProfile_FromStd( oyPROFILE_PROOF, icc_profile_flags, 0 );
+
+  return policy;
+}
+
+static volatile int oicc_policy_lock_ = 0;
+
+/** @internal
+ *  @brief   get the policy snapshot for a node
+ *
+ *  The settings DB merges, option lookups and std profile loading are done
+ *  only, when the DB cache changed since the last call.
+ *
+ *  @param[in]     reg                 the node registration
+ *  @param[in]     flags               for oyOptions_ForFilter()
+ *  @return                            a new reference; the snapshot is in
+ *                                     oyPointer_GetPointer()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/12
+ *  @since   2018/03/12 (Oyranos: 0.9.7)
+ */
+static oyPointer_s * oiccPolicy_Get_ ( const char        * reg,
+                                       uint32_t            flags )
+{
+  int generation = *get_oy_db_cache_generation_();
+  char * hash_text = NULL;
+  oyHash_s * hash;
+  oyPointer_s * ptr, * old;
+  oiccPolicy_s * policy;
+
+  oyStringAddPrintf( &hash_text, 0,0, "oicc_policy:%u:%s", flags, reg );
+  hash = oyCMMCacheListGetEntry_( hash_text );
+  oyFree_m_( hash_text );
+
+  oySpinLock_m( oicc_policy_lock_ )
+  ptr = (oyPointer_s*) oyHash_GetPointer( hash, oyOBJECT_POINTER_S );
+  policy = ptr ? (oiccPolicy_s*) oyPointer_GetPointer( ptr ) : NULL;
+  ptr = (policy && policy->generation == generation) ?
+        oyPointer_Copy( ptr, 0 ) : NULL;
+  oySpinUnLock_m( oicc_policy_lock_ )
+
+  if(!ptr)
+  {
+    /* build outside the lock; a concurrent build just wins the slot */
+    policy = oiccPolicy_New_( reg, flags, generation );
+    ptr = oyPointer_New( 0 );
+    oyPointer_Set( ptr, NULL, "oiccPolicy_s", policy,
+                   "oiccPolicy_Release_", oiccPolicy_Release_ );
+
+    oySpinLock_m( oicc_policy_lock_ )
+    old = (oyPointer_s*) oyHash_GetPointer( hash, oyOBJECT_POINTER_S );
+    oyHash_SetPointer( hash, (oyStruct_s*) ptr );
+    oyPointer_Release( &old );
+    oySpinUnLock_m( oicc_policy_lock_ )
+  }
+
+  oyHash_Release( &hash );
+
+  return ptr;
+}
+
 int           oiccConversion_Correct ( oyConversion_s    * conversion,
                                        uint32_t            flags,
                                        oyOptions_s       * options )
@@ -880,8 +1014,9 @@ int           oiccConversion_Correct ( oyConversion_s    * conversion,
                * effps = 0;
   oyProfile_s * proof =  0,
               * effp = 0;
-  oyOptions_s * db_options = 0,
-              * f_options = 0;
+  oyPointer_s * policy_ptr = 0;
+  oiccPolicy_s * policy = 0;
+  oyOptions_s * f_options = 0;
   oyOption_s * o = 0;
   const char * val = 0;
   int32_t proofing = 0,
@@ -932,42 +1067,31 @@ int           oiccConversion_Correct ( oyConversion_s    * conversion,
           oyConnector_s * edge_pattern = oyFilterPlug_GetPattern( edge );
           oyFilterSocket_s * edge_remote = oyFilterPlug_GetSocket( edge );
           oyConnector_s * edge_remote_pattern = oyFilterSocket_GetPattern( edge_remote );
-          /* select only application level "data" coonectors; follow the data */
-          if(oyFilterRegistrationMatch( oyConnector_GetReg( edge_pattern ),
+          /* select only application level "data" coonectors; follow the data;
+           * stop at the first hit if "icc" - the node test rejects most edges */
+          if(oyFilterRegistrationMatch( oyFilterNode_GetRegistration( node ),
+                                        "//" OY_TYPE_STD "/icc_color", 0) &&
+             oyFilterRegistrationMatch( oyConnector_GetReg( edge_pattern ),
                                         "//" OY_TYPE_STD "/data", 0) &&
              oyFilterRegistrationMatch( oyConnector_GetReg( edge_remote_pattern ),
                                         "//" OY_TYPE_STD "/data", 0))
           {
-            /* stop at the first hit if "icc" */
-            if( oyFilterRegistrationMatch( oyFilterNode_GetRegistration( node ),
-                                           "//" OY_TYPE_STD "/icc_color", 0))
             {
               const char * reg = oyFilterNode_GetRegistration( node );
-              uint32_t icc_profile_flags = oyICCProfileSelectionFlagsFromRegistration( reg );
+              int k;
 
               /* apply the found policy settings */
-              db_options = oyOptions_ForFilter( reg, flags, 0 );
+              policy_ptr = oiccPolicy_Get_( reg, flags );
+              policy = (oiccPolicy_s*) oyPointer_GetPointer( policy_ptr );
               f_options = oyFilterNode_GetOptions( node, flags );
 
-              if(oy_debug > 2 || verbose)
-                oiccFilterNode_OptionsPrint( node, f_options, db_options );
-
-              oiccChangeNodeOption( f_options, db_options,
-                                    "proof_soft", s, verbose, flags, oyOPTIONATTRIBUTE_ADVANCED );
-              oiccChangeNodeOption( f_options, db_options,
-                                    "proof_hard", s, verbose, flags, oyOPTIONATTRIBUTE_ADVANCED);
-              oiccChangeNodeOption( f_options, db_options,
-                                    "rendering_intent", s, verbose, flags, 0);
-              oiccChangeNodeOption( f_options, db_options,
-                                    "rendering_bpc", s, verbose, flags, 0);
-              oiccChangeNodeOption( f_options, db_options,
-                                    "rendering_intent_proof", s, verbose, flags, oyOPTIONATTRIBUTE_ADVANCED);
-              oiccChangeNodeOption( f_options, db_options,
-                                    "rendering_gamut_warning", s, verbose, flags, oyOPTIONATTRIBUTE_ADVANCED);
-              oiccChangeNodeOption( f_options, db_options,
-                                    "effect_switch", s, verbose, flags, 0 );
-              oiccChangeNodeOption( f_options, db_options,
-                                    "display_white_point", s, verbose, flags, 0 );
+              if(policy && (oy_debug > 2 || verbose))
+                oiccFilterNode_OptionsPrint( node, f_options, policy->db_options );
+
+              for(k = 0; policy && k < OICC_POLICY_KEYS_N; ++k)
+                oiccChangeNodeOption( f_options, policy->options[k],
+                                      oicc_policy_keys_[k].key, s, verbose,
+                                      flags, oicc_policy_keys_[k].type );
               if(display_mode)
                 proofing = oyOptions_FindString( f_options, "proof_soft", "1" )
                            ? 1 : 0;
@@ -982,7 +1106,7 @@ int           oiccConversion_Correct ( oyConversion_s    * conversion,
               o = oyOptions_Find( f_options, "profiles_effect", oyNAME_PATTERN );
               if(!o && (effect_switch))
               {
-                effp = oyProfile_FromStd( oyPROFILE_EFFECT, icc_profile_flags, 0 );
+                effp = oyProfile_Copy( policy ? policy->effect : NULL, 0 );
                 effps = oyProfiles_New(0);
                 val = oyProfile_GetText( effp, oyNAME_NAME );
                 oyProfiles_MoveIn( effps, &effp, -1 );
@@ -1011,7 +1135,7 @@ int           oiccConversion_Correct ( oyConversion_s    * conversion,
               o = oyOptions_Find( f_options, "profiles_simulation", oyNAME_PATTERN );
               if(!o && (proofing || rendering_gamut_warning))
               {
-                proof = oyProfile_FromStd( oyPROFILE_PROOF, icc_profile_flags, 0 );
+                proof = oyProfile_Copy( policy ? policy->proof : NULL, 0 );
                 proofs = oyProfiles_New(0);
                 val = oyProfile_GetText( proof, oyNAME_NAME );
                 oyProfiles_MoveIn( proofs, &proof, -1 );
@@ -1058,7 +1182,7 @@ int           oiccConversion_Correct ( oyConversion_s    * conversion,
                   OY_DBG_FORMAT_"display_white_point: %d", OY_DBG_ARGS_, display_white_point);
 
               oyOption_Release( &o );
-              oyOptions_Release( &db_options );
+              oyPointer_Release( &policy_ptr );
               oyOptions_Release( &f_options );
 
               j = m;
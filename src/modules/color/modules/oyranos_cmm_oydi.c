@@ -619,6 +619,394 @@ int      oydiColorServerActive( oyBlob_s * display_id )
   return active;
 }
 
+/* Converted tiles are remembered per monitor in a oyBlob_s inside the node
+ * options. The tiles are placed in input image pixels. So a scrolled view
+ * keeps its tiles, after the output array content was moved along. A tile
+ * stays valid as long as the key of its monitor is unchanged, it was
+ * completely visible on that monitor before a view change and no
+ * "dirty_rectangle" image tag touches it. */
+#define OYDI_TILE_SIZE 64
+typedef struct {
+  uint32_t key;                        /* image and transform hash */
+  int32_t  cols;
+  int32_t  rows;
+  int32_t  vis[4];                     /* visible input pixels at last run */
+  uint8_t  valid[1];                   /* cols x rows flags */
+} oydiTileCache_s;
+
+/* FNV-1a */
+static uint32_t oydiHash_            ( uint32_t            hash,
+                                       const void        * data,
+                                       size_t              size )
+{
+  const unsigned char * d = (const unsigned char*) data;
+  size_t i;
+
+  for(i = 0; i < size; ++i)
+  {
+    hash ^= d[i];
+    hash *= 16777619u;
+  }
+
+  return hash;
+}
+
+/* remove all options matching registration */
+static void oydiOptionsReleaseType_  ( oyOptions_s       * options,
+                                       const char        * registration )
+{
+  int i = oyOptions_Count( options );
+
+  while(i--)
+  {
+    oyOption_s * o = oyOptions_Get( options, i );
+    if(oyFilterRegistrationMatch( oyOption_GetRegistration( o ),
+                                  registration, 0 ))
+      oyOptions_ReleaseAt( options, i );
+    oyOption_Release( &o );
+  }
+}
+
+/** @internal
+ *  @brief   move the output array content along a scrolled view
+ *
+ *  The origin is the input image pixel shown in the top left array pixel.
+ *  The array content of the last run is moved to the new origin. Uncovered
+ *  pixels keep their old values and are converted again through the tiles.
+ *
+ *  @param[in,out] node_options        the display node options
+ *  @param[in]     ticket              the tickets array
+ *  @param[in]     channels            samples per pixel in the array
+ *  @param[in]     origin_x            input pixel of array column 0
+ *  @param[in]     origin_y            input pixel of array row 0
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/27
+ *  @since   2018/03/27 (Oyranos: 0.9.7)
+ */
+static void oydiTileCacheScroll_     ( oyOptions_s      ** node_options,
+                                       oyPixelAccess_s   * ticket,
+                                       int                 channels,
+                                       int                 origin_x,
+                                       int                 origin_y )
+{
+  double old_x = 0, old_y = 0;
+  int error = oyOptions_FindDouble( *node_options, "tile_origin", 0, &old_x );
+
+  if(!error)
+    error = oyOptions_FindDouble( *node_options, "tile_origin", 1, &old_y );
+
+  if(!error && channels > 0 &&
+     (origin_x != (int)old_x || origin_y != (int)old_y))
+  {
+    oyArray2d_s * array = oyPixelAccess_GetArray( ticket );
+    char ** rows = (char**) oyArray2d_GetData( array );
+    int w = oyArray2d_GetWidth( array ) / channels,
+        h = oyArray2d_GetHeight( array ),
+        dx = origin_x - (int)old_x,
+        dy = origin_y - (int)old_y,
+        x0 = dx < 0 ? -dx : 0,
+        x1 = dx < 0 ? w : w - dx,
+        y;
+    size_t pixel = channels * oyDataTypeGetSize( oyArray2d_GetType( array ) );
+
+    /* new[y][x] = old[y+dy][x+dx] */
+    if(rows && x0 < x1)
+    {
+      if(dy > 0)
+        for(y = 0; y + dy < h; ++y)
+          memmove( rows[y] + x0 * pixel, rows[y+dy] + (x0 + dx) * pixel,
+                   (x1 - x0) * pixel );
+      else
+        for(y = h - 1; y + dy >= 0; --y)
+          memmove( rows[y] + x0 * pixel, rows[y+dy] + (x0 + dx) * pixel,
+                   (x1 - x0) * pixel );
+    }
+
+    oyArray2d_Release( &array );
+  }
+
+  oyOptions_SetFromDouble( node_options, "//" OY_TYPE_STD "/display/tile_origin",
+                           origin_x, 0, OY_CREATE_NEW );
+  oyOptions_SetFromDouble( node_options, "//" OY_TYPE_STD "/display/tile_origin",
+                           origin_y, 1, OY_CREATE_NEW );
+}
+
+/** @internal
+ *  @brief   select the not yet converted tiles of one monitor
+ *
+ *  The tiles start at the top left corner of the input image. The invalid
+ *  tiles of each tile row inside the visible area are covered by one
+ *  rectangle and equal neighbour rows are merged. Covered tiles count as
+ *  converted afterwards.
+ *
+ *  @param[in,out] node_options        the display node options
+ *  @param[in]     pos                 monitor position
+ *  @param[in]     key                 the monitors image and transform hash
+ *  @param[in]     input_width         input image width in pixel
+ *  @param[in]     input_height        input image height in pixel
+ *  @param[in]     roi_pix             the monitors work rectangle
+ *  @param[in]     start_x             input pixel shown at roi_pix x = 0
+ *  @param[in]     start_y             input pixel shown at roi_pix y = 0
+ *  @param[in]     image_tags          tags with "dirty_rectangle" options
+ *  @param[out]    spans               rectangles in roi_pix coordinates; free it
+ *  @param[out]    spans_n             count of spans
+ *  @return                            tiles to convert
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/27
+ *  @since   2018/03/20 (Oyranos: 0.9.7)
+ */
+static int oydiTileCacheSelect_      ( oyOptions_s      ** node_options,
+                                       int                 pos,
+                                       uint32_t            key,
+                                       int                 input_width,
+                                       int                 input_height,
+                                       oyRectangle_s_    * roi_pix,
+                                       int                 start_x,
+                                       int                 start_y,
+                                       oyOptions_s       * image_tags,
+                                       oyRectangle_s_   ** spans,
+                                       int               * spans_n )
+{
+  int cols = (input_width + OYDI_TILE_SIZE - 1) / OYDI_TILE_SIZE,
+      rows = (input_height + OYDI_TILE_SIZE - 1) / OYDI_TILE_SIZE;
+  size_t size;
+  oyBlob_s * blob = NULL;
+  oydiTileCache_s * cache;
+  oyRectangle_s_ empty = {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0},
+                 vis = {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0},
+                 bounds = {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0};
+  int32_t v[4];
+  int i, j, n, converted = 0,
+      old_c0 = -1, old_c1 = -1,
+      c0, c1, r0, r1;
+
+  *spans = NULL;
+  *spans_n = 0;
+
+  /* the visible part of the input image */
+  bounds.width = input_width;
+  bounds.height = input_height;
+  oyRectangle_SetByRectangle( (oyRectangle_s*)&vis, (oyRectangle_s*)roi_pix );
+  vis.x += start_x;
+  vis.y += start_y;
+  oyRectangle_Trim( (oyRectangle_s*)&vis, (oyRectangle_s*)&bounds );
+  v[0] = OY_ROUND(vis.x); v[1] = OY_ROUND(vis.y);
+  v[2] = OY_ROUND(vis.width); v[3] = OY_ROUND(vis.height);
+
+  if(cols <= 0 || rows <= 0 || v[2] <= 0 || v[3] <= 0)
+    return 0;
+  size = sizeof(oydiTileCache_s) + cols * rows;
+
+  /* one cache per monitor in monitor order */
+  n = oyOptions_CountType( *node_options, "//" OY_TYPE_STD "/display/tile_cache",
+                           oyOBJECT_BLOB_S );
+  for( ; n <= pos; ++n)
+  {
+    char reg[64];
+    oySprintf_( reg, "//" OY_TYPE_STD "/display/tile_cache/%d", n );
+    blob = oyBlob_New( 0 );
+    oyOptions_MoveInStruct( node_options, reg, (oyStruct_s**)&blob,
+                            OY_CREATE_NEW );
+  }
+  blob = (oyBlob_s*) oyOptions_GetType( *node_options, pos,
+                                        "//" OY_TYPE_STD "/display/tile_cache",
+                                        oyOBJECT_BLOB_S );
+  cache = (oydiTileCache_s*) oyBlob_GetPointer( blob );
+  if(!cache || oyBlob_GetSize( blob ) != size || cache->key != key ||
+     cache->cols != cols || cache->rows != rows)
+  {
+    cache = (oydiTileCache_s*) oyAllocateFunc_( size );
+    if(cache)
+    {
+      memset( cache, 0, size );
+      cache->key = key;
+      cache->cols = cols;
+      cache->rows = rows;
+      memcpy( cache->vis, v, sizeof(v) );
+      oyBlob_SetFromData( blob, cache, size, "oydiTile" );
+      oyDeAllocateFunc_( cache );
+    }
+    cache = (oydiTileCache_s*) oyBlob_GetPointer( blob );
+  }
+  oyBlob_Release( &blob );
+  if(!cache)
+    return 0;
+
+  /* after a view change only completely seen tiles are in the array */
+  if(memcmp( cache->vis, v, sizeof(v) ) != 0)
+  {
+    for(j = 0; j < rows; ++j)
+      for(i = 0; i < cols; ++i)
+      {
+        int x = i * OYDI_TILE_SIZE, y = j * OYDI_TILE_SIZE,
+            x1 = OY_MIN( x + OYDI_TILE_SIZE, input_width ),
+            y1 = OY_MIN( y + OYDI_TILE_SIZE, input_height );
+        if(x < cache->vis[0] || x1 > cache->vis[0] + cache->vis[2] ||
+           y < cache->vis[1] || y1 > cache->vis[1] + cache->vis[3])
+          cache->valid[j*cols + i] = 0;
+      }
+    memcpy( cache->vis, v, sizeof(v) );
+  }
+
+  /* invalidate touched tiles */
+  n = oyOptions_CountType( image_tags, "//" OY_TYPE_STD "/display/dirty_rectangle",
+                           oyOBJECT_RECTANGLE_S );
+  for(i = 0; i < n; ++i)
+  {
+    oyRectangle_s * r = (oyRectangle_s*) oyOptions_GetType( image_tags, i,
+                                   "//" OY_TYPE_STD "/display/dirty_rectangle",
+                                                      oyOBJECT_RECTANGLE_S );
+    oyRectangle_s_ d = {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0};
+    int c;
+
+    oyRectangle_SetByRectangle( (oyRectangle_s*)&d, r );
+    oyRectangle_Release( &r );
+    d.x += start_x;
+    d.y += start_y;
+    oyRectangle_Trim( (oyRectangle_s*)&d, (oyRectangle_s*)&vis );
+    if(oyRectangle_CountPoints( (oyRectangle_s*)&d ) <= 0)
+      continue;
+
+    c0 = (int)d.x / OYDI_TILE_SIZE;
+    c1 = (int)(d.x + d.width - 1) / OYDI_TILE_SIZE;
+    r0 = (int)d.y / OYDI_TILE_SIZE;
+    r1 = (int)(d.y + d.height - 1) / OYDI_TILE_SIZE;
+    for(j = r0; j <= r1 && j < rows; ++j)
+      for(c = c0; c <= c1 && c < cols; ++c)
+        cache->valid[j*cols + c] = 0;
+  }
+
+  /* cover the invalid tiles inside the visible area */
+  c0 = v[0] / OYDI_TILE_SIZE;
+  c1 = (v[0] + v[2] - 1) / OYDI_TILE_SIZE;
+  r0 = v[1] / OYDI_TILE_SIZE;
+  r1 = (v[1] + v[3] - 1) / OYDI_TILE_SIZE;
+  *spans = (oyRectangle_s_*) oyAllocateFunc_( (r1 - r0 + 1) * sizeof(oyRectangle_s_) );
+  if(!*spans)
+    return 0;
+  for(j = r0; j <= r1; ++j)
+  {
+    int s0 = -1, s1 = -1;
+    oyRectangle_s_ row = {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0};
+
+    for(i = c0; i <= c1; ++i)
+      if(!cache->valid[j*cols + i])
+      {
+        if(s0 < 0) s0 = i;
+        s1 = i;
+      }
+
+    if(s0 < 0)
+    {
+      old_c0 = old_c1 = -1;
+      continue;
+    }
+
+    memset( &cache->valid[j*cols + s0], 1, s1 - s0 + 1 );
+    converted += s1 - s0 + 1;
+
+    row.x = s0 * OYDI_TILE_SIZE;
+    row.y = j * OYDI_TILE_SIZE;
+    row.width = (s1 - s0 + 1) * OYDI_TILE_SIZE;
+    row.height = OYDI_TILE_SIZE;
+    oyRectangle_Trim( (oyRectangle_s*)&row, (oyRectangle_s*)&vis );
+    row.x -= start_x;
+    row.y -= start_y;
+
+    if(s0 == old_c0 && s1 == old_c1)
+      (*spans)[*spans_n - 1].height += row.height;
+    else
+    {
+      oyRectangle_s_ * s = &(*spans)[(*spans_n)++];
+      memcpy( s, &empty, sizeof(oyRectangle_s_) );
+      oyRectangle_SetByRectangle( (oyRectangle_s*)s, (oyRectangle_s*)&row );
+    }
+    old_c0 = s0;
+    old_c1 = s1;
+  }
+
+  return converted;
+}
+
+/** @internal
+ *  @brief   run the "rectangles" node over the selected spans
+ *
+ *  Each pass sets one span per monitor. Monitors without tile cache get
+ *  their complete rectangle in the first pass. The rectangles are restored
+ *  afterwards.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/20
+ *  @since   2018/03/20 (Oyranos: 0.9.7)
+ */
+static int oydiTilesRun_             ( oyFilterNode_s    * rectangles,
+                                       oyOptions_s       * rectangles_options,
+                                       oyFilterPlug_s    * plug,
+                                       oyPixelAccess_s   * ticket,
+                                       int                 n,
+                                       oyRectangle_s_   ** spans,
+                                       int               * spans_n )
+{
+  oyRectangle_s_ * full = (oyRectangle_s_*) oyAllocateFunc_( n * sizeof(oyRectangle_s_) ),
+                   empty = {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0};
+  oyRectangle_s * r;
+  int i, k, passes = 0, result = 0, l_result;
+
+  if(!full)
+    return 1;
+
+  for(i = 0; i < n; ++i)
+  {
+    memcpy( &full[i], &empty, sizeof(oyRectangle_s_) );
+    r = (oyRectangle_s *) oyOptions_GetType( rectangles_options, i,
+                                       "//" OY_TYPE_STD "/rectangles/rectangle",
+                                             oyOBJECT_RECTANGLE_S );
+    oyRectangle_SetByRectangle( (oyRectangle_s*)&full[i], r );
+    oyRectangle_Release( &r );
+    if(spans_n[i] < 0 && passes < 1)
+      passes = 1;
+    else if(spans_n[i] > passes)
+      passes = spans_n[i];
+  }
+
+  for(k = 0; k < passes; ++k)
+  {
+    for(i = 0; i < n; ++i)
+    {
+      oyRectangle_s_ * s = &empty;
+      if(spans_n[i] < 0)
+      {
+        if(k == 0)
+          s = &full[i];
+      } else if(k < spans_n[i])
+        s = &spans[i][k];
+
+      r = (oyRectangle_s *) oyOptions_GetType( rectangles_options, i,
+                                       "//" OY_TYPE_STD "/rectangles/rectangle",
+                                               oyOBJECT_RECTANGLE_S );
+      oyRectangle_SetByRectangle( r, (oyRectangle_s*)s );
+      oyRectangle_Release( &r );
+    }
+
+    l_result = oyFilterNode_Run( rectangles, plug, ticket );
+    if(l_result > 0 || result == 0) result = l_result;
+  }
+
+  for(i = 0; i < n; ++i)
+  {
+    r = (oyRectangle_s *) oyOptions_GetType( rectangles_options, i,
+                                       "//" OY_TYPE_STD "/rectangles/rectangle",
+                                             oyOBJECT_RECTANGLE_S );
+    oyRectangle_SetByRectangle( r, (oyRectangle_s*)&full[i] );
+    oyRectangle_Release( &r );
+  }
+  oyDeAllocateFunc_( full );
+
+  return result;
+}
+
 /** @brief   implement oyCMMFilter_GetNext_f()
  *
  *  @version Oyranos: 0.1.10
@@ -655,10 +1043,34 @@ int      oydiFilterPlug_ImageDisplayRun(oyFilterPlug_s   * requestor_plug,
   int icc_profile_flags = 0;
   int width = 0, height = 0;
   int display_white_point = 0;
+  oyRectangle_s_ ** spans = NULL;
+  int * spans_n = NULL,
+        converted_tiles = 0;
+  int32_t cache_tiles = 0;
+  uint32_t image_key = 2166136261u;
+  int input_width = 0, input_height = 0,
+      start_x = 0, start_y = 0;
 
   image = (oyImage_s*)oyFilterSocket_GetData( socket );
   image_input = oyFilterPlug_ResolveImage( plug, socket, ticket );
 
+  /* cached tiles depend on the source pixels; the application tells about
+   * changes with a "image_revision" tag on the input image */
+  oyOptions_FindInt( node_options, "cache_tiles", 0, &cache_tiles );
+  if(cache_tiles && image_input)
+  {
+    oyOptions_s * tags = oyImage_GetTags( image_input );
+    int32_t ids[2] = { oyStruct_GetId( (oyStruct_s*)image_input ), 0 };
+    intptr_t ptr = (intptr_t)image_input;
+
+    oyOptions_FindInt( tags, "image_revision", 0, &ids[1] );
+    image_key = oydiHash_( image_key, ids, sizeof(ids) );
+    image_key = oydiHash_( image_key, &ptr, sizeof(ptr) );
+    input_width = oyImage_GetWidth( image_input );
+    input_height = oyImage_GetHeight( image_input );
+    oyOptions_Release( &tags );
+  }
+
   if(!image_input)
   {
     oydi_msg( oyMSG_WARN, (oyStruct_s*)ticket, 
@@ -831,11 +1243,54 @@ int      oydiFilterPlug_ImageDisplayRun(oyFilterPlug_s   * requestor_plug,
       goto clean2;
     }
 
+    /* the tile caches depend on the input image, the output image revision
+     * and the transforms; a moved view keeps them */
+    if(cache_tiles)
+    {
+      spans = (oyRectangle_s_**) oyAllocateFunc_( n * sizeof(oyRectangle_s_*) );
+      spans_n = (int*) oyAllocateFunc_( n * sizeof(int) );
+    } else
+    {
+      oydiOptionsReleaseType_( node_options, "//" OY_TYPE_STD "/display/tile_cache" );
+      oydiOptionsReleaseType_( node_options, "//" OY_TYPE_STD "/display/tile_origin" );
+    }
+    if(spans && spans_n)
+    {
+      oyImage_s * output_image = oyPixelAccess_GetOutputImage( ticket );
+      oyOptions_s * tags = oyImage_GetTags( image );
+      oyRectangle_s_ t_roi_pix_ = {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0};
+      oyRectangle_s * t_roi_pix = (oyRectangle_s*)&t_roi_pix_;
+      int output_width = oyImage_GetWidth( output_image );
+      int32_t ids[2] = { oyStruct_GetId( (oyStruct_s*)image ), 0 };
+
+      oyOptions_FindInt( tags, "image_revision", 0, &ids[1] );
+      image_key = oydiHash_( image_key, ids, sizeof(ids) );
+
+      /* start is relative to the output image width */
+      start_x = OY_ROUND( oyPixelAccess_GetStart( ticket, 0 ) * output_width );
+      start_y = OY_ROUND( oyPixelAccess_GetStart( ticket, 1 ) * output_width );
+      oyPixelAccess_RoiToPixels( ticket, NULL, &t_roi_pix );
+      oydiTileCacheScroll_( &node_options, ticket,
+                            oyImage_GetPixelLayout( image, oyCHANS ),
+                            start_x - OY_ROUND(t_roi_pix_.x),
+                            start_y - OY_ROUND(t_roi_pix_.y) );
+
+      for(i = 0; i < n; ++i)
+      {
+        spans[i] = NULL;
+        spans_n[i] = -1;
+      }
+
+      oyOptions_Release( &tags );
+      oyImage_Release( &output_image );
+    }
+
     /* process all display rectangles */
     if(error <= 0)
     for(i = 0; i < n; ++i)
     {
       oyOptions_s * f_options = NULL;
+      uint32_t transform_key = 0;
 
       c = oyConfigs_Get( devices, i );
 
@@ -896,6 +1351,13 @@ int      oydiFilterPlug_ImageDisplayRun(oyFilterPlug_s   * requestor_plug,
         /* obtain filter options */
         f_options = oyFilterNode_GetOptions( node, flags );
 
+        /* the context hash text of the monitors CMM node */
+        {
+          const char * t = oyFilterNode_GetText( node, oyNAME_NAME );
+          if(t)
+            transform_key = oydiHash_( image_key, t, strlen(t) );
+        }
+
         oyFilterNode_Release( &node );
       }
       if(!image_input)
@@ -1056,6 +1518,20 @@ int      oydiFilterPlug_ImageDisplayRun(oyFilterPlug_s   * requestor_plug,
         }
       }
 
+      /* select the tiles to convert */
+      if(!dirty && spans && spans_n && transform_key && image && width != 0)
+      {
+        uint32_t key = oydiHash_( transform_key, &display_white_point,
+                                  sizeof(display_white_point) );
+        image_tags = oyImage_GetTags( image );
+        converted_tiles += oydiTileCacheSelect_( &node_options, i, key,
+                                                 input_width, input_height,
+                                                 &roi_pix, start_x, start_y,
+                                                 image_tags,
+                                                 &spans[i], &spans_n[i] );
+        oyOptions_Release( &image_tags );
+      }
+
       oyProfile_Release( &p );
       oyConfig_Release( &c );
       oyImage_Release( &image_input );
@@ -1064,11 +1540,13 @@ int      oydiFilterPlug_ImageDisplayRun(oyFilterPlug_s   * requestor_plug,
 
     clean2:
     oyConfigs_Release( &devices );
-    oyOptions_Release( &rectangles_options );
 
     /* stop here and request an update */
     if(dirty > 0)
     {
+      /* converted tiles are outdated with the changed transforms */
+      oydiOptionsReleaseType_( node_options, "//" OY_TYPE_STD "/display/tile_cache" );
+      oydiOptionsReleaseType_( node_options, "//" OY_TYPE_STD "/display/tile_origin" );
       oyFilterNode_Release( &rectangles );
       result = dirty;
       goto clean;
@@ -1079,13 +1557,36 @@ int      oydiFilterPlug_ImageDisplayRun(oyFilterPlug_s   * requestor_plug,
     if(!dirty)
     {
       plug = oyFilterNode_GetPlug( node, 0 );
-      l_result = oyFilterNode_Run( rectangles, plug, ticket );
+      if(spans && spans_n)
+        l_result = oydiTilesRun_( rectangles, rectangles_options, plug, ticket,
+                                  n, spans, spans_n );
+      else
+        l_result = oyFilterNode_Run( rectangles, plug, ticket );
       if(l_result > 0 || result == 0) result = l_result;
       oyFilterPlug_Release( &plug );
+
+      /* the dirty regions are now converted */
+      image_tags = oyImage_GetTags( image );
+      oydiOptionsReleaseType_( image_tags, "//" OY_TYPE_STD "/display/dirty_rectangle" );
+      oyOptions_Release( &image_tags );
+      if(spans && spans_n)
+        oyOptions_SetFromInt( &node_options,
+                              "//" OY_TYPE_STD "/display/converted_tiles",
+                              converted_tiles, 0, OY_CREATE_NEW );
+      else
+        oydiOptionsReleaseType_( node_options, "//" OY_TYPE_STD "/display/converted_tiles" );
     }
   }
 
   clean:
+  if(spans)
+  {
+    for(i = 0; i < n; ++i)
+      if(spans[i]) oyDeAllocateFunc_( spans[i] );
+    oyDeAllocateFunc_( spans );
+  }
+  if(spans_n) oyDeAllocateFunc_( spans_n );
+  oyOptions_Release( &rectangles_options );
   oyFilterNode_Release( &rectangles );
   oyFilterPlug_Release( &plug );
   oyFilterSocket_Release( &socket );
@@ -1399,7 +1900,7 @@ const char * oydiGetText             ( const char        * select,
     else if(type == oyNAME_NAME)
       return _("The \"display\" filter supports applications to show image content on single and multi monitor displays. It cares about the server communication in declaring the region as prematched. So a X11 server side color correction does not disturb the displayed colors and omits the provided rectangle. The \"display\" filter matches the provided image content to each monitor it can find. Of course this has limitations to distorted windows, like wobbly effects or matrix deformed windows.");
     else
-      return _("The filter needs some informations attached to the output image tags of the \"output\" image filter. The following list describes the X11/Xorg requirements.\n A \"window_id\" option shall consist of a oyBlob_s object containing the X11 \"Window\" type in its pointer element.\n A \"display_id\" option shall consist of a oyBlob_s object containing the X11 \"Display\" of the application. This is typically exposed as system specific pointer by each individual toolkit.\n A \"display_rectangle\" option of type oyRectangle_s shall represent the application image region in pixel of the absolute display coordinates. \n In the \"datatype\" option, a oyDATATYPE_e encoded as integer is expected, to deliver that data type in a not yet allocated output image. The output data type is by default not changed. A newly not yet allocated output image will be stored as processing data in the socket.\n \"preserve_alpha\" is a integer option to keep a given alpha in a not yet allocated output image. \
+      return _("The filter needs some informations attached to the output image tags of the \"output\" image filter. The following list describes the X11/Xorg requirements.\n A \"window_id\" option shall consist of a oyBlob_s object containing the X11 \"Window\" type in its pointer element.\n A \"display_id\" option shall consist of a oyBlob_s object containing the X11 \"Display\" of the application. This is typically exposed as system specific pointer by each individual toolkit.\n A \"display_rectangle\" option of type oyRectangle_s shall represent the application image region in pixel of the absolute display coordinates. \n In the \"datatype\" option, a oyDATATYPE_e encoded as integer is expected, to deliver that data type in a not yet allocated output image. The output data type is by default not changed. A newly not yet allocated output image will be stored as processing data in the socket.\n \"preserve_alpha\" is a integer option to keep a given alpha in a not yet allocated output image.\n With the integer \"cache_tiles\" node option set to 1, the filter remembers converted tiles per monitor and converts only the outdated ones again. The tiles are placed in input image pixels; a changed ticket start moves the output array content along and converts only the newly exposed area. The application shall then increase the integer \"image_revision\" tag of the input image with each pixel change; it invalidates all tiles, as does the same tag on the output image. Each \"dirty_rectangle\" option of type oyRectangle_s in the output image tags marks a changed area in output image pixels and limits the next conversion to it. It is removed after conversion. The \"converted_tiles\" integer in the node options tells about the last run. \
 ");
   }
   return 0;
@@ -91,5 +91,6 @@ oyCMMapi_s * oyraApi7ImageChannelCreate(void);
 oyCMMapi_s * oyraApi4ImageExposeCreate(void);
 oyCMMapi_s * oyraApi7ImageExposeCreate(void);
 extern oyCMMapi10_s_  oyra_api10_profile_graph2d_SaturationLine;
+extern oyCMMapi10_s_  oyra_api10_profile_graph3d_Gamut;
 
 #endif /* OYRANOS_CMM_OYRA_H */
@@ -41,17 +41,16 @@
 
 /* OY_IMAGE_EXPOSE_REGISTRATION ----------------------------------------------*/
 
-void     oySensibleClip ( double * c, icColorSpaceSignature sig, int range_max, double expose )
+/* expose the first n channels of one pixel with hue preserving clipping */
+static void oyraSensibleClipN_       ( double            * c,
+                                       int                 n,
+                                       int                 range_max,
+                                       double              expose )
 {
   int max = 0, max_pos = 0,
       mid, mid_pos,
       min = range_max, min_pos = 0,
-      i,
-      n = oyICCColorSpaceGetChannelCount(sig);
-
-  if(sig == icSigLabData ||
-     sig == icSigYCbCrData)
-    n = 1;
+      i;
 
   for(i = 0; i < n; ++i)
   {
@@ -83,10 +82,211 @@ void     oySensibleClip ( double * c, icColorSpaceSignature sig, int range_max,
   }
 }
 
+static int oyraSensibleClipChannels_ ( icColorSpaceSignature sig )
+{
+  if(sig == icSigLabData ||
+     sig == icSigYCbCrData)
+    return 1;
+  return oyICCColorSpaceGetChannelCount(sig);
+}
+
+void     oySensibleClip ( double * c, icColorSpaceSignature sig, int range_max, double expose )
+{
+  oyraSensibleClipN_( c, oyraSensibleClipChannels_(sig), range_max, expose );
+}
+
+/* inline variants of oyByteSwapUInt16/32 to keep the inner loops vectorisable */
+#define oyraSwap16_m(v) ((uint16_t)(((uint16_t)(v) << 8) | ((uint16_t)(v) >> 8)))
+#define oyraSwap32_m(v) ((uint32_t)((((uint32_t)(v) & 0x000000ffu) << 24) | \
+                                    (((uint32_t)(v) & 0x0000ff00u) << 8)  | \
+                                    (((uint32_t)(v) & 0x00ff0000u) >> 8)  | \
+                                    (((uint32_t)(v) & 0xff000000u) >> 24)))
+
+#if defined(_OPENMP) && _OPENMP >= 201307
+#define OYRA_PRAGMA_SIMD _Pragma("omp simd")
+#else
+#define OYRA_PRAGMA_SIMD
+#endif
+
+/** @internal
+ *  @brief   row kernel signature for the expose filter
+ *
+ *  @param   row                       start of the pixel row
+ *  @param   start_x                   first pixel to process
+ *  @param   w                         pixel count in row
+ *  @param   channels                  samples per pixel
+ *  @param   n                         color channels for hue preserving
+ *                                     clipping; 0 for plain scaling
+ *  @param   range_max                 maximum integer value of the data type
+ *  @param   expose                    the exposure factor
+ *  @param   byte_swap                 non host byte order
+ */
+typedef void (*oyraExposeRow_f)      ( uint8_t           * row,
+                                       int                 start_x,
+                                       int                 w,
+                                       int                 channels,
+                                       int                 n,
+                                       int                 range_max,
+                                       double              expose,
+                                       int                 byte_swap );
+
+/* color aware kernels: specialised sample access, one clip per pixel */
+#define OYRA_EXPOSE_CLIP_ROW( name, type, load, store ) \
+static void name                     ( uint8_t           * row, \
+                                       int                 start_x, \
+                                       int                 w, \
+                                       int                 channels, \
+                                       int                 n, \
+                                       int                 range_max, \
+                                       double              expose, \
+                                       int                 byte_swap ) \
+{ \
+  type * p = (type*) row; \
+  double c[3]; \
+  int x, i; \
+  (void)byte_swap; \
+  for(x = start_x; x < w; ++x) \
+  { \
+    type * pixel = &p[x*channels]; \
+    for(i = 0; i < n; ++i) \
+      c[i] = load(pixel[i]); \
+    oyraSensibleClipN_( c, n, range_max, expose ); \
+    for(i = 0; i < n; ++i) \
+      pixel[i] = store(c[i]); \
+  } \
+}
+
+#define oyraLoad_m(v) (v)
+#define oyraLoadU16_m(v) (byte_swap ? oyraSwap16_m(v) : (v))
+#define oyraLoadU32_m(v) (byte_swap ? oyraSwap32_m(v) : (v))
+#define oyraStoreU8_m(v) ((uint8_t)(v))
+#define oyraStoreU16_m(v) (byte_swap ? oyraSwap16_m((uint16_t)(v)) : (uint16_t)(v))
+#define oyraStoreU32_m(v) (byte_swap ? oyraSwap32_m((uint32_t)(v)) : (uint32_t)(v))
+#define oyraStoreHalf_m(v) ((uint16_t)(v))
+#define oyraStoreFloat_m(v) ((float)(v))
+#define oyraStoreDouble_m(v) (v)
+
+OYRA_EXPOSE_CLIP_ROW( oyraExposeClipRowU8_,     uint8_t,  oyraLoad_m,    oyraStoreU8_m )
+OYRA_EXPOSE_CLIP_ROW( oyraExposeClipRowU16_,    uint16_t, oyraLoadU16_m, oyraStoreU16_m )
+OYRA_EXPOSE_CLIP_ROW( oyraExposeClipRowU32_,    uint32_t, oyraLoadU32_m, oyraStoreU32_m )
+/* oyHALF is handled as raw 16-bit sample like before */
+OYRA_EXPOSE_CLIP_ROW( oyraExposeClipRowHalf_,   uint16_t, oyraLoad_m,    oyraStoreHalf_m )
+OYRA_EXPOSE_CLIP_ROW( oyraExposeClipRowFloat_,  float,    oyraLoad_m,    oyraStoreFloat_m )
+OYRA_EXPOSE_CLIP_ROW( oyraExposeClipRowDouble_, double,   oyraLoad_m,    oyraStoreDouble_m )
+
+/* plain kernels: scale all samples of a row, no pixel dependency */
+static void oyraExposeRowU8_         ( uint8_t           * row,
+                                       int                 start_x,
+                                       int                 w,
+                                       int                 channels,
+                                       int                 n OY_UNUSED,
+                                       int                 range_max OY_UNUSED,
+                                       double              expose,
+                                       int                 byte_swap OY_UNUSED )
+{
+  uint8_t * p = row;
+  int i, end = w * channels;
+
+  OYRA_PRAGMA_SIMD
+  for(i = start_x * channels; i < end; ++i)
+  {
+    int v = p[i] * expose;
+    if(v > 255) v = 255;
+    p[i] = v;
+  }
+}
+
+static void oyraExposeRowU16_        ( uint8_t           * row,
+                                       int                 start_x,
+                                       int                 w,
+                                       int                 channels,
+                                       int                 n OY_UNUSED,
+                                       int                 range_max OY_UNUSED,
+                                       double              expose,
+                                       int                 byte_swap )
+{
+  uint16_t * p = (uint16_t*) row;
+  int i, end = w * channels;
+
+  if(byte_swap)
+  {
+    OYRA_PRAGMA_SIMD
+    for(i = start_x * channels; i < end; ++i)
+    {
+      int v = oyraSwap16_m(p[i]);
+      v *= expose;
+      if(v > 65535) v = 65535;
+      p[i] = oyraSwap16_m(v);
+    }
+  } else
+  {
+    OYRA_PRAGMA_SIMD
+    for(i = start_x * channels; i < end; ++i)
+    {
+      int v = p[i];
+      v *= expose;
+      if(v > 65535) v = 65535;
+      p[i] = v;
+    }
+  }
+}
+
+#define OYRA_EXPOSE_ROW( name, type ) \
+static void name                     ( uint8_t           * row, \
+                                       int                 start_x, \
+                                       int                 w, \
+                                       int                 channels, \
+                                       int                 n OY_UNUSED, \
+                                       int                 range_max OY_UNUSED, \
+                                       double              expose, \
+                                       int                 byte_swap OY_UNUSED ) \
+{ \
+  type * p = (type*) row; \
+  int i, end = w * channels; \
+  OYRA_PRAGMA_SIMD \
+  for(i = start_x * channels; i < end; ++i) \
+    p[i] *= expose; \
+}
+
+OYRA_EXPOSE_ROW( oyraExposeRowU32_,    uint32_t )
+OYRA_EXPOSE_ROW( oyraExposeRowHalf_,   uint16_t )
+OYRA_EXPOSE_ROW( oyraExposeRowFloat_,  float )
+OYRA_EXPOSE_ROW( oyraExposeRowDouble_, double )
+
+/** @internal
+ *  @brief   select a row kernel for data type and channel layout
+ *
+ *  @param   data_type                 the sample type
+ *  @param   clip                      use hue preserving clipping
+ *  @return                            the kernel or NULL for unsupported types
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/05
+ *  @since   2018/03/05 (Oyranos: 0.9.7)
+ */
+static oyraExposeRow_f oyraExposeRowGet_(
+                                       oyDATATYPE_e        data_type,
+                                       int                 clip )
+{
+  switch(data_type)
+  {
+    case oyUINT8:  return clip ? oyraExposeClipRowU8_     : oyraExposeRowU8_;
+    case oyUINT16: return clip ? oyraExposeClipRowU16_    : oyraExposeRowU16_;
+    case oyUINT32: return clip ? oyraExposeClipRowU32_    : oyraExposeRowU32_;
+    case oyHALF:   return clip ? oyraExposeClipRowHalf_   : oyraExposeRowHalf_;
+    case oyFLOAT:  return clip ? oyraExposeClipRowFloat_  : oyraExposeRowFloat_;
+    case oyDOUBLE: return clip ? oyraExposeClipRowDouble_ : oyraExposeRowDouble_;
+  }
+  return NULL;
+}
+
 /** @brief   implement oyCMMFilter_GetNext_f()
  *
- *  @version Oyranos: 0.9.6
- *  @date    2016/04/04
+ *  The samples are processed by data type specialised row kernels.
+ *  Rows are distributed over threads.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/05
  *  @since   2013/06/10 (Oyranos: 0.9.5)
  */
 int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
@@ -162,15 +362,15 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
       ticket_array_pix_width = oyArray2d_GetWidth( array_out ) / channels_dst;
 
       {
-        int w,h,x,y, i, start_x,start_y;
+        int w,h,y, start_x,start_y, n = 0;
         unsigned int max = 1;
+        oyraExposeRow_f kernel;
         oyRectangle_s * ticket_roi = oyPixelAccess_GetArrayROI( ticket );
         oyRectangle_s_  roi_= {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0};
         oyRectangle_s * roi = (oyRectangle_s*)&roi_;
         uint8_t ** array_out_data;
         /* get pixel layout infos for copying */
         oyDATATYPE_e data_type_out = oyToDataType_m( layout_dst );
-        int bps_out = oyDataTypeGetSize( data_type_out );
 
         /* get the source pixels */
         result = oyFilterNode_Run( input_node, plug, ticket );
@@ -193,125 +393,25 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
           default: break;
         }
 
+        /* color spaces with a lightness axis use hue preserving clipping */
+        if( (sig == icSigRgbData ||
+             sig == icSigXYZData ||
+             sig == icSigLabData ||
+             sig == icSigYCbCrData)
+            && channels_dst >= 3)
+          n = oyraSensibleClipChannels_( sig );
+        kernel = oyraExposeRowGet_( data_type_out, n );
+
         /* expose the samples */
+        if(kernel)
+        {
 #if defined(USE_OPENMP)
-#pragma omp parallel for private(x,y,i)
+#pragma omp parallel for private(y) if(h - start_y > 16)
 #endif
-        for(y = start_y; y < h; ++y)
-        {
-          for(x = start_x; x < w; ++x)
-          {
-            if( (sig == icSigRgbData ||
-                 sig == icSigXYZData ||
-                 sig == icSigLabData ||
-                 sig == icSigYCbCrData)
-                && channels_dst >= 3)
-            {
-              double rgb[3], v;
-
-              for(i = 0; i < 3; ++i)
-              {
-                switch(data_type_out)
-                {
-                case oyUINT8:
-                  rgb[i] = array_out_data[y][x*channels_dst*bps_out + i*bps_out];
-                  break;
-                case oyUINT16:
-                  {
-                  uint16_t v = *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
-                  if(byte_swap) v = oyByteSwapUInt16(v);
-                  rgb[i] = v;
-                  }
-                  break;
-                case oyUINT32:
-                  {
-                  uint32_t v = *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
-                  if(byte_swap) v = oyByteSwapUInt32(v);
-                  rgb[i] = v;
-                  }
-                  break;
-                case oyHALF:
-                  v = *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
-                  rgb[i] = v;
-                  break;
-                case oyFLOAT:
-                  v = *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
-                  rgb[i] = v;
-                  break;
-                case oyDOUBLE:
-                  v = *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
-                  rgb[i] = v;
-                  break;
-                }
-              }
-
-              oySensibleClip ( rgb, sig, max, expose );
-
-              for(i = 0; i < 3; ++i)
-              {
-                v = rgb[i];
-                switch(data_type_out)
-                {
-                case oyUINT8:
-                  array_out_data[y][x*channels_dst*bps_out + i*bps_out] = v;
-                  break;
-                case oyUINT16:
-                  { uint16_t u16 = v;
-                  *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = byte_swap ? oyByteSwapUInt16(u16) : u16;
-                  }
-                  break;
-                case oyUINT32:
-                  { uint32_t u32 = v;
-                  *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = byte_swap ? oyByteSwapUInt16(u32) : u32;
-                  }
-                  break;
-                case oyHALF:
-                  *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = v;
-                  break;
-                case oyFLOAT:
-                  *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = v;
-                  break;
-                case oyDOUBLE:
-                  *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = v;
-                  break;
-                }
-              }
-            }
-            else
-            for(i = 0; i < channels_dst; ++i)
-            {
-              int v;
-              switch(data_type_out)
-              {
-              case oyUINT8:
-                v = array_out_data[y][x*channels_dst*bps_out + i*bps_out] * expose;
-                if(v > 255) v = 255;
-                array_out_data[y][x*channels_dst*bps_out + i*bps_out] = v;
-                break;
-              case oyUINT16:
-                v = *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
-                if(byte_swap) v = oyByteSwapUInt16(v);
-                v *= expose;
-                if(v > 65535) v = 65535;
-                *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = byte_swap ? oyByteSwapUInt16(v) : v;
-                break;
-              case oyUINT32:
-                *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
-                break;
-              case oyHALF:
-                 *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
-                break;
-              case oyFLOAT:
-                *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
-                break;
-              case oyDOUBLE:
-                *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
-                break;
-              }
-            }
-          }
+          for(y = start_y; y < h; ++y)
+            kernel( array_out_data[y], start_x, w, channels_dst, n, max,
+                    expose, byte_swap );
         }
-
       }
 
       oyArray2d_Release( &array_out );
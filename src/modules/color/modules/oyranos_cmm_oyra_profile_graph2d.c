@@ -307,6 +307,10 @@ int          oyraMOptions_Handle     ( oyOptions_s       * options,
 }
 
 const char *oyra_texts_graph2d_create[4] = {"can_handle", SAT_L_COMMAND, "help",0};
+oyCMMapi10Command_s oyra_commands_graph2d[2] = {
+  {SAT_L_COMMAND, oyraMOptions_Handle},
+  {0,0}
+};
 
 /**
  *  This function implements oyCMMinfoGetText_f.
@@ -360,7 +364,7 @@ oyCMMapi10_s_    oyra_api10_profile_graph2d_SaturationLine = {
 
   oyOBJECT_CMM_API10_S,
   0,0,0,
-  (oyCMMapi_s*) NULL,
+  (oyCMMapi_s*) & oyra_api10_profile_graph3d_Gamut, /* next */
 
   oyraCMMInit, /* oyCMMInit_f */
   oyraCMMMessageFuncSet, /* oyCMMMessageFuncSet_f */
@@ -376,7 +380,8 @@ oyCMMapi10_s_    oyra_api10_profile_graph2d_SaturationLine = {
   oyraInfoGetTextGraph2D,             /**< getText */
   (char**)oyra_texts_graph2d_create,   /**<texts; list of arguments to getText*/
  
-  oyraMOptions_Handle                  /**< oyMOptions_Handle_f oyMOptions_Handle */
+  oyraMOptions_Handle,                 /**< oyMOptions_Handle_f oyMOptions_Handle */
+  oyra_commands_graph2d                /**< commands; dispatched directly */
 };
 
 /* ---------------------------------------------------------------------------*/
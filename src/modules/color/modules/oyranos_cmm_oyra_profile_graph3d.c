@@ -0,0 +1,608 @@
+/** @file oyranos_cmm_oyra_profile_graph3d.c
+ *
+ *  Oyranos is an open source Color Management System
+ *
+ *  @par Copyright:
+ *            2018 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    ICC profile graph 3D module for Oyranos
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            new BSD <http://www.opensource.org/licenses/BSD-3-Clause>
+ *  @since    2018/04/02
+ */
+
+#include "oyCMMapi10_s_.h"
+#include "oyCMMui_s.h"
+#include "oyConversion_s.h"
+#include "oyImage_s.h"
+
+#include "oyranos_alpha_internal.h"
+#include "oyranos_cmm.h"
+#include "oyranos_cmm_oyra.h"
+#include "oyranos_db.h"
+#include "oyranos_helper.h"
+#include "oyranos_i18n.h"
+#include "oyranos_string.h"
+
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+/* OY_PROFILE_GRAPH3D_GAMUT_REGISTRATION -------------------------------------*/
+
+#define HULL_COMMAND "gamut_hull"
+#define INTERSECTION_COMMAND "gamut_intersection"
+#define OY_PROFILE_GRAPH3D_GAMUT_REGISTRATION OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH "graph3d.gamut"
+
+/* grid steps per device cube edge */
+#define oyraHULL_PRECISION_DEFAULT 16
+/* pixels per line for the sample image; lines are converted in parallel */
+#define oyraHULL_LINE_WIDTH 32
+/* ray crossings per column, a folded hull has more than two */
+#define oyraHULL_CROSSINGS_MAX 64
+
+typedef struct {
+  int      vertices_n;
+  double * lab;                        /**< CIE*Lab, vertices_n * 3 */
+  int      triangles_n;
+  int    * triangles;                  /**< vertex indices, triangles_n * 3 */
+  double   volume;                     /**< CIE*Lab ΔE³ */
+} oyraGamutHull_s;
+
+static void  oyraGamutHullClear_     ( oyraGamutHull_s   * hull )
+{
+  if(hull->lab) free( hull->lab );
+  if(hull->triangles) free( hull->triangles );
+  memset( hull, 0, sizeof(oyraGamutHull_s) );
+}
+
+/* volume from the divergence theorem: the sum of signed tetrahedra spanned
+ * by each triangle and the hull center */
+static double oyraGamutHullVolume_   ( oyraGamutHull_s   * hull )
+{
+  double c[3] = {0,0,0}, volume = 0.0;
+  int i, j;
+
+  if(!hull->vertices_n)
+    return 0.0;
+
+  for(i = 0; i < hull->vertices_n; ++i)
+    for(j = 0; j < 3; ++j)
+      c[j] += hull->lab[i*3+j] / hull->vertices_n;
+
+  for(i = 0; i < hull->triangles_n; ++i)
+  {
+    const double * p0 = &hull->lab[hull->triangles[i*3+0]*3],
+                 * p1 = &hull->lab[hull->triangles[i*3+1]*3],
+                 * p2 = &hull->lab[hull->triangles[i*3+2]*3];
+    double a[3], b[3], d[3];
+    for(j = 0; j < 3; ++j)
+    {
+      a[j] = p0[j] - c[j];
+      b[j] = p1[j] - c[j];
+      d[j] = p2[j] - c[j];
+    }
+    volume += a[0] * (b[1]*d[2] - b[2]*d[1])
+            - a[1] * (b[0]*d[2] - b[2]*d[0])
+            + a[2] * (b[0]*d[1] - b[1]*d[0]);
+  }
+
+  /* the profile might mirror the device cube */
+  return fabs( volume / 6.0 );
+}
+
+/** @brief triangulated surface of the device cube in CIE*Lab
+ *
+ *  The surface grid of the device cube is converted in one transform.
+ *  CMYK spaces get K = min(C,M,Y), which reaches from paper white to the
+ *  full ink black.
+ */
+static int   oyraGamutHullCreate_    ( oyProfile_s       * profile,
+                                       int                 intent,
+                                       int                 steps,
+                                       oyraGamutHull_s   * hull )
+{
+  icColorSpaceSignature csp = (icColorSpaceSignature)
+                              oyProfile_GetSignature( profile,
+                                                      oySIGNATURE_COLOR_SPACE);
+  int channels = oyProfile_GetChannelsCount( profile );
+  int g = steps, g1 = steps + 1;
+  int * index = NULL;
+  double * block = NULL,
+         * lab_block = NULL;
+  int i, j, k, n = 0, width = oyraHULL_LINE_WIDTH, height, error = 0;
+  int face, side, u, v;
+
+  memset( hull, 0, sizeof(oyraGamutHull_s) );
+
+  if(!profile || g < 1)
+    return 1;
+
+  if(!(csp == icSigRgbData ||
+       csp == icSigXYZData ||
+       csp == icSigYCbCrData ||
+       csp == icSigCmykData ||
+       csp == icSigLabData) ||
+     !(channels == 3 || (channels == 4 && csp == icSigCmykData)))
+  {
+    oyra_msg( oyMSG_WARN, (oyStruct_s*)profile, OY_DBG_FORMAT_
+              "color space not supported: %s", OY_DBG_ARGS_,
+              oyICCColorSpaceGetName(csp) );
+    return 1;
+  }
+
+  /* number the grid points on the cube surface */
+  index = (int*) malloc( g1*g1*g1 * sizeof(int) );
+  if(!index) return 1;
+  for(i = 0; i < g1; ++i)
+    for(j = 0; j < g1; ++j)
+      for(k = 0; k < g1; ++k)
+      {
+        int surface = i == 0 || i == g || j == 0 || j == g || k == 0 || k == g;
+        index[(i*g1 + j)*g1 + k] = surface ? n++ : -1;
+      }
+
+  height = (n + width - 1) / width;
+  block = (double*) calloc( width * height * channels, sizeof(double) );
+  lab_block = (double*) calloc( width * height * 3, sizeof(double) );
+  hull->lab = (double*) calloc( n * 3, sizeof(double) );
+  hull->triangles = (int*) malloc( 6 * 2 * g*g * 3 * sizeof(int) );
+  if(!block || !lab_block || !hull->lab || !hull->triangles)
+  {
+    error = 1;
+    goto Clean;
+  }
+
+  for(i = 0; i < g1; ++i)
+    for(j = 0; j < g1; ++j)
+      for(k = 0; k < g1; ++k)
+      {
+        int pos = index[(i*g1 + j)*g1 + k];
+        double * p;
+        if(pos < 0) continue;
+        p = &block[pos * channels];
+        p[0] = (double)i / g;
+        p[1] = (double)j / g;
+        p[2] = (double)k / g;
+        if(channels == 4)
+          p[3] = (double)OY_MIN( OY_MIN(i, j), k ) / g;
+      }
+
+  /* one transform for all samples; the CMM spreads the lines over threads */
+  {
+    oyProfile_s * lab = oyProfile_FromStd( oyASSUMED_LAB, 0, NULL );
+    oyImage_s * in  = oyImage_Create( width, height, block,
+                                      oyChannels_m(channels) |
+                                      oyDataType_m(oyDOUBLE),
+                                      profile, 0 ),
+              * out = oyImage_Create( width, height, lab_block,
+                                      oyChannels_m(3) | oyDataType_m(oyDOUBLE),
+                                      lab, 0 );
+    oyOptions_s * options = NULL;
+    oyConversion_s * cc;
+    char num[24];
+
+    sprintf( num, "%d", intent );
+    oyOptions_SetFromString( &options, OY_BEHAVIOUR_STD OY_SLASH "rendering_intent",
+                             num, OY_CREATE_NEW );
+    cc = oyConversion_CreateBasicPixels( in, out, options, 0 );
+    if(cc)
+      error = oyConversion_RunPixels( cc, 0 );
+    else
+      error = 1;
+
+    oyConversion_Release( &cc );
+    oyOptions_Release( &options );
+    oyImage_Release( &in );
+    oyImage_Release( &out );
+    oyProfile_Release( &lab );
+    if(error > 0) goto Clean;
+  }
+
+  /* PCS Lab range of 0-1 to CIE*Lab */
+  for(i = 0; i < n; ++i)
+  {
+    hull->lab[i*3+0] = lab_block[i*3+0] * 100.0;
+    hull->lab[i*3+1] = lab_block[i*3+1] * 257.0 - 128.0;
+    hull->lab[i*3+2] = lab_block[i*3+2] * 257.0 - 128.0;
+  }
+  hull->vertices_n = n;
+
+  /* two triangles per grid cell, wound outward in device space */
+  for(face = 0; face < 3; ++face)
+  for(side = 0; side < 2; ++side)
+    for(u = 0; u < g; ++u)
+      for(v = 0; v < g; ++v)
+      {
+        int c[4], q;
+        for(q = 0; q < 4; ++q)
+        {
+          int p[3];
+          p[face]       = side * g;
+          p[(face+1)%3] = u + (q == 1 || q == 2);
+          p[(face+2)%3] = v + (q >= 2);
+          c[q] = index[(p[0]*g1 + p[1])*g1 + p[2]];
+        }
+        if(side)
+        {
+          int t[6] = { c[0],c[1],c[2], c[0],c[2],c[3] };
+          memcpy( &hull->triangles[hull->triangles_n*3], t, sizeof(t) );
+        } else
+        {
+          int t[6] = { c[0],c[2],c[1], c[0],c[3],c[2] };
+          memcpy( &hull->triangles[hull->triangles_n*3], t, sizeof(t) );
+        }
+        hull->triangles_n += 2;
+      }
+
+  hull->volume = oyraGamutHullVolume_( hull );
+
+  if(oy_debug)
+    oyra_msg( oyMSG_DBG, (oyStruct_s*)profile, OY_DBG_FORMAT_
+              "%s vertices: %d triangles: %d volume: %g", OY_DBG_ARGS_,
+              oyICCColorSpaceGetName(csp), hull->vertices_n,
+              hull->triangles_n, hull->volume );
+
+Clean:
+  if(index) free( index );
+  if(block) free( block );
+  if(lab_block) free( lab_block );
+  if(error > 0)
+    oyraGamutHullClear_( hull );
+  return error > 0 ? error : 0;
+}
+
+static int oyraCompareDouble_( const void * a, const void * b )
+{
+  double da = *(const double*)a, db = *(const double*)b;
+  return (da > db) - (da < db);
+}
+
+/* sorted CIE*L positions where the hull surface crosses the column a/b */
+static int   oyraGamutHullCrossings_ ( oyraGamutHull_s   * hull,
+                                       double              a,
+                                       double              b,
+                                       double            * z )
+{
+  int i, n = 0;
+
+  for(i = 0; i < hull->triangles_n && n < oyraHULL_CROSSINGS_MAX; ++i)
+  {
+    const double * p0 = &hull->lab[hull->triangles[i*3+0]*3],
+                 * p1 = &hull->lab[hull->triangles[i*3+1]*3],
+                 * p2 = &hull->lab[hull->triangles[i*3+2]*3];
+    double d, w1, w2;
+
+    if((a < p0[1] && a < p1[1] && a < p2[1]) ||
+       (a > p0[1] && a > p1[1] && a > p2[1]) ||
+       (b < p0[2] && b < p1[2] && b < p2[2]) ||
+       (b > p0[2] && b > p1[2] && b > p2[2]))
+      continue;
+
+    d = (p1[1]-p0[1]) * (p2[2]-p0[2]) - (p2[1]-p0[1]) * (p1[2]-p0[2]);
+    if(fabs(d) < 1e-12)
+      continue;
+    w1 = ((a-p0[1]) * (p2[2]-p0[2]) - (p2[1]-p0[1]) * (b-p0[2])) / d;
+    w2 = ((p1[1]-p0[1]) * (b-p0[2]) - (a-p0[1]) * (p1[2]-p0[2])) / d;
+    if(w1 < 0.0 || w2 < 0.0 || w1 + w2 >= 1.0)
+      continue;
+
+    z[n++] = p0[0] + w1 * (p1[0]-p0[0]) + w2 * (p2[0]-p0[0]);
+  }
+
+  qsort( z, n, sizeof(double), oyraCompareDouble_ );
+  /* an odd count comes from a grazing ray */
+  return n & ~1;
+}
+
+/** @brief volume shared by two hulls
+ *
+ *  Both hulls are cut by CIE*L columns over the common a/b range. The
+ *  inside intervals of each column are intersected and summed up.
+ */
+static double oyraGamutHullsIntersect_(oyraGamutHull_s   * h1,
+                                       oyraGamutHull_s   * h2,
+                                       int                 steps )
+{
+  double min[2] = { 1e10, 1e10}, max[2] = {-1e10,-1e10},
+         da, db, volume = 0.0;
+  int i;
+
+  for(i = 0; i < h1->vertices_n; ++i)
+  {
+    min[0] = OY_MIN( min[0], h1->lab[i*3+1] );
+    max[0] = OY_MAX( max[0], h1->lab[i*3+1] );
+    min[1] = OY_MIN( min[1], h1->lab[i*3+2] );
+    max[1] = OY_MAX( max[1], h1->lab[i*3+2] );
+  }
+  {
+    double min2[2] = { 1e10, 1e10}, max2[2] = {-1e10,-1e10};
+    for(i = 0; i < h2->vertices_n; ++i)
+    {
+      min2[0] = OY_MIN( min2[0], h2->lab[i*3+1] );
+      max2[0] = OY_MAX( max2[0], h2->lab[i*3+1] );
+      min2[1] = OY_MIN( min2[1], h2->lab[i*3+2] );
+      max2[1] = OY_MAX( max2[1], h2->lab[i*3+2] );
+    }
+    for(i = 0; i < 2; ++i)
+    {
+      min[i] = OY_MAX( min[i], min2[i] );
+      max[i] = OY_MIN( max[i], max2[i] );
+    }
+  }
+  if(steps < 1 || max[0] <= min[0] || max[1] <= min[1])
+    return 0.0;
+
+  da = (max[0] - min[0]) / steps;
+  db = (max[1] - min[1]) / steps;
+
+#if defined(USE_OPENMP)
+#pragma omp parallel for reduction(+:volume) schedule(dynamic)
+#endif
+  for(i = 0; i < steps * steps; ++i)
+  {
+    double a = min[0] + (i % steps + 0.5) * da,
+           b = min[1] + (i / steps + 0.5) * db,
+           z1[oyraHULL_CROSSINGS_MAX], z2[oyraHULL_CROSSINGS_MAX],
+           length = 0.0;
+    int n1 = oyraGamutHullCrossings_( h1, a, b, z1 ),
+        n2 = oyraGamutHullCrossings_( h2, a, b, z2 ),
+        j1 = 0, j2 = 0;
+
+    while(j1 < n1 && j2 < n2)
+    {
+      double lo = OY_MAX( z1[j1], z2[j2] ),
+             hi = OY_MIN( z1[j1+1], z2[j2+1] );
+      if(hi > lo)
+        length += hi - lo;
+      if(z1[j1+1] < z2[j2+1])
+        j1 += 2;
+      else
+        j2 += 2;
+    }
+    volume += length * da * db;
+  }
+
+  return volume;
+}
+
+static int   oyraGraph3DGetArgs_     ( oyOptions_s       * options,
+                                       int32_t           * precision,
+                                       int32_t           * intent )
+{
+  *precision = oyraHULL_PRECISION_DEFAULT;
+  *intent = 1; /* relative colorimetric describes the device gamut */
+  oyOptions_FindInt( options, "precision", 0, precision );
+  oyOptions_FindInt( options, "rendering_intent", 0, intent );
+  if(*precision < 1 || *precision > 256)
+  {
+    oyra_msg( oyMSG_WARN, 0, OY_DBG_FORMAT_ "\"precision\" out of range: %d",
+              OY_DBG_ARGS_, *precision );
+    return 1;
+  }
+  return 0;
+}
+
+int          oyraMOptions_HandleHull ( oyOptions_s       * options,
+                                       oyOptions_s      ** result )
+{
+  oyProfile_s * in = (oyProfile_s*) oyOptions_GetType( options, -1,
+                             "icc_profile.input", oyOBJECT_PROFILE_S );
+  oyraGamutHull_s hull;
+  int32_t precision = 0, intent = 0;
+  int error = oyraGraph3DGetArgs_( options, &precision, &intent );
+
+  if(!in)
+  {
+    oyra_msg( oyMSG_WARN, 0, OY_DBG_FORMAT_ "missed \"icc_profile.input\" option:\n%s", OY_DBG_ARGS_,
+              oyOptions_GetText( options, oyNAME_NICK ) );
+    return 1;
+  }
+
+  if(!error)
+    error = oyraGamutHullCreate_( in, intent, precision, &hull );
+  if(!error)
+  {
+    oyOption_s * o;
+    int pos;
+
+    if(!*result)
+      *result = oyOptions_New(0);
+
+    /* the highest position first allocates each list only once */
+    o = oyOption_FromRegistration( OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH HULL_COMMAND ".output.lab.double._" CMM_NICK, 0 );
+    for(pos = hull.vertices_n * 3 - 1; pos >= 0; --pos)
+      oyOption_SetFromDouble( o, hull.lab[pos], pos, 0 );
+    oyOptions_MoveIn( *result, &o, -1 );
+
+    o = oyOption_FromRegistration( OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH HULL_COMMAND ".output.triangles.int._" CMM_NICK, 0 );
+    for(pos = hull.triangles_n * 3 - 1; pos >= 0; --pos)
+      oyOption_SetFromInt( o, hull.triangles[pos], pos, 0 );
+    oyOptions_MoveIn( *result, &o, -1 );
+
+    o = oyOption_FromRegistration( OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH HULL_COMMAND ".output.volume.double._" CMM_NICK, 0 );
+    oyOption_SetFromDouble( o, hull.volume, 0, 0 );
+    oyOptions_MoveIn( *result, &o, -1 );
+
+    oyraGamutHullClear_( &hull );
+  }
+
+  oyProfile_Release( &in );
+  return error;
+}
+
+int          oyraMOptions_HandleIntersection (
+                                       oyOptions_s       * options,
+                                       oyOptions_s      ** result )
+{
+  oyProfile_s * p1 = (oyProfile_s*) oyOptions_GetType( options, -1,
+                             "icc_profile.input", oyOBJECT_PROFILE_S ),
+              * p2 = (oyProfile_s*) oyOptions_GetType( options, -1,
+                             "icc_profile.input2", oyOBJECT_PROFILE_S );
+  oyraGamutHull_s h1, h2;
+  int32_t precision = 0, intent = 0;
+  int error = oyraGraph3DGetArgs_( options, &precision, &intent );
+
+  memset( &h1, 0, sizeof(h1) );
+  memset( &h2, 0, sizeof(h2) );
+
+  if(!p1 || !p2)
+  {
+    oyra_msg( oyMSG_WARN, 0, OY_DBG_FORMAT_ "missed \"icc_profile.input\" or \"icc_profile.input2\" option:\n%s", OY_DBG_ARGS_,
+              oyOptions_GetText( options, oyNAME_NICK ) );
+    error = 1;
+  }
+
+  if(!error)
+    error = oyraGamutHullCreate_( p1, intent, precision, &h1 );
+  if(!error)
+    error = oyraGamutHullCreate_( p2, intent, precision, &h2 );
+  if(!error)
+  {
+    oyOption_s * o = oyOption_FromRegistration( OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH INTERSECTION_COMMAND ".output.volume.double._" CMM_NICK, 0 );
+    /* columns are finer than the hull grid to keep the sampling error low */
+    double volume = oyraGamutHullsIntersect_( &h1, &h2, precision * 8 );
+
+    oyOption_SetFromDouble( o, h2.volume, 2, 0 );
+    oyOption_SetFromDouble( o, h1.volume, 1, 0 );
+    oyOption_SetFromDouble( o, volume, 0, 0 );
+    if(!*result)
+      *result = oyOptions_New(0);
+    oyOptions_MoveIn( *result, &o, -1 );
+  }
+
+  oyraGamutHullClear_( &h1 );
+  oyraGamutHullClear_( &h2 );
+  oyProfile_Release( &p1 );
+  oyProfile_Release( &p2 );
+  return error;
+}
+
+/* OY_PROFILE_GRAPH3D_GAMUT_REGISTRATION -------------------------------------*/
+
+/**
+ *  This function implements oyMOptions_Handle_f.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/02
+ *  @since   2018/04/02 (Oyranos: 0.9.7)
+ */
+int          oyraMOptions_HandleGraph3D (
+                                       oyOptions_s       * options,
+                                       const char        * command,
+                                       oyOptions_s      ** result )
+{
+  int error = 0;
+
+  if(oyFilterRegistrationMatch(command,"can_handle", 0))
+  {
+    oyra_msg( oyMSG_DBG, 0, "called %s()::can_handle", __func__ );
+    return error;
+  }
+  else if(oyFilterRegistrationMatch(command, HULL_COMMAND, 0))
+  {
+    error = oyraMOptions_HandleHull(options, result);
+    oyra_msg( error?oyMSG_WARN:oyMSG_DBG, 0, "called %s()::" HULL_COMMAND, __func__ );
+  }
+  else if(oyFilterRegistrationMatch(command, INTERSECTION_COMMAND, 0))
+  {
+    error = oyraMOptions_HandleIntersection(options, result);
+    oyra_msg( error?oyMSG_WARN:oyMSG_DBG, 0, "called %s()::" INTERSECTION_COMMAND, __func__ );
+  }
+
+  return error;
+}
+
+const char *oyra_texts_graph3d_create[5] = {"can_handle", HULL_COMMAND, INTERSECTION_COMMAND, "help",0};
+oyCMMapi10Command_s oyra_commands_graph3d[3] = {
+  {HULL_COMMAND, oyraMOptions_HandleGraph3D},
+  {INTERSECTION_COMMAND, oyraMOptions_HandleGraph3D},
+  {0,0}
+};
+
+/**
+ *  This function implements oyCMMinfoGetText_f.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/02
+ *  @since   2018/04/02 (Oyranos: 0.9.7)
+ */
+const char * oyraInfoGetTextGraph3D  ( const char        * select,
+                                       oyNAME_e            type,
+                                       oyStruct_s        * context OY_UNUSED )
+{
+         if(strcmp(select, "can_handle")==0)
+  {
+         if(type == oyNAME_NICK)
+      return "check";
+    else if(type == oyNAME_NAME)
+      return _("check");
+    else
+      return _("Check if this module can handle a certain command.");
+  } else if(strcmp(select, HULL_COMMAND)==0)
+  {
+         if(type == oyNAME_NICK)
+      return HULL_COMMAND;
+    else if(type == oyNAME_NAME)
+      return _("Compute a gamut hull.");
+    else
+      return _("The Oyranos \""HULL_COMMAND"\" command will return a triangulated gamut hull in CIE*Lab and its volume.");
+  } else if(strcmp(select, INTERSECTION_COMMAND)==0)
+  {
+         if(type == oyNAME_NICK)
+      return INTERSECTION_COMMAND;
+    else if(type == oyNAME_NAME)
+      return _("Compute a gamut intersection.");
+    else
+      return _("The Oyranos \""INTERSECTION_COMMAND"\" command will return the CIE*Lab volume shared by the gamuts of two profiles.");
+  } else if(strcmp(select, "help")==0)
+  {
+         if(type == oyNAME_NICK)
+      return "help";
+    else if(type == oyNAME_NAME)
+      return _("Compute gamut hulls and volumes.");
+    else
+      return _("The Oyranos \""HULL_COMMAND"\" command expects \"icc_profile.input\" as oyProfile_s for a Rgb, Cmyk, Lab, XYZ or YCbCr color space; \"precision\" as integer option for the grid steps per device cube edge, default 16, and \"rendering_intent\" as integer, default relative colorimetric. The result will contain \"gamut_hull.output.lab.double._oyra\" with CIE*Lab vertices, \"gamut_hull.output.triangles.int._oyra\" with three vertex indices per triangle and \"gamut_hull.output.volume.double._oyra\" in ΔE³. The \""INTERSECTION_COMMAND"\" command expects additionally \"icc_profile.input2\" and will return \"gamut_intersection.output.volume.double._oyra\" with the shared volume, the volume of the first and of the second profile.");
+  }
+  return 0;
+}
+
+
+/** @brief    oyra oyCMMapi10_s implementation
+ *
+ *  supplier for gamut hulls and volumes
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/02
+ *  @since   2018/04/02 (Oyranos: 0.9.7)
+ */
+oyCMMapi10_s_    oyra_api10_profile_graph3d_Gamut = {
+
+  oyOBJECT_CMM_API10_S,
+  0,0,0,
+  (oyCMMapi_s*) NULL,
+
+  oyraCMMInit, /* oyCMMInit_f */
+  oyraCMMMessageFuncSet, /* oyCMMMessageFuncSet_f */
+
+  OY_PROFILE_GRAPH3D_GAMUT_REGISTRATION,
+
+  CMM_VERSION, /* int32_t version[3] */
+  CMM_API_VERSION,                  /**< int32_t module_api[3] */
+  0,   /* id_; keep empty */
+  0,   /* api5_; keep empty */
+  0,   /* runtime_context */
+
+  oyraInfoGetTextGraph3D,             /**< getText */
+  (char**)oyra_texts_graph3d_create,   /**<texts; list of arguments to getText*/
+
+  oyraMOptions_HandleGraph3D,          /**< oyMOptions_Handle_f oyMOptions_Handle */
+  oyra_commands_graph3d                /**< commands; dispatched directly */
+};
+
+/* ---------------------------------------------------------------------------*/
@@ -695,7 +695,8 @@ oyCMMapi10_s_    trds_api10_cmm = {
   trdsInfoGetTextThreadsC,             /**< getText */
   (char**)trds_texts_profile_create,   /**<texts; list of arguments to getText*/
  
-  trdsMOptions_Handle                  /**< oyMOptions_Handle_f oyMOptions_Handle */
+  trdsMOptions_Handle,                 /**< oyMOptions_Handle_f oyMOptions_Handle */
+  NULL                                 /**< commands; none */
 };
 
 
@@ -7,3 +7,7 @@
   char          ** texts;              /**< zero terminated list for getText */
 
   oyMOptions_Handle_f oyMOptions_Handle; /**< @memberof oyCMMapi10_s */
+  /** zero terminated list of commands for direct dispatch; optional
+   *  Commands not listed here go through the "can_handle" probe.
+   */
+  oyCMMapi10Command_s * commands;
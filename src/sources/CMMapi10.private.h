@@ -42,3 +42,20 @@
 typedef int  (*oyMOptions_Handle_f)  ( oyOptions_s       * options,
                                        const char        * command,
                                        oyOptions_s      ** result );
+
+/** @struct  oyCMMapi10Command_s
+ *  @brief   a command with its direct handler
+ *  @ingroup module_api
+ *  @memberof oyCMMapi10_s
+ *
+ *  oyOptions_Handle() calls the handler of a declared command without the
+ *  "can_handle" probe. The handler checks the options itself.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2018/04/08 (Oyranos: 0.9.7)
+ *  @date    2018/04/08
+ */
+typedef struct {
+  const char        * command;         /**< e.g. "saturation_line" */
+  oyMOptions_Handle_f handler;         /**< the command handler */
+} oyCMMapi10Command_s;
@@ -1,2 +1,5 @@
   oyFilterNode_s_    * input;          /**< the input image filter; Most users will start logically with this pice and chain their filters to get the final result. */
   oyFilterNode_s_    * out_;           /**< @private the Oyranos output image. Oyranos will stream the filters starting from the end. This element will be asked on its first plug. */
+  oyFilterGraph_s    * graph_;         /**< @private compiled graph; tickets reference its nodes and edges */
+  oyPixelAccess_s    * tickets_[oyCONVERSION_TICKETS_MAX]; /**< @private recycled tickets */
+  int                  tickets_n_;     /**< @private number of recycled tickets */
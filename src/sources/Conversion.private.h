@@ -0,0 +1,3 @@
+/** @internal
+ *  @brief   recycled oyPixelAccess_s tickets kept per conversion */
+#define oyCONVERSION_TICKETS_MAX 8
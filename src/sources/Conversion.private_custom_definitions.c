@@ -22,6 +22,8 @@ void oyConversion_Release__Members( oyConversion_s_ * conversion )
    */
   oyFilterGraph_s * g = oyFilterGraph_New( 0 );
   int i,n;
+
+  oyConversion_DropTickets_( conversion );
   oyFilterGraph_SetFromNode( g, (oyFilterNode_s*)conversion->input, 0, 0 );
 
   oyFilterNode_Release( (oyFilterNode_s**)&conversion->input );
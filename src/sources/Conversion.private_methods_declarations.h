@@ -0,0 +1,2 @@
+void               oyConversion_DropTickets_ (
+                                       oyConversion_s_   * s );
@@ -0,0 +1,20 @@
+/** Function  oyConversion_DropTickets_
+ *  @memberof oyConversion_s
+ *  @brief    Release the compiled graph and the recycled tickets
+ *  @internal
+ *
+ *  Needed after the graph changed. The caller locks the object.
+ *
+ *  @param[in,out] s                   the conversion
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/22
+ *  @since   2018/03/22 (Oyranos: 0.9.7)
+ */
+void               oyConversion_DropTickets_ (
+                                       oyConversion_s_   * s )
+{
+  oyFilterGraph_Release( &s->graph_ );
+  while(s->tickets_n_)
+    oyPixelAccess_Release( &s->tickets_[--s->tickets_n_] );
+}
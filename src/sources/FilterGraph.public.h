@@ -0,0 +1,2 @@
+/** @brief   oyFilterGraph_PrepareContexts() flag to not use threads */
+#define oyFILTERGRAPH_PREPARE_SERIAL 0x02
@@ -3,6 +3,8 @@ int  oyFilterNode_AddToAdjacencyLst_ ( oyFilterNode_s_    * s,
                                        oyFilterPlugs_s_   * edges,
                                        const char         * mark,
                                        int                  flags );
+oyHash_s *   oyFilterNode_GetHash_   ( oyFilterNode_s_    * node,
+                                       int                  api );
 int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
                                        oyBlob_s_          * blob );
 oyStructList_s * oyFilterNode_GetData_(oyFilterNode_s_    * node,
@@ -263,7 +263,7 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
            */
 
 
-          if(oy_debug && getenv("OY_DEBUG_WRITE"))
+          if(oy_debug && oyEnvGetString(oyENV_DEBUG_WRITE))
           {
             size = 0;
             ptr = oyFilterNode_TextToInfo_( node, &size, oyAllocateFunc_ );
@@ -474,7 +474,7 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
                   node->backend_data = oyPointer_Copy( cmm_ptr4, 0 );
               }
 
-              if(oy_debug && getenv("OY_DEBUG_WRITE"))
+              if(oy_debug && oyEnvGetString(oyENV_DEBUG_WRITE))
               {
                 int id = oyFilterNode_GetId( (oyFilterNode_s*)node );
                 char * file_name = 0;
@@ -10,3 +10,8 @@ int        oyStruct_ObserverRemove_  ( oyStructList_s    * list,
                                        oyStruct_s        * obj,
                                        int                 observer,
                                        oyObserver_Signal_f signalFunc );
+int        oyStruct_ObserverListSignal_(
+                                       oyStruct_s        * model,
+                                       oyStructList_s    * observers,
+                                       oySIGNAL_e          signal_type,
+                                       oyStruct_s        * signal_data );
@@ -94,13 +94,16 @@ oyObserver_s * oyObserver_Copy_      ( oyObserver_s      * obj,
  *  @brief    Get the desired list of oyObserver_s'
  *  @internal
  *
+ *  The OY_SIGNAL_OBSERVERS list is additionally referenced in the objects
+ *  oyObject_s::observers_ slot for direct access.
+ *
  *  @param[in]     obj                 the object to look in for the list
  *  @param[in]     reg                 the selector for the list
  *  @return                            the observers
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/16
  *  @since   2009/11/02 (Oyranos: 0.1.10)
- *  @date    2009/11/02
  */
 oyStructList_s * oyStruct_ObserverListGet_(
                                        oyStruct_s        * obj,
@@ -110,6 +113,10 @@ oyStructList_s * oyStruct_ObserverListGet_(
   oyOption_s_ * o_ = 0;
   int error = 0;
   oyStructList_s * list = 0;
+  int observers = strcmp( reg, OY_SIGNAL_OBSERVERS ) == 0;
+
+  if(observers && obj->oy_->observers_)
+    return (oyStructList_s*) obj->oy_->observers_;
 
   o = oyOptions_Find( obj->oy_->handles_, reg, oyNAME_PATTERN );
 
@@ -133,8 +140,11 @@ oyStructList_s * oyStruct_ObserverListGet_(
   {
     if(o_->value->oy_struct &&
        o_->value->oy_struct->type_ == oyOBJECT_STRUCT_LIST_S)
+    {
       list = (oyStructList_s*)o_->value->oy_struct;
-    else
+      if(observers)
+        obj->oy_->observers_ = (oyStruct_s*) oyStructList_Copy( list, 0 );
+    } else
     {
       WARNcc3_S( obj, "%s: %s %s", _("found list of wrong type"),
                  reg,
@@ -185,3 +195,76 @@ int        oyStruct_ObserverRemove_  ( oyStructList_s    * list,
   }
   return error;
 }
+
+/** Function  oyStruct_ObserverListSignal_
+ *  @memberof oyObserver_s
+ *  @brief    Send a signal to a list of observers
+ *  @internal
+ *
+ *  @param[in]     model               the model
+ *  @param[in]     observers           the models OY_SIGNAL_OBSERVERS list
+ *  @param[in]     signal_type         the basic signal type to emit
+ *  @param[in,out] signal_data         the advanced signal information
+ *  @return                            number of reached observers
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/16
+ *  @since   2009/10/27 (Oyranos: 0.1.10)
+ */
+int        oyStruct_ObserverListSignal_(
+                                       oyStruct_s        * model,
+                                       oyStructList_s    * observers,
+                                       oySIGNAL_e          signal_type,
+                                       oyStruct_s        * signal_data )
+{
+  oyObserver_s * obs = 0;
+  int n,i, result = 0, t_err = 0;
+
+  n = oyStructList_Count( observers );
+  for(i = 0; i < n; ++i)
+  {
+    obs = (oyObserver_s*) oyStructList_GetType( observers,
+                                                i, oyOBJECT_OBSERVER_S );
+    if(obs)
+    {
+      if(obs->model == model)
+      {
+        if(oy_debug_signals)
+        {
+          WARNc6_S( "\n\t%s %s: %s[%d]->%s[%d]", _("Signal"),
+                  oySignalToString(signal_type),
+                  oyStruct_GetText( obs->model, oyNAME_NAME, 1),
+                  oyObject_GetId(   obs->model->oy_),
+                  oyStruct_GetText( obs->observer, oyNAME_NAME, 1),
+                  oyObject_GetId(   obs->observer->oy_) );
+        }
+        t_err = oyObserver_SignalSend( obs, signal_type, signal_data );
+        if(t_err)
+        {
+          DBG_NUM7_S( "oyObserver_SignalSend() returned %d\n\t%s %s: %s[%d]->%s[%d]",
+                  t_err, _("Signal"),
+                  oySignalToString(signal_type),
+                  oyStruct_GetText( obs->model, oyNAME_NAME, 1),
+                  oyObject_GetId(   obs->model->oy_),
+                  oyStruct_GetText( obs->observer, oyNAME_NAME, 1),
+                  oyObject_GetId(   obs->observer->oy_) );
+        }
+        ++result;
+      }
+      else
+      {
+        WARNc6_S( "\n\t%s %s: %s[%d]->%s[%d]",_("found observer of wrong type"),
+                  oySignalToString(signal_type),
+                  oyStruct_GetText( obs->model, oyNAME_NAME, 1),
+                  oyObject_GetId(   obs->model->oy_),
+                  oyStruct_GetText( obs->observer, oyNAME_NAME, 1),
+                  oyObject_GetId(   obs->observer->oy_) );
+      }
+    } else
+      WARNc3_S( "\n\t%s: oyObservers_s[%s]",_("found no observer"),
+                  oySignalToString(signal_type),
+                  oyStruct_TypeToText((oyStruct_s*)observers) );
+  }
+
+  return result;
+}
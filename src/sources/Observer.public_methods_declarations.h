@@ -19,6 +19,10 @@ OYAPI int  OYEXPORT
            oyStruct_DisableSignalSend( oyStruct_s        * model );
 OYAPI int  OYEXPORT
            oyStruct_EnableSignalSend ( oyStruct_s        * model );
+OYAPI int  OYEXPORT
+           oyStruct_SignalBatchBegin ( oyStruct_s        * model );
+OYAPI int  OYEXPORT
+           oyStruct_SignalBatchEnd   ( oyStruct_s        * model );
 OYAPI int  OYEXPORT
            oyStruct_ObserversCopy    ( oyStruct_s        * object,
                                        oyStruct_s        * pattern,
@@ -5,3 +5,5 @@
   oyValue_u          * value;          /**< the actual value */
   oyOPTIONSOURCE_e     source;         /**< the source of this value */
   uint32_t             flags;          /**< | oyOPTIONATTRIBUTE_e */
+  oyRegistration_s   * registration_c_;/**< @private tokenised registration for pattern matching */
+  char               * registration_old_;/**< @private the last replaced registration */
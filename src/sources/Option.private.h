@@ -0,0 +1 @@
+#include "oyranos_object_internal.h"
@@ -27,13 +27,16 @@ void oyOption_Release__Members( oyOption_s_ * option )
 
   if(option->oy_->deallocateFunc_)
   {
-    /*oyDeAlloc_f deallocateFunc = option->oy_->deallocateFunc_;*/
+    oyDeAlloc_f deallocateFunc = option->oy_->deallocateFunc_;
 
     /* Deallocate members of basic type here
      * E.g.: deallocateFunc( option->member );
      */
 
     oyOption_Clear( (oyOption_s*) option );
+    if(option->registration_old_)
+      deallocateFunc( option->registration_old_ );
+    option->registration_old_ = NULL;
   }
 }
 
@@ -58,6 +61,8 @@ int oyOption_Init__Members( oyOption_s_ * option )
 {
   option->id = oy_option_id_++;
   option->registration = NULL;
+  option->registration_c_ = NULL;
+  option->registration_old_ = NULL;
   option->value = NULL;
 
   return 0;
@@ -103,6 +108,8 @@ int oyOption_Copy__Members( oyOption_s_ * dst, oyOption_s_ * src)
    oyStruct_EnableSignalSend( (oyStruct_s*)dst );
 
    dst->registration = oyStringCopy_( src->registration, allocateFunc_ );
+   dst->registration_c_ = oyRegistrationCompileDefault_m( dst->registration,
+                                                          allocateFunc_ );
    dst->value_type = src->value_type;
    dst->value = allocateFunc_(sizeof(oyValue_u));
    memset(dst->value, 0, sizeof(oyValue_u));
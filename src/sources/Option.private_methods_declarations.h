@@ -13,3 +13,6 @@ int            oyOption_SetFromInt_  ( oyOption_s_       * obj,
                                        uint32_t            flags );
 int            oyOption_MoveInStruct_( oyOption_s_       * option,
                                        oyStruct_s       ** s );
+int            oyOption_MatchPattern_( oyOption_s_       * option,
+                                       const char        * pattern,
+                                       const oyRegistration_s * pattern_c );
@@ -436,3 +436,36 @@ int            oyOption_MoveInStruct_( oyOption_s_       * option,
 
   return error;
 }
+
+/**
+ *  @internal
+ *  Function oyOption_MatchPattern_
+ *  @memberof oyOption_s
+ *  @brief   match the option registration against a pattern
+ *
+ *  Gives the same result as oyFilterRegistrationMatch(). With the
+ *  compiled pattern, the options compiled registration is used and
+ *  avoids splitting both strings again for each option of a loop.
+ *
+ *  @param[in]     option              the option
+ *  @param[in]     pattern             the pattern string
+ *  @param[in]     pattern_c           optional pattern from
+ *                                     oyRegistrationCompileDefault_m()
+ *  @return                            match, useable for ranking
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/15
+ *  @since   2018/03/15 (Oyranos: 0.9.7)
+ */
+int            oyOption_MatchPattern_( oyOption_s_       * option,
+                                       const char        * pattern,
+                                       const oyRegistration_s * pattern_c )
+{
+  if(!option)
+    return 0;
+
+  if(pattern_c && option->registration_c_)
+    return oyRegistrationMatch_( option->registration_c_, pattern_c, 0, 0 );
+
+  return oyFilterRegistrationMatch( option->registration, pattern, 0 );
+}
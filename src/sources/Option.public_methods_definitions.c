@@ -550,6 +550,7 @@ int            oyOption_Clear        ( oyOption_s        * obj )
     if(s->registration)
       deallocateFunc( s->registration );
     s->registration = 0;
+    oyRegistrationRelease_( &s->registration_c_, deallocateFunc );
   }
 
   oyStruct_ObserverSignal( (oyStruct_s*)s, oySIGNAL_DATA_CHANGED, 0 );
@@ -702,13 +703,16 @@ oyPointer      oyOption_GetData      ( oyOption_s        * option,
  *  @memberof oyOption_s
  *  @brief   set the registration
  *
+ *  A string obtained from oyOption_GetRegistration() before stays valid
+ *  over one further registration change or until the option is released.
+ *
  *  @param[in]     option              the option
  *  @param[in]     registration        the option's registration and key name
  *  @return                            error
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/19
  *  @since   2009/01/24 (Oyranos: 0.1.10)
- *  @date    2009/01/24
  */
 int            oyOption_SetRegistration (
                                        oyOption_s        * option,
@@ -722,9 +726,23 @@ int            oyOption_SetRegistration (
 
   oyCheckType__m( oyOBJECT_OPTION_S, return 1 )
 
-  if(registration)
-    s->registration = oyStringCopy_( registration,
-                                     s->oy_->allocateFunc_ );
+  if(registration &&
+     !(s->registration && strcmp( s->registration, registration ) == 0))
+  {
+    /* registration might point into the old string */
+    char * old = s->registration;
+    oyAlloc_f allocateFunc = s->oy_->allocateFunc_;
+    oyDeAlloc_f deallocateFunc = s->oy_->deallocateFunc_;
+
+    oyRegistrationRelease_( &s->registration_c_, deallocateFunc );
+    s->registration = oyStringCopy_( registration, allocateFunc );
+    s->registration_c_ = oyRegistrationCompileDefault_m( s->registration,
+                                                         allocateFunc );
+    /* a oyOption_GetRegistration() result stays valid over one change */
+    if(s->registration_old_ && deallocateFunc)
+      deallocateFunc( s->registration_old_ );
+    s->registration_old_ = old;
+  }
 
   return error;
 }
@@ -0,0 +1,6 @@
+int                oyPixelAccess_Init_(oyPixelAccess_s_  * s,
+                                       int32_t             start_x,
+                                       int32_t             start_y,
+                                       oyFilterPlug_s    * plug,
+                                       oyPIXEL_ACCESS_TYPE_e type );
+void               oyPixelAccess_Reset_(oyPixelAccess_s_ * s );
@@ -101,11 +101,14 @@ int                oyPixelAccess_ArrayIsFocussed (
                                          oyPIXEL_ACCESS_IMAGE, 0 );
     @endcode
  *
+ *  Each call builds a own graph. oyConversion_GetTicket() reuses a
+ *  compiled graph and recycled tickets for repeated requests.
+ *
  *  @see oyPixelAccess_SetOutputImage() and oyPixelAccess_SetArray()
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
  *  @since   2008/07/07 (Oyranos: 0.1.8)
- *  @date    2009/06/10
+ *  @date    2018/03/22
  */
 oyPixelAccess_s *  oyPixelAccess_Create (
                                        int32_t             start_x,
@@ -115,68 +118,11 @@ oyPixelAccess_s *  oyPixelAccess_Create (
                                        oyObject_s          object )
 {
   oyPixelAccess_s_ * s = (oyPixelAccess_s_*)oyPixelAccess_New( object );
-  oyFilterSocket_s_ * sock = 0;
-  oyFilterPlug_s_ ** plug_ = (oyFilterPlug_s_**)&plug;
-  int error = !s || !plug || !(*plug_)->remote_socket_;
-  int w = 0;
-  oyImage_s * image = 0;
-  int32_t n = 0;
+  int error = oyPixelAccess_Init_( s, start_x, start_y, plug, type );
 
   if(error <= 0)
-  {
-    sock = (*plug_)->remote_socket_;
-    image = (oyImage_s*)sock->data;
-
-    s->start_xy[0] = s->start_xy_old[0] = start_x;
-    s->start_xy[1] = s->start_xy_old[1] = start_y;
-
-    /* make shure the filter->image_ is set, e.g.
-       error = oyFilterCore_ImageSet ( filter, image );
-
-    s->data_in = filter->image_->data; */
-    if(image)
-      w = oyImage_GetWidth( image );
-
-    /** The filters have no obligation to pass end to end informations.
-        The ticket must hold all pices of interesst.
-     */
-    s->output_array_roi->width = 1.0;
-    if(image && w)
-      s->output_array_roi->height = oyImage_GetHeight( image ) / (double)w;
-    s->output_image = oyImage_Copy( image, 0 );
-    s->graph = (oyFilterGraph_s_*)oyFilterGraph_FromNode( (oyFilterNode_s*)sock->node, 0 );
-
-    if(type == oyPIXEL_ACCESS_POINT)
-    {
-      s->array_xy = s->oy_->allocateFunc_(sizeof(int32_t) * 2);
-      s->array_xy[0] = s->array_xy[1] = 0;
-      s->array_n = 1;
-      s->pixels_n = 1;
-    } else
-    if(type == oyPIXEL_ACCESS_LINE)
-    {
-      s->array_xy = s->oy_->allocateFunc_(sizeof(int32_t) * 2);
-      /* set relative advancements from one pixel to the next */
-      s->array_xy[0] = 1;
-      s->array_xy[1] = 0;
-      s->array_n = 1;
-      s->pixels_n = w;       /* the total we want */
-    } else
-    /* if(type == oyPIXEL_ACCESS_IMAGE) */
-    {
-      /** @todo how can we know about the various module capabilities
-       *  - back report the processed number of pixels in the passed pointer
-       *  - restrict for a line interface only, would fit to oyArray2d_s
-       *  - + handle inside an to be created function oyConversion_RunPixels()
-       */
-    }
-
-    /* Copy requests, which where attached to the node, to the ticket. */
-    if((*plug_)->node->core->options_)
-      error = oyOptions_Filter( &s->request_queue, &n, 0,
-                                oyBOOLEAN_INTERSECTION,
-                                "////resolve", (*plug_)->node->core->options_ );
-  }
+    s->graph = (oyFilterGraph_s_*)oyFilterGraph_FromNode( (oyFilterNode_s*)
+                   ((oyFilterPlug_s_*)plug)->remote_socket_->node, 0 );
 
   if(error)
     oyPixelAccess_Release ( (oyPixelAccess_s**)&s );
@@ -8,3 +8,4 @@
   oyStructList_s     * tags_;          /**< @private list of header + tags */
   int                  tags_modified_; /**< @private note manipulation */
   oyConfig_s         * meta_;          /**< @private parsed meta tag */
+  oyProfileTagIndex_s * tag_index_;    /**< @private tag signature index */
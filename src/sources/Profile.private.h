@@ -0,0 +1,16 @@
+/** @internal
+ *  @brief   tag signature to tag table position index
+ *
+ *  Built once from the tag table in oyProfile_s_::block_. Lookups need no
+ *  lock. Tags are created on request only.
+ */
+typedef struct oyProfileTagIndex_s oyProfileTagIndex_s;
+struct oyProfileTagIndex_s {
+  void               * block;          /**< indexed ICC data; NULL if outdated */
+  int                  count;          /**< tag table entries */
+  unsigned int         mask;           /**< hash slots - 1 */
+  oyProfileTag_s    ** tags;           /**< per table position, lazily filled */
+  int32_t            * slots;          /**< table position + 1; 0 is empty */
+  icTagSignature     * sigs;           /**< per table position */
+  oyProfileTagIndex_s* prev;           /**< outdated index, kept for readers */
+};
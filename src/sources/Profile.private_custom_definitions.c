@@ -31,6 +31,7 @@ void oyProfile_Release__Members( oyProfile_s_ * profile )
   profile->sig_ = (icColorSpaceSignature)0;
 
   oyStructList_Release(&profile->tags_);
+  oyProfile_ReleaseTagIndex_( profile );
   oyConfig_Release(&profile->meta_);
 
   if(profile->oy_->deallocateFunc_)
@@ -44,7 +45,7 @@ void oyProfile_Release__Members( oyProfile_s_ * profile )
     { deallocateFunc( profile->names_chan_ ); profile->names_chan_ = 0; }
 
     if(profile->block_)
-    { deallocateFunc( profile->block_ ); profile->block_ = 0; profile->size_ = 0; }
+      oyProfile_ReleaseBlock_( profile );
 
     if(profile->file_name_)
     { deallocateFunc( profile->file_name_ ); profile->file_name_ = 0; }
@@ -103,6 +104,12 @@ int oyProfile_Copy__Members( oyProfile_s_ * dst, oyProfile_s_ * src)
   allocateFunc_ = dst->oy_->allocateFunc_;
 
   /* Copy each value of src to dst here */
+  if(src->block_ && src->size_ && oyMapMemRef_( src->block_ ) == 0)
+  {
+    /* share the read only file mapping */
+    dst->block_ = src->block_;
+    dst->size_ = src->size_;
+  } else
   if(src->block_ && src->size_)
   {
     dst->block_ = allocateFunc_( src->size_ );
@@ -20,6 +20,12 @@ char *       oyProfile_GetFileName_r ( oyProfile_s_      * profile,
 oyProfileTag_s * oyProfile_GetTagByPos_( oyProfile_s_    * profile,
                                        int                 pos );
 int             oyProfile_GetTagCount_ ( oyProfile_s_      * profile );
+oyProfileTag_s * oyProfile_TagFromTable_( oyProfile_s_    * profile,
+                                       int                 i );
+oyProfileTagIndex_s * oyProfile_GetTagIndex_( oyProfile_s_ * profile );
+int          oyProfileTagIndex_Find_ ( oyProfileTagIndex_s * tag_index,
+                                       icTagSignature      sig );
+void         oyProfile_ReleaseTagIndex_( oyProfile_s_    * profile );
 int          oyProfile_TagMoveIn_    ( oyProfile_s_      * profile,
                                        oyProfileTag_s   ** obj,
                                        int                 pos );
@@ -36,6 +42,8 @@ oyPointer    oyProfile_WriteTagTable_( oyProfile_s_      * profile,
                                        size_t            * size );
 
 int oyProfile_HasID_          ( oyProfile_s_      * s );
+void oyProfile_ReleaseBlock_   ( oyProfile_s_      * s );
+int oyProfile_UnshareBlock_    ( oyProfile_s_      * s );
 int oyProfile_GetHash_        ( oyProfile_s_      * s,
                                        int                 flags );
 #if 0
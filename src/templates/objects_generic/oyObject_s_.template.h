@@ -35,6 +35,8 @@ struct oyObject_s_ {
   int                  version_;       /*!< @private OYRANOS_VERSION */
   unsigned char      * hash_ptr_;      /**< @private 2*OY_HASH_SIZE */
   oyPointer            lock_;          /**< @private the user provided lock */
+  oyStruct_s         * observers_;     /**< @private the OY_SIGNAL_OBSERVERS oyStructList_s from handles_ for a fast oyStruct_ObserverSignal() */
+  struct oySignalBatch_s * signal_batch_;/**< @private pending signals inside oyStruct_SignalBatchBegin() */
 };
 
 {% block SpecificPrivateMethodsDeclarations %}
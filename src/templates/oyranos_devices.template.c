@@ -1649,7 +1649,7 @@ OYAPI int  OYEXPORT
     const char * prefix = oyConfig_FindString( device, "prefix", 0 );
 
     char * t = oyAllocateFunc_(256);
-    root = oyjlTreeParse( manufacturers, t, 256 );
+    root = oyjlTreeParseArena( manufacturers, t, 256 );
     if(t[0])
       WARNc2_S( "%s: %s\n", _("found issues parsing JSON"), t );
     oyFree_m_(t);
@@ -1701,7 +1701,7 @@ OYAPI int  OYEXPORT
         if(val) { oyDeAllocateFunc_(val); val = 0; }
       }
 
-      oyjlTreeFree( root ); root = 0;
+      oyjlTreeFreeArena( root ); root = 0;
 
       /* get the devices */
       if(done)
@@ -1733,7 +1733,7 @@ OYAPI int  OYEXPORT
                        OY_DBG_ARGS_,
                        val, oyNoEmptyString_m_(device_db) );
         t = oyAllocateFunc_(256);
-        root = oyjlTreeParse( device_db, t, 256 );
+        root = oyjlTreeParseArena( device_db, t, 256 );
         if(t[0])
           WARNc2_S( "%s: %s\n", _("found issues parsing JSON"), t );
         oyFree_m_(t);
@@ -1783,7 +1783,7 @@ OYAPI int  OYEXPORT
         oyOptions_Release( &opts );
         if(device_db) { oyDeAllocateFunc_(device_db); device_db = 0; }
       }
-      oyjlTreeFree( root ); root = 0;
+      oyjlTreeFreeArena( root ); root = 0;
     }
 
     oyFree_m_( manufacturers );
@@ -2180,8 +2180,10 @@ OYAPI int  OYEXPORT  oyOption_FromDB ( const char        * registration,
  *  @param[in]     allocateFunc        the user allocator for new_reg; optional
  *  @return                            0 - good, 1 >= error
  *
- *  @version Oyranos: 0.9.6
- *  @date    2015/02/07
+ *  The keys are written in one transaction, if the DB module supports it.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/05
  *  @since   2009/02/08 (Oyranos: 0.1.10)
  */
 OYAPI int OYEXPORT oyOptions_SaveToDB( oyOptions_s       * options,
@@ -2192,7 +2194,7 @@ OYAPI int OYEXPORT oyOptions_SaveToDB( oyOptions_s       * options,
 {
   int error = !options || !registration;
   oyOption_s * o = 0;
-  int n,i;
+  int n,i, transaction = 0;
   char * key_base_name = 0,
        * key_name = 0,
        * key_top = 0;
@@ -2209,6 +2211,11 @@ OYAPI int OYEXPORT oyOptions_SaveToDB( oyOptions_s       * options,
       STRING_ADD( key_base_name, OY_SLASH );
     }
 
+    /* write all keys in one DB update */
+    if(error <= 0)
+      error = oyDBTransactionBegin( scope );
+    transaction = error <= 0;
+
     n = oyOptions_Count( options );
     for( i = 0; i < n; ++i )
     {
@@ -2238,6 +2245,13 @@ OYAPI int OYEXPORT oyOptions_SaveToDB( oyOptions_s       * options,
       oyFree_m_( key_name );
     }
 
+    if(transaction)
+    {
+      int commit_error = oyDBTransactionCommit( scope );
+      if(error <= 0)
+        error = commit_error;
+    }
+
     if(error <= 0 && new_reg && key_base_name)
     {
       key_base_name[strlen(key_base_name)-1] = '\000';
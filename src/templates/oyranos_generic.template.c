@@ -90,9 +90,9 @@ const char *   oyContextCollectData_ ( oyStruct_s        * s,
  *  @param[in]     hash_text           the text to search for in the cache_list
  *  @return                            the cache entry may not have a entry
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
  *  @since   2007/11/24 (Oyranos: 0.1.8)
- *  @date    2009/06/04
+ *  @date    2018/03/23
  */
 oyHash_s *   oyCacheListGetEntry_    ( oyStructList_s    * cache_list,
                                        uint32_t            flags,
@@ -101,10 +101,11 @@ oyHash_s *   oyCacheListGetEntry_    ( oyStructList_s    * cache_list,
   oyHash_s * entry = 0,
            * search_key = 0;
   int error = !(cache_list && hash_text);
-  int n = 0, i;
+  int n = 0, i, locked = 0;
   uint32_t search_int[8] = {0,0,0,0,0,0,0,0};
   char hash_text_copy[32];
   const char * search_ptr = (const char*)search_int;
+  double stats_start = oyStatsStart_m();
 
   if(error <= 0 && cache_list->type_ != oyOBJECT_STRUCT_LIST_S)
     error = 1;
@@ -125,7 +126,12 @@ oyHash_s *   oyCacheListGetEntry_    ( oyStructList_s    * cache_list,
   }
 
   if(error <= 0)
+  {
+    /* search and add in one step, so concurrent callers share one entry */
+    oyObject_Lock( cache_list->oy_, __FILE__, __LINE__ );
+    locked = 1;
     n = oyStructList_Count(cache_list);
+  }
 
   for(i = 0; i < n; ++i)
   {
@@ -137,6 +143,8 @@ oyHash_s *   oyCacheListGetEntry_    ( oyStructList_s    * cache_list,
     {
       entry = compare;
       oyHash_Copy( entry, 0 );
+      oyObject_UnLock( cache_list->oy_, __FILE__, __LINE__ );
+      oyStatsEnd_m( oySTATS_CACHE_HIT, stats_start, i );
       return entry;
     }
   }
@@ -156,8 +164,11 @@ oyHash_s *   oyCacheListGetEntry_    ( oyStructList_s    * cache_list,
     }
 
     oyHash_Release( &search_key );
+    oyStatsEnd_m( oySTATS_CACHE_MISS, stats_start, n );
   }
 
+  if(locked)
+    oyObject_UnLock( cache_list->oy_, __FILE__, __LINE__ );
 
   return entry;
 }
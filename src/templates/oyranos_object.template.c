@@ -6,6 +6,7 @@
 #include "oyranos_i18n.h"
 #include "oyranos_module.h"
 #include "oyranos_object.h"
+#include "oyranos_object_internal.h"
 #include "oyranos_string.h"
 
 /** @internal
@@ -362,6 +363,417 @@ int  oyMemMemFound( const void * a, size_t an, const void * b, size_t bn )
   else return 0;
 }
 
+/* 32 bit FNV-1a */
+static uint32_t oyRegistrationHash_  ( const char        * text,
+                                       int                 len )
+{
+  uint32_t hash = 2166136261u;
+  int i;
+  for(i = 0; i < len; ++i)
+  {
+    hash ^= (unsigned char) text[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+#define oyRegistrationIsApi_m(c) ((c) >= '4' && (c) <= '9')
+#define oyRegistrationBit_m(hash) (((uint64_t)1) << ((hash) & 63))
+
+/** @internal
+ *  @brief   tokenise a registration string once for many comparisions
+ *
+ *  The levels and keys are split in the same way as oyFilterStringMatch()
+ *  does. Each key gets the "4-9" API number prefix and "+,-,_" syntax
+ *  prefix resolved and a hash of the remaining text. Each level has a bit
+ *  set of its key hashes to skip most key comparisions.
+ *  The compiled form points into registration, which must stay valid and
+ *  unchanged.
+ *
+ *  @param[in]     registration        the string to tokenise
+ *  @param[in]     path_separator      level separator, usually '/'
+ *  @param[in]     key_separator       key separator, usually '.'
+ *  @param[in]     buffer              optional memory to use; e.g. on stack
+ *  @param[in]     buffer_size         size of buffer
+ *  @param[in]     allocateFunc        used if buffer is too small
+ *  @return                            the compiled registration;
+ *                                     release with oyRegistrationRelease_()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/15
+ *  @since   2018/03/15 (Oyranos: 0.9.7)
+ */
+oyRegistration_s * oyRegistrationCompile_ (
+                                       const char        * registration,
+                                       char                path_separator,
+                                       char                key_separator,
+                                       void              * buffer,
+                                       size_t              buffer_size,
+                                       oyAlloc_f           allocateFunc )
+{
+  oyRegistration_s * c = NULL;
+  int levels_n = 1, keys_n = 1, level = 0, key = 0, start = 0, pos = 0;
+  size_t size;
+  const char * t;
+
+  if(!registration)
+    return NULL;
+
+  for(t = registration; *t; ++t)
+    if(*t == path_separator)
+    { ++levels_n; ++keys_n; }
+    else if(*t == key_separator)
+      ++keys_n;
+
+  size = sizeof(oyRegistration_s) + levels_n * sizeof(oyRegistrationLevel_s) +
+         keys_n * sizeof(oyRegistrationKey_s);
+  if(buffer && size <= buffer_size)
+    c = (oyRegistration_s*) buffer;
+  else
+  {
+    c = (oyRegistration_s*) oyAllocateWrapFunc_( size, allocateFunc );
+    if(!c)
+      return NULL;
+  }
+  memset( c, 0, size );
+  c->allocated = c != buffer;
+  c->text = registration;
+  c->path_separator = path_separator;
+  c->key_separator = key_separator;
+  c->levels_n = levels_n;
+  c->keys_n = keys_n;
+  c->levels = (oyRegistrationLevel_s*) &c[1];
+  c->keys = (oyRegistrationKey_s*) &c->levels[levels_n];
+
+  for(t = registration; ; ++t, ++pos)
+  {
+    if(*t == key_separator || *t == path_separator || !*t)
+    {
+      oyRegistrationKey_s * k = &c->keys[key];
+      oyRegistrationLevel_s * l = &c->levels[level];
+      const char * text = registration + start;
+      int len = pos - start;
+
+      k->offset = start;
+      k->len = len;
+      k->type = '+';
+      if(len && oyRegistrationIsApi_m(text[0]))
+      {
+        k->api = text[0];
+        k->reg_skip = 2;
+        k->pattern_skip = 2;
+        if(len > 1)
+          k->type = text[1];
+      } else if(len && (text[0] == '_' || text[0] == '-'))
+      {
+        k->reg_skip = 1;
+        k->pattern_skip = 1;
+        k->type = text[0];
+      } else if(len && text[0] == '+')
+        k->pattern_skip = 1;
+      if(k->reg_skip > len) k->reg_skip = len;
+      if(k->pattern_skip > len) k->pattern_skip = len;
+      k->reg_hash = oyRegistrationHash_( text + k->reg_skip,
+                                         len - k->reg_skip );
+      k->pattern_hash = oyRegistrationHash_( text + k->pattern_skip,
+                                             len - k->pattern_skip );
+
+      if(!l->keys_n)
+        l->key = key;
+      ++l->keys_n;
+      if(len - k->reg_skip == 0)
+        l->empty = 1;
+      else
+        l->mask |= oyRegistrationBit_m( k->reg_hash );
+
+      ++key;
+      start = pos + 1;
+      if(*t == path_separator)
+        ++level;
+    }
+    if(!*t)
+      break;
+  }
+
+  return c;
+}
+
+/** @internal
+ *  @brief   release a compiled registration
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/15
+ *  @since   2018/03/15 (Oyranos: 0.9.7)
+ */
+void         oyRegistrationRelease_  ( oyRegistration_s ** compiled,
+                                       oyDeAlloc_f         deallocateFunc )
+{
+  if(!compiled || !*compiled)
+    return;
+
+  if((*compiled)->allocated)
+  {
+    if(!deallocateFunc)
+      deallocateFunc = oyDeAllocateFunc_;
+    deallocateFunc( *compiled );
+  }
+  *compiled = NULL;
+}
+
+/** @internal
+ *  @brief   compare compiled registration and pattern
+ *
+ *  The function gives the same results as oyFilterStringMatch() with the
+ *  separators used for compiling both arguments.
+ *
+ *  @param[in]     registration        compiled registration to analise
+ *  @param[in]     pattern             compiled pattern or key name
+ *  @param[in]     api_number          select object type
+ *  @param[in]     flags               see oyFilterStringMatch()
+ *  @return                            match, useable for ranking
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/15
+ *  @since   2018/03/15 (Oyranos: 0.9.7)
+ */
+int          oyRegistrationMatch_    ( const oyRegistration_s * registration,
+                                       const oyRegistration_s * pattern,
+                                       oyOBJECT_e          api_number,
+                                       int                 flags )
+{
+  int     match = 0, match_tmp = 0, i,j,k, api_num = oyOBJECT_NONE,
+          reg_n, p_n;
+  /* without syntax or sub string options the precomputed hashes apply */
+  int     fast = !(flags & (OY_MATCH_SUB_STRING | OY_SYNTAX_SKIP_REG |
+                            OY_SYNTAX_SKIP_PATTERN));
+  int     (*memmatch) (const void *s1, size_t s1n,
+                       const void *s2, size_t s2n) = oyMemCmp;
+
+  if(flags & OY_MATCH_SUB_STRING)
+    memmatch = oyMemMemFound;
+
+  if(registration && pattern)
+  {
+    api_num = oyCMMapiNumberToChar(api_number);
+    match_tmp = 1;
+    reg_n = registration->levels_n;
+    p_n = pattern->levels_n;
+
+    for( i = 0; i < reg_n && i < p_n; ++i)
+    {
+      const oyRegistrationLevel_s * rl, * pl;
+
+      /* allow a key only in *pattern to filter from *registration */
+      if(p_n == 1)
+      {
+        rl = &registration->levels[reg_n - 1];
+        pl = &pattern->levels[i];
+        i = reg_n;
+      } else
+      /* level by level comparision */
+      {
+        rl = &registration->levels[i];
+        pl = &pattern->levels[i];
+      }
+
+      if(match_tmp && pl->keys_n && rl->keys_n)
+      {
+        for( j = 0; j < pl->keys_n; ++j)
+        {
+          const oyRegistrationKey_s * pk = &pattern->keys[pl->key + j];
+          const char * pc_text = pattern->text + pk->offset;
+          int     pc_len = pk->len,
+                  pc_api_num = pk->api;
+          char    pc_match_type = '+';
+
+          match_tmp = 0;
+
+          if(pc_api_num)
+          {
+            if(!(flags & OY_SYNTAX_SKIP_PATTERN))
+            {
+              pc_match_type = pk->type;
+              pc_text += pk->pattern_skip;
+              pc_len -= pk->pattern_skip;
+            } else
+            {
+              ++ pc_text;
+              -- pc_len;
+            }
+          } else
+          if(!(flags & OY_SYNTAX_SKIP_PATTERN) && pk->pattern_skip)
+          {
+            pc_match_type = pk->type;
+            pc_text += pk->pattern_skip;
+            pc_len -= pk->pattern_skip;
+          }
+
+          /* no key in this level can be equal */
+          if(fast && pc_len && !rl->empty &&
+             !(rl->mask & oyRegistrationBit_m( pk->pattern_hash )))
+            k = rl->keys_n;
+          else
+            k = 0;
+
+          for( ; k < rl->keys_n; ++k )
+          {
+            const oyRegistrationKey_s * rk = &registration->keys[rl->key + k];
+            const char * regc_text = registration->text + rk->offset;
+            int     regc_len = rk->len,
+                    equal;
+
+            if(rk->api || !(flags & OY_SYNTAX_SKIP_REG))
+            {
+              regc_text += rk->reg_skip;
+              regc_len -= rk->reg_skip;
+            }
+
+            if(pc_api_num && api_num != pc_api_num)
+              continue;
+
+            if(fast)
+              equal = !regc_len || !pc_len ||
+                      (regc_len == pc_len && rk->reg_hash == pk->pattern_hash &&
+                       memcmp( regc_text, pc_text, pc_len ) == 0);
+            else
+              equal = memmatch( regc_text, regc_len, pc_text, pc_len ) &&
+                      (flags & OY_MATCH_SUB_STRING ||
+                       regc_len == pc_len || !regc_len || !pc_len);
+
+            if(equal)
+            {
+              if(pc_match_type == '+' ||
+                 pc_match_type == '_')
+              {
+                ++ match;
+                match_tmp = 1;
+              } else /* if(pc_match_type == '-') */
+                return 0;
+            }
+          }
+
+          if(pc_match_type == '+' && !match_tmp)
+            return 0;
+        }
+      }
+    }
+  } else
+    if((flags & OY_MATCH_SUB_STRING) &&
+       registration && !pattern)
+      match = 1;
+
+  if(match_tmp == 1 && !match)
+    match = 1;
+
+  return match;
+}
+
+/** @internal
+ *  @brief   a compiled module or connector registration
+ *
+ *  Module APIs and connectors keep their registrations in statically
+ *  initialised structs, which can not carry a compiled member. This side
+ *  table holds the compiled form looked up by the string content. The set
+ *  of such registrations is given by the installed modules, so entries
+ *  live until oyRegistrationCacheRelease_(). Do not pass free form user
+ *  strings.
+ *
+ *  @param[in]     registration        a module or connector registration
+ *  @return                            the compiled registration; not owned
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/16
+ *  @since   2018/04/16 (Oyranos: 0.9.7)
+ */
+#define OY_REGISTRATION_CACHE_SIZE 256
+typedef struct oyRegistrationCacheEntry_s oyRegistrationCacheEntry_s;
+struct oyRegistrationCacheEntry_s {
+  oyRegistrationCacheEntry_s * next;
+  uint32_t         hash;
+  oyRegistration_s * compiled;         /**< points into text */
+  char             text[1];
+};
+static oyRegistrationCacheEntry_s * oy_registration_cache_[OY_REGISTRATION_CACHE_SIZE];
+static int oy_registration_cache_lock_ = 0;
+const oyRegistration_s * oyRegistrationCached_ (
+                                       const char        * registration )
+{
+  oyRegistrationCacheEntry_s * e;
+  uint32_t hash;
+  int len;
+
+  if(!registration)
+    return NULL;
+
+  len = strlen( registration );
+  hash = oyRegistrationHash_( registration, len );
+
+  oySpinLock_m( oy_registration_cache_lock_ )
+  for(e = oy_registration_cache_[hash % OY_REGISTRATION_CACHE_SIZE]; e; e = e->next)
+    if(e->hash == hash && strcmp( e->text, registration ) == 0)
+      break;
+  if(!e)
+  {
+    e = (oyRegistrationCacheEntry_s*) oyAllocateFunc_(
+                                sizeof(oyRegistrationCacheEntry_s) + len );
+    if(e)
+    {
+      memcpy( e->text, registration, len + 1 );
+      e->hash = hash;
+      e->compiled = oyRegistrationCompileDefault_m( e->text, oyAllocateFunc_ );
+      e->next = oy_registration_cache_[hash % OY_REGISTRATION_CACHE_SIZE];
+      oy_registration_cache_[hash % OY_REGISTRATION_CACHE_SIZE] = e;
+    }
+  }
+  oySpinUnLock_m( oy_registration_cache_lock_ )
+
+  return e ? e->compiled : NULL;
+}
+
+/** @internal
+ *  @brief   free all oyRegistrationCached_() entries
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/16
+ *  @since   2018/04/16 (Oyranos: 0.9.7)
+ */
+void         oyRegistrationCacheRelease_( void )
+{
+  int i;
+
+  oySpinLock_m( oy_registration_cache_lock_ )
+  for(i = 0; i < OY_REGISTRATION_CACHE_SIZE; ++i)
+    while(oy_registration_cache_[i])
+    {
+      oyRegistrationCacheEntry_s * e = oy_registration_cache_[i];
+      oy_registration_cache_[i] = e->next;
+      oyRegistrationRelease_( &e->compiled, oyDeAllocateFunc_ );
+      oyDeAllocateFunc_( e );
+    }
+  oySpinUnLock_m( oy_registration_cache_lock_ )
+}
+
+/** @internal
+ *  @brief   match a module or connector registration against a pattern
+ *
+ *  @param[in]     registration        see oyRegistrationCached_()
+ *  @param[in]     pattern             compiled pattern
+ *  @param[in]     api_number          select object type
+ *  @return                            as oyFilterRegistrationMatch()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/04/16
+ *  @since   2018/04/16 (Oyranos: 0.9.7)
+ */
+int          oyRegistrationMatchCached_ (
+                                       const char        * registration,
+                                       const oyRegistration_s * pattern,
+                                       oyOBJECT_e          api_number )
+{
+  return oyRegistrationMatch_( oyRegistrationCached_( registration ),
+                               pattern, api_number, 0 );
+}
+
 /** @brief   analyse string and compare with a given pattern
  *
  *  The rules are described in the @ref module_api overview.
@@ -706,6 +1118,37 @@ int    oyTextIccDictMatch            ( const char        * text,
   return match;
 }
 
+/** @internal
+ *  @brief   release pending signals without sending
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/16
+ *  @since   2018/03/16 (Oyranos: 0.9.7)
+ */
+void         oySignalBatchRelease_   ( oySignalBatch_s  ** batch,
+                                       oyDeAlloc_f         deallocateFunc )
+{
+  oySignalBatch_s * b;
+  int i;
+
+  if(!batch || !*batch)
+    return;
+
+  b = *batch;
+  if(!deallocateFunc)
+    deallocateFunc = oyDeAllocateFunc_;
+
+  for(i = 0; i < b->n; ++i)
+    if(b->data[i] && b->data[i]->release)
+      b->data[i]->release( &b->data[i] );
+  if(b->types)
+    deallocateFunc( b->types );
+  if(b->data)
+    deallocateFunc( b->data );
+  deallocateFunc( b );
+  *batch = NULL;
+}
+
 /** @internal
  *  @brief   wrapper for oyDeAllocateFunc_
  *
@@ -58,6 +58,97 @@ int    oyTextIccDictMatch            ( const char        * text,
                                        char                key_separator );
 int    oyPointerRelease              ( oyPointer         * ptr );
 
+/** @internal
+ *  @brief   a tokenised registration key
+ *
+ *  @see oyRegistrationCompile_()
+ */
+typedef struct {
+  int              offset;             /**< key start in the text */
+  int              len;                /**< key length with prefixes */
+  char             api;                /**< '4'-'9' API number or zero */
+  char             type;               /**< pattern match type: '+','-','_' */
+  char             reg_skip;           /**< prefix length as registration */
+  char             pattern_skip;       /**< prefix length as pattern */
+  uint32_t         reg_hash;           /**< key hash as registration */
+  uint32_t         pattern_hash;       /**< key hash as pattern */
+} oyRegistrationKey_s;
+
+/** @internal
+ *  @brief   a tokenised registration level
+ */
+typedef struct {
+  int              key;                /**< first key in oyRegistration_s::keys */
+  int              keys_n;             /**< number of keys */
+  uint64_t         mask;               /**< one bit per key hash */
+  int              empty;              /**< has a empty key; matches all */
+} oyRegistrationLevel_s;
+
+/** @internal
+ *  @brief   a compiled registration string
+ *
+ *  Use it for repeated matching of the same registration or pattern.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/15
+ *  @since   2018/03/15 (Oyranos: 0.9.7)
+ */
+typedef struct oyRegistration_s {
+  const char     * text;               /**< the compiled string; not owned */
+  char             path_separator;
+  char             key_separator;
+  int              allocated;          /**< not in a caller buffer */
+  int              levels_n;
+  oyRegistrationLevel_s * levels;
+  int              keys_n;
+  oyRegistrationKey_s * keys;
+} oyRegistration_s;
+
+oyRegistration_s * oyRegistrationCompile_ (
+                                       const char        * registration,
+                                       char                path_separator,
+                                       char                key_separator,
+                                       void              * buffer,
+                                       size_t              buffer_size,
+                                       oyAlloc_f           allocateFunc );
+void         oyRegistrationRelease_  ( oyRegistration_s ** compiled,
+                                       oyDeAlloc_f         deallocateFunc );
+int          oyRegistrationMatch_    ( const oyRegistration_s * registration,
+                                       const oyRegistration_s * pattern,
+                                       oyOBJECT_e          api_number,
+                                       int                 flags );
+/** @internal
+ *  compile with the separators of oyFilterRegistrationMatch() */
+#define oyRegistrationCompileDefault_m( text_, alloc_ ) \
+  oyRegistrationCompile_( text_, OY_SLASH_C, '.', NULL, 0, alloc_ )
+const oyRegistration_s * oyRegistrationCached_ (
+                                       const char        * registration );
+void         oyRegistrationCacheRelease_( void );
+int          oyRegistrationMatchCached_ (
+                                       const char        * registration,
+                                       const oyRegistration_s * pattern,
+                                       oyOBJECT_e          api_number );
+
+/** @internal
+ *  @brief   signals collected inside oyStruct_SignalBatchBegin()
+ *
+ *  Each signal type and signal_data pair is kept once in order of its
+ *  first emission.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2018/03/16
+ *  @since   2018/03/16 (Oyranos: 0.9.7)
+ */
+typedef struct oySignalBatch_s {
+  int              depth;              /**< nested scopes */
+  int              n;                  /**< number of pending signals */
+  int              reserved;           /**< allocated signals */
+  int            * types;              /**< oySIGNAL_e per signal */
+  oyStruct_s    ** data;               /**< referenced signal_data */
+} oySignalBatch_s;
+void         oySignalBatchRelease_   ( oySignalBatch_s  ** batch,
+                                       oyDeAlloc_f         deallocateFunc );
+
 {% include "cpp_end.h" %}
 
 #endif /* {{ file_name|cut:".h"|upper }}_H */
@@ -0,0 +1,108 @@
+/*
+ * CGATS measurement texts for the parse_cgats command.
+ *
+ * cgats_it8_7_4: the IT8.7/4 layout with CMYK device values, XYZ, Lab and
+ *                a coarse spectral reflectance column set
+ * cgats_eci2002: the ECI2002 layout with sample names, CMYK and Lab
+ * cgats_lab:     Lab reference values with CRLF and a unterminated quote
+ * cgats_rgb:     0 - 255 RGB values declared by the RGB_SCALE keyword
+ *
+ * The values are a small subset in the layout of the respective charts.
+ */
+
+static const char cgats_it8_7_4[] =
+"IT8.7/4\n"
+"ORIGINATOR\t\"Oyranos test\"\n"
+"DESCRIPTOR\t\"IT8.7/4 layout subset\"\n"
+"CREATED\t\"2018-04-14\"\n"
+"INSTRUMENTATION\t\"spectrophotometer D50 2 degree\"\n"
+"MEASUREMENT_SOURCE\t\"Illumination=D50 ObserverAngle=2 WhiteBase=Abs Filter=No\"\n"
+"KEYWORD\t\"SPECTRAL_BANDS\"\n"
+"SPECTRAL_BANDS\t8\n"
+"NUMBER_OF_FIELDS\t19\n"
+"BEGIN_DATA_FORMAT\n"
+"SAMPLE_ID\tCMYK_C\tCMYK_M\tCMYK_Y\tCMYK_K\tXYZ_X\tXYZ_Y\tXYZ_Z\tLAB_L\tLAB_A\tLAB_B\t"
+"SPECTRAL_NM380\tSPECTRAL_NM430\tSPECTRAL_NM480\tSPECTRAL_NM530\tSPECTRAL_NM580\tSPECTRAL_NM630\tSPECTRAL_NM680\tSPECTRAL_NM730\n"
+"END_DATA_FORMAT\n"
+"NUMBER_OF_SETS\t4\n"
+"BEGIN_DATA\n"
+"1\t0\t0\t0\t0\t84.57\t87.62\t72.18\t95.01\t0.53\t-2.36\t0.4312\t0.8651\t0.8803\t0.8770\t0.8752\t0.8739\t0.8760\t0.8791\n"
+"2\t100\t0\t0\t0\t13.76\t20.77\t50.94\t52.69\t-36.83\t-52.45\t0.2304\t0.5863\t0.6071\t0.3112\t0.0661\t0.0202\t0.0184\t0.0367\n"
+"3\t0\t100\t0\t0\t31.12\t16.38\t15.48\t47.49\t75.21\t-3.58\t0.2701\t0.4218\t0.1094\t0.0331\t0.2217\t0.7832\t0.8580\t0.8762\n"
+"4\t0\t0\t0\t100\t1.35\t1.42\t1.19\t12.40\t0.67\t0.42\t0.0147\t0.0139\t0.0141\t0.0142\t0.0143\t0.0145\t0.0148\t0.0151\n"
+"END_DATA\n";
+
+static const char cgats_eci2002[] =
+"ECI2002\r\n"
+"# ECI2002 visual layout; names are the chart positions\r\n"
+"ORIGINATOR \"Oyranos test\"\r\n"
+"DESCRIPTOR \"ECI2002R CMYK visual subset\"\r\n"
+"CREATED \"2018-04-14\"\r\n"
+"KEYWORD \"SAMPLE_NAME\"\r\n"
+"LGOROWLENGTH 33\r\n"
+"NUMBER_OF_FIELDS 9\r\n"
+"BEGIN_DATA_FORMAT\r\n"
+"SAMPLE_ID SAMPLE_NAME CMYK_C CMYK_M CMYK_Y CMYK_K LAB_L LAB_A LAB_B\r\n"
+"END_DATA_FORMAT\r\n"
+"NUMBER_OF_SETS 5\r\n"
+"BEGIN_DATA\r\n"
+"1 A1 0 0 0 0 95.00 0.50 -2.30\r\n"
+"2 A2 10 0 0 0 89.90 -4.52 -8.21\r\n"
+"3 A3 0 40 0 0 74.12 31.80 -6.44\r\n"
+"4 A4 0 0 70 0 90.55 -5.73 58.02\r\n"
+"5 A5 100 100 100 100 5.21 0.84 -0.40\r\n"
+"END_DATA\r\n";
+
+static const char cgats_lab[] =
+"CGATS.17\r\n"
+"DESCRIPTOR \"Lab reference\r\n"
+"ORIGINATOR \"Oyranos test\"\r\n"
+"NUMBER_OF_FIELDS 4\r\n"
+"BEGIN_DATA_FORMAT\r\n"
+"SAMPLE_ID LAB_L LAB_A LAB_B\r\n"
+"END_DATA_FORMAT\r\n"
+"NUMBER_OF_SETS 2\r\n"
+"BEGIN_DATA\r\n"
+"1 100 -128 129\r\n"
+"2 50 0 0\r\n"
+"END_DATA\r\n";
+
+static const char cgats_rgb[] =
+"CGATS.17\n"
+"ORIGINATOR \"Oyranos test\"\n"
+"KEYWORD \"RGB_SCALE\"\n"
+"RGB_SCALE 255\n"
+"NUMBER_OF_FIELDS 4\n"
+"BEGIN_DATA_FORMAT\n"
+"SAMPLE_ID RGB_R RGB_G RGB_B\n"
+"END_DATA_FORMAT\n"
+"NUMBER_OF_SETS 2\n"
+"BEGIN_DATA\n"
+"1 255 0 51\n"
+"2 0 0 0\n"
+"END_DATA\n";
+
+/* a IT8.7/4 style text with sets patches; free() the result */
+static char * cgatsTestCreate        ( int                 sets )
+{
+  size_t size = 512 + (size_t)sets * 160;
+  char * text = (char*) malloc( size ), * t;
+  int i;
+
+  if(!text)
+    return NULL;
+
+  t = text;
+  t += sprintf( t, "CGATS.17\nORIGINATOR \"Oyranos bench\"\n"
+                   "NUMBER_OF_FIELDS 11\nBEGIN_DATA_FORMAT\n"
+                   "SAMPLE_ID CMYK_C CMYK_M CMYK_Y CMYK_K XYZ_X XYZ_Y XYZ_Z LAB_L LAB_A LAB_B\n"
+                   "END_DATA_FORMAT\nNUMBER_OF_SETS %d\nBEGIN_DATA\n", sets );
+  for(i = 0; i < sets; ++i)
+    t += sprintf( t, "%d %d %d %d %d %d.%02d %d.%02d %d.%02d %d.%02d %d.%02d -%d.%02d\n",
+                  i + 1, i%101, (i/101)%101, (i/7)%101, (i/13)%101,
+                  i%90, i%100, i%95, (i*3)%100, i%80, (i*7)%100,
+                  i%100, i%97, i%128 - 64, i%89, i%128, i%83 );
+  sprintf( t, "END_DATA\n" );
+
+  return text;
+}
@@ -0,0 +1,967 @@
+/** @file oyranos_bench.c
+ *
+ *  Oyranos is an open source Color Management System
+ *
+ *  @par Copyright:
+ *            2018 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    Oyranos benchmark suite
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            new BSD <http://www.opensource.org/licenses/BSD-3-Clause>
+ *  @since    2018/03/06
+ *
+ *  The program times core hot paths with a fixed workload and writes the
+ *  results as JSON. A previous result file can be passed in as baseline.
+ *  Cases slower than the baseline by more than the tolerance are reported
+ *  as regression and make the program return non zero.
+ *
+ *  oyranos-bench [-o results.json] [-b baseline.json] [-t 10] [-r 5] [filter]
+ */
+
+#include "oyConversion_s.h"
+#include "oyFilterNode_s.h"
+#include "oyObserver_s.h"
+#include "oyOptions_s.h"
+#include "oyProfile_s.h"
+
+#include "oyranos.h"
+#include "oyranos_debug.h"
+#include "oyranos_helper.h"
+#include "oyranos_helper_macros.h"
+#include "oyranos_internal.h"
+#include "oyranos_module_internal.h"
+#include "oyranos_object_internal.h"
+#include "oyranos_sentinel.h"
+#include "oyranos_string.h"
+#include "oyranos_threads.h"
+#include "oyranos_version.h"
+
+#include "oyjl/oyjl.h"
+
+#include "cgats_testdata.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <unistd.h>                    /* sysconf() */
+#include <stdio.h>
+#include <string.h>
+
+/* --- workloads --- */
+
+static uint32_t oy_bench_icc_flags = 0;
+static oyProfile_s * oy_bench_web = NULL,
+                   * oy_bench_lab = NULL,
+                   * oy_bench_argb = NULL;
+static oyPointer oy_bench_block = NULL;
+static size_t oy_bench_block_size = 0;
+static oyOptions_s * oy_bench_options = NULL;
+static char * oy_bench_json = NULL;
+static char * oy_bench_db_json = NULL;
+static char * oy_bench_cgats = NULL;
+#define OY_BENCH_CGATS_SETS 20000
+
+static int oyBenchInit               ( void )
+{
+  int i, error = 0;
+
+  oy_bench_icc_flags = oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oy_bench_web = oyProfile_FromStd( oyASSUMED_WEB, oy_bench_icc_flags, NULL );
+  oy_bench_lab = oyProfile_FromStd( oyEDITING_LAB, oy_bench_icc_flags, NULL );
+  oy_bench_argb = oyProfile_FromFile( "compatibleWithAdobeRGB1998.icc",
+                                      oy_bench_icc_flags, NULL );
+  if(!oy_bench_argb)
+    oy_bench_argb = oyProfile_Copy( oy_bench_web, NULL );
+
+  oy_bench_block = oyProfile_GetMem( oy_bench_argb, &oy_bench_block_size, 0,
+                                     oyAllocateFunc_ );
+
+  /* a typical set of node options */
+  for(i = 0; i < 48; ++i)
+  {
+    char * reg = NULL;
+    oyStringAddPrintf( &reg, 0,0, "org/freedesktop/openicc/bench/key_%d", i );
+    error = oyOptions_SetFromString( &oy_bench_options, reg, "value",
+                                     OY_CREATE_NEW );
+    oyFree_m_( reg );
+  }
+  error = oyOptions_SetFromString( &oy_bench_options,
+                                   "//" OY_TYPE_STD "/icc_color/rendering_intent",
+                                   "1", OY_CREATE_NEW );
+  oy_bench_json = oyStringCopy( oyOptions_GetText( oy_bench_options,
+                                                   (oyNAME_e)oyNAME_JSON ),
+                                oyAllocateFunc_ );
+
+  /* a device DB with the layout of the taxi DB */
+  oyStringAddPrintf( &oy_bench_db_json, 0,0,
+                     "{\"org\":{\"freedesktop\":{\"openicc\":{\"device\":[[" );
+  for(i = 0; i < 2000; ++i)
+    oyStringAddPrintf( &oy_bench_db_json, 0,0,
+                       "%s{\"_id\":{\"$oid\":\"5a6f%08d\"},\"manufacturer\":\"Maker %d\",\"model\":\"Model %d\",\"profile_description\":[\"Model %d sRGB\"],\"gamma\":2.%d,\"count\":%d}",
+                       i ? "," : "", i, i%50, i, i, i%10, i );
+  oyStringAddPrintf( &oy_bench_db_json, 0,0, "]]}}}}" );
+
+  /* a measurement file as from a profiling run */
+  oy_bench_cgats = cgatsTestCreate( OY_BENCH_CGATS_SETS );
+
+  if(!oy_bench_web || !oy_bench_lab || !oy_bench_block || !oy_bench_json ||
+     !oy_bench_cgats)
+    error = 1;
+
+  return error;
+}
+
+static void oyBenchFinish            ( void )
+{
+  oyProfile_Release( &oy_bench_web );
+  oyProfile_Release( &oy_bench_lab );
+  oyProfile_Release( &oy_bench_argb );
+  oyFree_m_( oy_bench_block );
+  oyOptions_Release( &oy_bench_options );
+  oyFree_m_( oy_bench_json );
+  oyFree_m_( oy_bench_db_json );
+  free( oy_bench_cgats ); oy_bench_cgats = NULL;
+}
+
+static int oyBenchProfileOpenStd     ( int                 n )
+{
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyProfile_s * p = oyProfile_FromStd( oyASSUMED_WEB, oy_bench_icc_flags, NULL );
+    if(!p) error = 1;
+    oyProfile_Release( &p );
+  }
+  return error;
+}
+
+static int oyBenchProfileOpenFile    ( int                 n )
+{
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyProfile_s * p = oyProfile_FromFile( "compatibleWithAdobeRGB1998.icc",
+                                          OY_NO_CACHE_READ | OY_NO_CACHE_WRITE |
+                                          oy_bench_icc_flags, NULL );
+    if(!p) error = 1;
+    oyProfile_Release( &p );
+  }
+  return error;
+}
+
+/* touch header and one tag like a profile listing in a UI does */
+static int oyBenchProfileList        ( int                 n )
+{
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    uint32_t j, names_n = 0;
+    char ** names = oyProfileListGet( NULL, &names_n, oyAllocateFunc_ );
+    if(!names_n) error = 1;
+    for(j = 0; j < names_n; ++j)
+    {
+      oyProfile_s * p = oyProfile_FromFile( names[j],
+                                          OY_NO_CACHE_READ | OY_NO_CACHE_WRITE |
+                                          oy_bench_icc_flags, NULL );
+      oyProfile_GetSignature( p, oySIGNATURE_CLASS );
+      oyProfile_GetText( p, oyNAME_DESCRIPTION );
+      oyProfile_Release( &p );
+    }
+    oyStringListRelease( &names, names_n, oyDeAllocateFunc_ );
+  }
+  return error;
+}
+
+/* tag lookups on freshly opened profiles, including a missing tag */
+static int oyBenchProfileTagLookup   ( int                 n )
+{
+  static const icTagSignature sigs[6] = { icSigProfileDescriptionTag,
+    icSigCopyrightTag, icSigMediaWhitePointTag, (icTagSignature) 0x6d657461,
+    (icTagSignature) 0x76636774, (icTagSignature) 0x6f795858 };
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    uint32_t j, names_n = 0;
+    char ** names = oyProfileListGet( NULL, &names_n, oyAllocateFunc_ );
+    if(!names_n) error = 1;
+    for(j = 0; j < names_n; ++j)
+    {
+      int k;
+      oyProfile_s * p = oyProfile_FromFile( names[j],
+                                          OY_NO_CACHE_READ | OY_NO_CACHE_WRITE |
+                                          oy_bench_icc_flags, NULL );
+      for(k = 0; k < 6; ++k)
+      {
+        oyProfileTag_s * tag = oyProfile_GetTagById( p, sigs[k] );
+        oyProfileTag_Release( &tag );
+      }
+      oyProfile_Release( &p );
+    }
+    oyStringListRelease( &names, names_n, oyDeAllocateFunc_ );
+  }
+  return error;
+}
+
+static int oyBenchProfileOpenMem     ( int                 n )
+{
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyProfile_s * p = oyProfile_FromMem( oy_bench_block_size, oy_bench_block,
+                                         0, NULL );
+    if(!p) error = 1;
+    oyProfile_Release( &p );
+  }
+  return error;
+}
+
+static oyConversion_s * oyBenchConversion (
+                                       oyDATATYPE_e        data_type,
+                                       int                 width,
+                                       int                 height,
+                                       oyPointer         * buf )
+{
+  size_t size = (size_t)width * height * 3 * oyDataTypeGetSize( data_type );
+  oyConversion_s * cc;
+  oyImage_s * in, * out;
+
+  *buf = calloc( size, 2 );
+  in  = oyImage_Create( width, height, *buf,
+                        oyChannels_m(3) | oyDataType_m(data_type),
+                        oy_bench_argb, NULL );
+  out = oyImage_Create( width, height, (char*)*buf + size,
+                        oyChannels_m(3) | oyDataType_m(data_type),
+                        oy_bench_web, NULL );
+  cc = oyConversion_CreateBasicPixels( in, out, NULL, NULL );
+  oyImage_Release( &in );
+  oyImage_Release( &out );
+
+  return cc;
+}
+
+static int oyBenchSetup              ( int                 n,
+                                       int                 cold )
+{
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyPointer buf = NULL;
+    oyConversion_s * cc;
+
+    /* forget all transforms and module lookups */
+    if(cold)
+      oyStructList_Clear( *oyCMMCacheList_() );
+
+    cc = oyBenchConversion( oyUINT16, 1, 1, &buf );
+    if(cc)
+      error = oyConversion_RunPixels( cc, NULL );
+    else
+      error = 1;
+    oyConversion_Release( &cc );
+    free( buf );
+  }
+  return error;
+}
+static int oyBenchSetupCold          ( int                 n )
+{ return oyBenchSetup( n, 1 ); }
+static int oyBenchSetupCached        ( int                 n )
+{ return oyBenchSetup( n, 0 ); }
+
+/* policy resolution as done by applications before each new transform */
+static int oyBenchConversionCorrect  ( int                 n )
+{
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyPointer buf = NULL;
+    oyConversion_s * cc = oyBenchConversion( oyUINT16, 1, 1, &buf );
+    if(cc)
+      /* negative values are issues */
+      error = oyConversion_Correct( cc, "//" OY_TYPE_STD "/icc_color",
+                                    oyOPTIONATTRIBUTE_ADVANCED, NULL ) > 0;
+    else
+      error = 1;
+    oyConversion_Release( &cc );
+    free( buf );
+  }
+  return error;
+}
+
+static int oyBenchRunPixels          ( int                 n,
+                                       oyDATATYPE_e        data_type,
+                                       int                 size )
+{
+  oyPointer buf = NULL;
+  oyConversion_s * cc = oyBenchConversion( data_type, size, size, &buf );
+  int i, error = !cc;
+
+  /* warm up caches */
+  if(!error)
+    error = oyConversion_RunPixels( cc, NULL );
+  for(i = 0; i < n && !error; ++i)
+    error = oyConversion_RunPixels( cc, NULL );
+
+  oyConversion_Release( &cc );
+  free( buf );
+  return error;
+}
+static int oyBenchRunU8_64           ( int                 n )
+{ return oyBenchRunPixels( n, oyUINT8, 64 ); }
+static int oyBenchRunU16_64          ( int                 n )
+{ return oyBenchRunPixels( n, oyUINT16, 64 ); }
+static int oyBenchRunFloat_64        ( int                 n )
+{ return oyBenchRunPixels( n, oyFLOAT, 64 ); }
+static int oyBenchRunU8_1024         ( int                 n )
+{ return oyBenchRunPixels( n, oyUINT8, 1024 ); }
+static int oyBenchRunU16_1024        ( int                 n )
+{ return oyBenchRunPixels( n, oyUINT16, 1024 ); }
+static int oyBenchRunFloat_1024      ( int                 n )
+{ return oyBenchRunPixels( n, oyFLOAT, 1024 ); }
+
+/* 64x64 tiles out of a 1024x1024 image, one ticket per tile */
+static int oyBenchTiles              ( int                 n,
+                                       int                 pooled )
+{
+  oyPointer buf = NULL;
+  oyConversion_s * cc = oyBenchConversion( oyUINT16, 1024, 1024, &buf );
+  oyFilterNode_s * node = oyConversion_GetNode( cc, OY_OUTPUT );
+  oyFilterPlug_s * plug = oyFilterNode_GetPlug( node, 0 );
+  oyRectangle_s * tile = oyRectangle_NewFrom( NULL, NULL );
+  int i, error = !cc || !plug;
+
+  for(i = 0; i < n && !error; ++i)
+  {
+    double x = (i % 16) / 16.0,
+           y = (i / 16 % 16) / 16.0;
+    oyPixelAccess_s * ticket;
+
+    if(pooled)
+      ticket = oyConversion_GetTicket( cc, 0,0, oyPIXEL_ACCESS_IMAGE );
+    else
+      ticket = oyPixelAccess_Create( 0,0, plug, oyPIXEL_ACCESS_IMAGE, NULL );
+    oyRectangle_SetGeo( tile, x,y, 1/16.0,1/16.0 );
+    error = !ticket || oyPixelAccess_ChangeRectangle( ticket, x,y, tile ) > 0;
+    if(!error)
+      error = oyConversion_RunPixels( cc, ticket );
+
+    if(pooled)
+      oyConversion_RecycleTicket( cc, &ticket );
+    else
+      oyPixelAccess_Release( &ticket );
+  }
+
+  oyRectangle_Release( &tile );
+  oyFilterPlug_Release( &plug );
+  oyFilterNode_Release( &node );
+  oyConversion_Release( &cc );
+  free( buf );
+  return error;
+}
+static int oyBenchTilesCreate        ( int                 n )
+{ return oyBenchTiles( n, 0 ); }
+static int oyBenchTilesPooled        ( int                 n )
+{ return oyBenchTiles( n, 1 ); }
+
+static int oyBenchOptionFind         ( int                 n )
+{
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    const char * v = oyOptions_FindString( oy_bench_options,
+                                           "rendering_intent", 0 );
+    if(!v) error = 1;
+  }
+  return error;
+}
+
+static const char * oy_bench_regs[4] = {
+  OY_INTERNAL "/icc_color/rendering_intent",
+  "org/oyranos/openicc/icc_color/context.4+lcm2._icc_version_2.rendering_intent_proof",
+  "org/freedesktop/openicc/device/monitor/manufacturer/short",
+  "org/freedesktop/openicc/icc_color/display.icc_profile.abstract.white_point.automatic.oy-monitor" },
+                  * oy_bench_patterns[4] = {
+  "rendering_intent", "//" OY_TYPE_STD "/context.4+lcm2",
+  "//icc_color/rendering_intent_proof", "display.abstract.icc_profile" };
+
+static int oyBenchRegistrationMatch  ( int                 n )
+{
+  int i, j, k, matches = 0;
+  for(i = 0; i < n; ++i)
+    for(j = 0; j < 4; ++j)
+      for(k = 0; k < 4; ++k)
+        matches += oyFilterRegistrationMatch( oy_bench_regs[j],
+                                              oy_bench_patterns[k], 0 ) != 0;
+  return matches == 0;
+}
+
+static int oyBenchRegistrationMatchCompiled ( int          n )
+{
+  oyRegistration_s * regs[4], * patterns[4];
+  int i, j, k, matches = 0;
+  for(j = 0; j < 4; ++j)
+  {
+    regs[j] = oyRegistrationCompileDefault_m( oy_bench_regs[j], 0 );
+    patterns[j] = oyRegistrationCompileDefault_m( oy_bench_patterns[j], 0 );
+  }
+  for(i = 0; i < n; ++i)
+    for(j = 0; j < 4; ++j)
+      for(k = 0; k < 4; ++k)
+        matches += oyRegistrationMatch_( regs[j], patterns[k], 0, 0 ) != 0;
+  for(j = 0; j < 4; ++j)
+  {
+    oyRegistrationRelease_( &regs[j], 0 );
+    oyRegistrationRelease_( &patterns[j], 0 );
+  }
+  return matches == 0;
+}
+
+static int oy_bench_signals = 0;
+static int oyBenchCountSignal        ( oyObserver_s      * observer OY_UNUSED,
+                                       oySIGNAL_e          signal_type OY_UNUSED,
+                                       oyStruct_s        * signal_data OY_UNUSED )
+{
+  ++oy_bench_signals;
+  return 0;
+}
+
+/* node option edits: each value change signals the option set */
+static int oyBenchOptionEdits        ( int                 n,
+                                       int                 observed,
+                                       int                 batched )
+{
+  oyOptions_s * opts = NULL;
+  oyOption_s * observer = oyOption_New( NULL );
+  char * regs[16], value[16];
+  int i, j, error = 0;
+
+  for(j = 0; j < 16; ++j)
+  {
+    regs[j] = NULL;
+    oyStringAddPrintf( &regs[j], 0,0, "org/freedesktop/openicc/bench/edit_%d", j );
+    error = oyOptions_SetFromString( &opts, regs[j], "0", OY_CREATE_NEW );
+  }
+  if(observed)
+    oyOptions_ObserverAdd( opts, (oyStruct_s*)observer, NULL,
+                           oyBenchCountSignal );
+
+  oy_bench_signals = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    sprintf( value, "%d", i + 1 );
+    if(batched)
+      oyStruct_SignalBatchBegin( (oyStruct_s*)opts );
+    for(j = 0; j < 16; ++j)
+      error = oyOptions_SetFromString( &opts, regs[j], value, 0 );
+    if(batched)
+      oyStruct_SignalBatchEnd( (oyStruct_s*)opts );
+  }
+  if(observed && !oy_bench_signals)
+    error = 1;
+
+  for(j = 0; j < 16; ++j)
+    oyFree_m_( regs[j] );
+  oyOptions_Release( &opts );
+  oyOption_Release( &observer );
+  return error;
+}
+static int oyBenchOptionEditsQuiet   ( int                 n )
+{ return oyBenchOptionEdits( n, 0, 0 ); }
+static int oyBenchOptionEditsSignals ( int                 n )
+{ return oyBenchOptionEdits( n, 1, 0 ); }
+static int oyBenchOptionEditsBatched ( int                 n )
+{ return oyBenchOptionEdits( n, 1, 1 ); }
+
+static int oyBenchJsonWrite          ( int                 n )
+{
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyjl_val root = oyjlTreeParse( oy_bench_json, NULL, 0 );
+    char * json = NULL;
+    int level = 0;
+
+    oyjlTreeToJson( root, &level, &json );
+    if(!json) error = 1;
+    oyjlTreeFree( root );
+    free( json );
+  }
+  return error;
+}
+
+static int oyBenchJsonParseDB        ( int                 n,
+                                       int                 arena )
+{
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyjl_val root = arena ? oyjlTreeParseArena( oy_bench_db_json, NULL, 0 ) :
+                            oyjlTreeParse( oy_bench_db_json, NULL, 0 );
+    if(oyjlValueCount( oyjlTreeGetValue( root, 0,
+                                   "org/freedesktop/openicc/device/[0]" ) ) != 2000)
+      error = 1;
+    if(arena)
+      oyjlTreeFreeArena( root );
+    else
+      oyjlTreeFree( root );
+  }
+  return error;
+}
+static int oyBenchJsonParseDBMalloc  ( int                 n )
+{ return oyBenchJsonParseDB( n, 0 ); }
+static int oyBenchJsonParseDBArena   ( int                 n )
+{ return oyBenchJsonParseDB( n, 1 ); }
+
+static int oyBenchJsonOptions        ( int                 n )
+{
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyOptions_s * opts = oyOptions_Copy( oy_bench_options, NULL );
+    const char * t;
+    /* touch the set to defeat text caching */
+    error = oyOptions_SetFromInt( &opts, "//" OY_TYPE_STD "/bench/count",
+                                  i, 0, OY_CREATE_NEW );
+    t = oyOptions_GetText( opts, (oyNAME_e)oyNAME_JSON );
+    if(!t) error = 1;
+    oyOptions_Release( &opts );
+  }
+  return error;
+}
+
+static int oyBenchCacheLookup        ( int                 n,
+                                       int                 stats )
+{
+  int i, error = 0,
+      old = oyStatsSet( stats ? oySTATS_ENABLE : 0 );
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyHash_s * entry = oyCMMCacheListGetEntry_( "org/freedesktop/openicc/bench/cache_lookup" );
+    if(!entry) error = 1;
+    oyHash_Release( &entry );
+  }
+  oyStatsSet( old );
+  return error;
+}
+static int oyBenchCacheLookupOff     ( int                 n )
+{ return oyBenchCacheLookup( n, 0 ); }
+static int oyBenchCacheLookupStats   ( int                 n )
+{ return oyBenchCacheLookup( n, 1 ); }
+
+static int oyBenchEnvGetenv          ( int                 n )
+{
+  int i, found = 0,
+      expected = getenv( "OY_DEBUG_WRITE" ) ? n : 0;
+  for(i = 0; i < n; ++i)
+    if(getenv( "OY_DEBUG_WRITE" )) ++found;
+  return found != expected;
+}
+static int oyBenchEnvSnapshot        ( int                 n )
+{
+  int i, found = 0,
+      expected = getenv( "OY_DEBUG_WRITE" ) ? n : 0;
+  for(i = 0; i < n; ++i)
+    if(oyEnvGetString( oyENV_DEBUG_WRITE )) ++found;
+  return found != expected;
+}
+static int oyBenchImageFillArray     ( int                 n )
+{
+  int i, error = 0;
+  uint16_t buf[64*64*3];
+  oyImage_s * image;
+  oyArray2d_s * a = NULL;
+
+  memset( buf, 0, sizeof(buf) );
+  image = oyImage_Create( 64, 64, buf, OY_TYPE_123_16, oy_bench_web, NULL );
+  if(!image)
+    return 1;
+  for(i = 0; i < n && !error; ++i)
+  {
+    /* a per call allocation as in oyFilterPlug_ImageRootRun() */
+    error = oyImage_FillArray( image, NULL, 1, &a, NULL, NULL );
+    oyArray2d_Release( &a );
+  }
+  oyImage_Release( &image );
+  return error;
+}
+
+/* abstract proofing profile with a 53^3 grid from lcm2 */
+static int oyBenchProofingEffect     ( int                 n )
+{
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyOptions_s * opts = NULL, * result = NULL;
+    oyProfile_s * proof = oyProfile_FromStd( oyPROFILE_PROOF, 0, NULL ),
+                * abstract;
+
+    /* the effect is cached otherwise */
+    oyStructList_Clear( *oyCMMCacheList_() );
+    oyOptions_MoveInStruct( &opts, "//" OY_TYPE_STD "/icc_profile.proofing_profile",
+                            (oyStruct_s**) &proof, OY_CREATE_NEW );
+    oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.proofing_effect",
+                      opts, "create_profile.proofing_effect", &result );
+    abstract = (oyProfile_s*) oyOptions_GetType( result, -1, "icc_profile",
+                                                 oyOBJECT_PROFILE_S );
+    if(!abstract)
+      error = 1;
+    oyProfile_Release( &abstract );
+    oyOptions_Release( &result );
+    oyOptions_Release( &opts );
+  }
+  return error;
+}
+
+static int oyBenchParseCGATS         ( int                 n )
+{
+  int i, error = 0;
+  oyOptions_s * opts = NULL;
+  oyOptions_SetFromString( &opts, "//" OY_TYPE_STD "/cgats", oy_bench_cgats,
+                           OY_CREATE_NEW );
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyOptions_s * result = NULL;
+    oyImage_s * image;
+    oyOptions_Handle( "//" OY_TYPE_STD "/parse_cgats", opts,
+                      "parse_cgats", &result );
+    image = (oyImage_s*) oyOptions_GetType( result, -1, "colors",
+                                            oyOBJECT_IMAGE_S );
+    if(oyImage_GetWidth( image ) != OY_BENCH_CGATS_SETS)
+      error = 1;
+    oyImage_Release( &image );
+    oyOptions_Release( &result );
+  }
+  oyOptions_Release( &opts );
+  return error;
+}
+
+/* module command lookup without a handling module */
+static int oyBenchOptionsHandleNone  ( int                 n )
+{
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyOptions_s * result = NULL;
+    if(oyOptions_Handle( "//" OY_TYPE_STD "/bench_no_module", oy_bench_options,
+                         "bench_no_module", &result ) > 0)
+      error = 1;
+    oyOptions_Release( &result );
+  }
+  return error;
+}
+
+/* a command from a oyCMMapi10_s::commands table, called without probe;
+ * the ".file_name" variant only formats the profile name */
+static int oyBenchOptionsHandleDeclared( int               n )
+{
+  double d50[3] = {0.9642, 1.0, 0.8249}, d65[3] = {0.9505, 1.0, 1.0890};
+  int i, error = 0;
+  oyOptions_s * opts = NULL;
+  for(i = 0; i < 3; ++i)
+  {
+    oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/src_iccXYZ", d65[i], i, OY_CREATE_NEW );
+    oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/illu_iccXYZ", d50[i], i, OY_CREATE_NEW );
+  }
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyOptions_s * result = NULL;
+    oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.white_point_adjust.bradford",
+                      opts, "create_profile.white_point_adjust.bradford.file_name",
+                      &result );
+    if(!oyOptions_FindString( result, "file_name", 0 ))
+      error = 1;
+    oyOptions_Release( &result );
+  }
+  oyOptions_Release( &opts );
+  return error;
+}
+
+/* a module without commands table gets the "can_handle" probe first;
+ * the lcm2 Lab white point module refuses the command in the probe */
+static int oyBenchOptionsHandleProbed( int                 n )
+{
+  int i, error = 0;
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyOptions_s * result = NULL;
+    if(oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.white_point_adjust.lab",
+                         oy_bench_options, "bench_probe", &result ) > 0)
+      error = 1;
+    oyOptions_Release( &result );
+  }
+  return error;
+}
+
+static int oy_bench_jobs_done = 0;
+static int oyBenchJobWork            ( oyJob_s           * job OY_UNUSED )
+{ return 0; }
+static int oyBenchJobFinish          ( oyJob_s           * job OY_UNUSED )
+{ ++oy_bench_jobs_done; return 0; }
+static int oyBenchJobRoundTrip       ( int                 n )
+{
+  int i, error = 0;
+  double start = oySeconds();
+  oy_bench_jobs_done = 0;
+  for(i = 0; i < n; ++i)
+  {
+    oyJob_s * job = oyJob_New( NULL );
+    job->work = oyBenchJobWork;
+    job->finish = oyBenchJobFinish;
+    oyJob_Add( &job, 0, 0 );
+    while(oy_bench_jobs_done <= i)
+    {
+      oyJobResult();
+      /* stalled queue */
+      if(oySeconds() - start > 60.0)
+        return 1;
+    }
+  }
+  return error;
+}
+
+/* --- driver --- */
+
+typedef struct {
+  const char * name;                   /**< stable key in the JSON results */
+  int       (* run)( int n );          /**< run n operations; 0 on success */
+  int          n;                      /**< operations per round */
+  int          pixels;                 /**< pixels per operation or zero */
+} oyBenchCase_s;
+
+static oyBenchCase_s oy_bench_cases[] = {
+  { "profile_open_std",        oyBenchProfileOpenStd,   2000, 0 },
+  { "profile_open_file",       oyBenchProfileOpenFile,    50, 0 },
+  { "profile_list",            oyBenchProfileList,         2, 0 },
+  { "profile_open_mem",        oyBenchProfileOpenMem,    200, 0 },
+  { "profile_tag_lookup",      oyBenchProfileTagLookup,    2, 0 },
+  { "transform_setup_cold",    oyBenchSetupCold,          10, 0 },
+  { "transform_setup_cached",  oyBenchSetupCached,       100, 0 },
+  { "conversion_correct",      oyBenchConversionCorrect,  200, 0 },
+  { "run_pixels_u8_64x64",     oyBenchRunU8_64,          500, 64*64 },
+  { "run_pixels_u16_64x64",    oyBenchRunU16_64,         500, 64*64 },
+  { "run_pixels_float_64x64",  oyBenchRunFloat_64,       500, 64*64 },
+  { "run_pixels_u8_1024x1024", oyBenchRunU8_1024,         10, 1024*1024 },
+  { "run_pixels_u16_1024x1024",oyBenchRunU16_1024,        10, 1024*1024 },
+  { "run_pixels_float_1024x1024",oyBenchRunFloat_1024,    10, 1024*1024 },
+  { "tile_requests_create",    oyBenchTilesCreate,     10000, 64*64 },
+  { "tile_requests_pooled",    oyBenchTilesPooled,     10000, 64*64 },
+  { "cache_lookup",            oyBenchCacheLookupOff,   10000, 0 },
+  { "cache_lookup_stats",      oyBenchCacheLookupStats, 10000, 0 },
+  { "option_find",             oyBenchOptionFind,      10000, 0 },
+  { "option_edits",            oyBenchOptionEditsQuiet,   500, 0 },
+  { "option_edits_signals",    oyBenchOptionEditsSignals, 500, 0 },
+  { "option_edits_batched",    oyBenchOptionEditsBatched, 500, 0 },
+  { "registration_match",      oyBenchRegistrationMatch, 10000, 0 },
+  { "registration_match_compiled",oyBenchRegistrationMatchCompiled,10000,0},
+  { "json_tree_round_trip",    oyBenchJsonWrite,        1000, 0 },
+  { "json_options_text",       oyBenchJsonOptions,       200, 0 },
+  { "json_parse_db",           oyBenchJsonParseDBMalloc,  20, 0 },
+  { "json_parse_db_arena",     oyBenchJsonParseDBArena,   20, 0 },
+  { "proofing_effect_53",      oyBenchProofingEffect,      2, 0 },
+  { "options_handle_none",     oyBenchOptionsHandleNone,  2000, 0 },
+  { "options_handle_declared", oyBenchOptionsHandleDeclared, 2000, 0 },
+  { "options_handle_probed",   oyBenchOptionsHandleProbed, 2000, 0 },
+  { "parse_cgats_20000",       oyBenchParseCGATS,         20, OY_BENCH_CGATS_SETS },
+  { "job_round_trip",          oyBenchJobRoundTrip,      200, 0 },
+  { "env_getenv",              oyBenchEnvGetenv,     100000, 0 },
+  { "env_snapshot",            oyBenchEnvSnapshot,   100000, 0 },
+  { "image_fill_array_64x64",  oyBenchImageFillArray,   2000, 64*64 },
+  { NULL, NULL, 0, 0 }
+};
+
+/* resident memory in kilobytes; 0 if unknown */
+static long oyBenchRSS               ( void )
+{
+  long pages = 0, rss = 0;
+  FILE * fp = fopen( "/proc/self/statm", "r" );
+  if(fp)
+  {
+    if(fscanf( fp, "%ld %ld", &pages, &rss ) != 2)
+      rss = 0;
+    fclose( fp );
+  }
+#if defined(_SC_PAGESIZE)
+  return rss * (sysconf(_SC_PAGESIZE) / 1024);
+#else
+  return rss * 4;
+#endif
+}
+
+static int oyBenchCompareDouble      ( const void        * a,
+                                       const void        * b )
+{
+  double da = *(const double*)a, db = *(const double*)b;
+  return da < db ? -1 : da > db ? 1 : 0;
+}
+
+static void  printfHelp              ( const char        * prog )
+{
+  fprintf( stderr, "\n%s v%s - %s\n", prog, OYRANOS_VERSION_NAME,
+           "benchmark Oyranos hot paths" );
+  fprintf( stderr, "  %s [-o FILE] [-b FILE] [-t PERCENT] [-r ROUNDS] [-l] [FILTER]\n", prog );
+  fprintf( stderr, "      -o FILE\twrite JSON results to FILE instead of stdout\n" );
+  fprintf( stderr, "      -b FILE\tcompare against a previous JSON result\n" );
+  fprintf( stderr, "      -t PERCENT\tallowed slow down against baseline; default 10\n" );
+  fprintf( stderr, "      -r ROUNDS\ttimed rounds per case; the median is reported; default 5\n" );
+  fprintf( stderr, "      -l\tlist case names\n" );
+  fprintf( stderr, "      FILTER\trun only cases containing FILTER in their name\n" );
+  fprintf( stderr, "  profile_list scans the profile paths; extend them with XDG_DATA_DIRS\n\n" );
+}
+
+int main( int argc, char ** argv )
+{
+  const char * output = NULL,
+             * baseline = NULL,
+             * filter = NULL;
+  double tolerance = 10.0;
+  int rounds = 5, list = 0, i, j, error = 0, regressions = 0, first = 1;
+  oyjl_val base = NULL;
+  char * json = NULL;
+  double * times;
+
+  for(i = 1; i < argc; ++i)
+  {
+    if(strcmp(argv[i],"-o") == 0 && i+1 < argc) output = argv[++i];
+    else if(strcmp(argv[i],"-b") == 0 && i+1 < argc) baseline = argv[++i];
+    else if(strcmp(argv[i],"-t") == 0 && i+1 < argc) tolerance = atof(argv[++i]);
+    else if(strcmp(argv[i],"-r") == 0 && i+1 < argc) rounds = atoi(argv[++i]);
+    else if(strcmp(argv[i],"-l") == 0) list = 1;
+    else if(argv[i][0] == '-') { printfHelp( argv[0] ); return 1; }
+    else filter = argv[i];
+  }
+  if(rounds < 1) rounds = 1;
+
+  if(list)
+  {
+    for(i = 0; oy_bench_cases[i].name; ++i)
+      printf( "%s\n", oy_bench_cases[i].name );
+    return 0;
+  }
+
+  if(baseline)
+  {
+    FILE * fp = fopen( baseline, "rb" );
+    char * text = NULL;
+    int size = 0;
+    char msg[128];
+    if(fp)
+    {
+      text = oyjlReadFileStreamToMem( fp, &size );
+      fclose( fp );
+    }
+    if(text)
+      base = oyjlTreeParse( text, msg, sizeof(msg) );
+    if(!base)
+    {
+      fprintf( stderr, "could not read baseline %s %s\n", baseline,
+               text ? msg : "" );
+      free( text );
+      return 1;
+    }
+    free( text );
+  }
+
+  oyExportStart_(EXPORT_CHECK_NO);
+
+  if(oyBenchInit())
+  {
+    fprintf( stderr, "could not set up benchmark data\n" );
+    oyBenchFinish();
+    return 1;
+  }
+
+  times = (double*) calloc( sizeof(double), rounds );
+
+  oyStringAddPrintf( &json, 0,0, "{\n  \"version\": \"%s\",\n  \"rounds\": %d,\n  \"results\": {",
+                     OYRANOS_VERSION_NAME, rounds );
+
+  for(i = 0; oy_bench_cases[i].name; ++i)
+  {
+    oyBenchCase_s * c = &oy_bench_cases[i];
+    double median, min, ns;
+    int failed = 0;
+
+    if(filter && !strstr( c->name, filter ))
+      continue;
+
+    /* one untimed round to load modules and fill caches */
+    failed = c->run( 1 );
+
+    for(j = 0; j < rounds && !failed; ++j)
+    {
+      double clck = oyClock();
+      failed = c->run( c->n );
+      times[j] = oyClock() - clck;
+    }
+    if(failed)
+    {
+      fprintf( stderr, "%-28s failed\n", c->name );
+      error = 1;
+      continue;
+    }
+
+    qsort( times, rounds, sizeof(double), oyBenchCompareDouble );
+    min = times[0] * 1000.0 / c->n;
+    median = times[rounds/2] * 1000.0 / c->n;
+
+    oyStringAddPrintf( &json, 0,0, "%s\n    \"%s\": {\n      \"n\": %d,\n      \"ns_per_op\": %.1f,\n      \"ns_per_op_min\": %.1f",
+                       first ? "" : ",", c->name, c->n,
+                       median, min );
+    if(c->pixels)
+      oyStringAddPrintf( &json, 0,0, ",\n      \"pixels_per_s\": %.0f",
+                         c->pixels * 1.0e9 / median );
+    if(oyBenchRSS())
+      oyStringAddPrintf( &json, 0,0, ",\n      \"rss_kb\": %ld",
+                         oyBenchRSS() );
+    oyStringAddPrintf( &json, 0,0, "\n    }" );
+    first = 0;
+
+    fprintf( stderr, "%-28s %12.1f ns/op", c->name, median );
+
+    if(base)
+    {
+      oyjl_val v = oyjlTreeGetValuef( base, 0, "results/%s/ns_per_op", c->name );
+      if(OYJL_IS_NUMBER(v))
+      {
+        ns = OYJL_IS_DOUBLE(v) ? OYJL_GET_DOUBLE(v) : OYJL_GET_INTEGER(v);
+        fprintf( stderr, "  baseline %12.1f  %+6.1f%%", ns,
+                 ns > 0.0 ? (median / ns - 1.0) * 100.0 : 0.0 );
+        if(ns > 0.0 && median > ns * (1.0 + tolerance / 100.0))
+        {
+          fprintf( stderr, "  REGRESSION" );
+          ++regressions;
+        }
+      }
+    }
+    fprintf( stderr, "\n" );
+  }
+
+  oyStringAddPrintf( &json, 0,0, "\n  }\n}\n" );
+
+  if(output)
+  {
+    FILE * fp = fopen( output, "wb" );
+    if(fp)
+    {
+      fputs( json, fp );
+      fclose( fp );
+    } else
+    {
+      fprintf( stderr, "could not write %s\n", output );
+      error = 1;
+    }
+  } else
+    fputs( json, stdout );
+
+  if(regressions)
+    fprintf( stderr, "%d regression(s) above %.1f%%\n", regressions, tolerance );
+
+  oyFree_m_( json );
+  free( times );
+  oyjlTreeFree( base );
+  oyBenchFinish();
+  oyFinish_( 0 );
+
+  return error || regressions;
+}
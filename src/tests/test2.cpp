@@ -24,6 +24,7 @@
   TEST_RUN( testOptionsSet,  "Set oyOptions_s", 1 ); \
   TEST_RUN( testOptionsCopy,  "Copy oyOptions_s", 1 ); \
   TEST_RUN( testOptionsType,  "Objects inside oyOptions_s", 1 ); \
+  TEST_RUN( testObserver,  "Observer signals", 1 ); \
   TEST_RUN( testBlob, "oyBlob_s", 1 ); \
   TEST_RUN( testSettings, "default oyOptions_s settings", 1 ); \
   TEST_RUN( testConfDomain, "oyConfDomain_s", 1 ); \
@@ -31,7 +32,9 @@
   TEST_RUN( testProfile, "Profile handling", 1 ); \
   TEST_RUN( testProfiles, "Profiles reading", 1 ); \
   TEST_RUN( testProfileLists, "Profile lists", 1 ); \
+  TEST_RUN( testProfileMapped, "Profile file mapping", 1 ); \
   TEST_RUN( testEffects, "Effects", 1 ); \
+  TEST_RUN( testVCGT, "VCGT ramps", 1 ); \
   TEST_RUN( testDeviceLinkProfile, "CMM deviceLink", 1 ); \
   TEST_RUN( testClut, "CMM clut", 1 ); \
   TEST_RUN( testRegistrationMatch,  "Registration matching", 1 ); \
@@ -40,23 +43,37 @@
   TEST_RUN( testWidgets, "Widgets", 1 ); \
   TEST_RUN( testCMMDevicesListing, "CMM devices listing", 1 ); \
   TEST_RUN( testCMMDevicesDetails, "CMM devices details", 1 ); \
+  TEST_RUN( testCMMPrinterPPD, "CMM printer PPD cache", 1 ); \
+  TEST_RUN( testCMMScannerCache, "CMM scanner cache", 1 ); \
+  TEST_RUN( testCMMRawPreview, "CMM raw preview", 1 ); \
   TEST_RUN( testCMMRankMap, "rank map handling", 1 ); \
   TEST_RUN( testCMMMonitorJSON, "monitor JSON", displayFail() == oyTESTRESULT_FAIL ); \
   TEST_RUN( testCMMMonitorListing, "CMM monitor listing", displayFail() == oyTESTRESULT_FAIL ); \
   TEST_RUN( testCMMMonitorModule, "CMM monitor module", displayFail() == oyTESTRESULT_FAIL ); \
+  TEST_RUN( testCMMMonitorCache, "CMM monitor cache", displayFail() == oyTESTRESULT_FAIL ); \
   TEST_RUN( testCMMDBListing, "CMM DB listing", 1 ); \
   TEST_RUN( testCMMmonitorDBmatch, "CMM monitor DB match", displayFail() == oyTESTRESULT_FAIL ); \
   TEST_RUN( testCMMsShow, "CMMs show", 1 ); \
   TEST_RUN( testCMMnmRun, "CMM named color run", 1 ); \
   TEST_RUN( testImagePixel, "CMM Image Pixel run", 1 ); \
+  TEST_RUN( testImageExpose, "Image expose", 1 ); \
   TEST_RUN( testRectangles, "Image Rectangles", 1 ); \
   TEST_RUN( testScreenPixel, "Draw Screen Pixel run", 1 ); \
+  TEST_RUN( testDisplayTiles, "Display tile cache", 1 ); \
+  TEST_RUN( testConversionTickets, "Conversion tickets", 1 ); \
+  TEST_RUN( testGraphContexts, "Graph context preparation", 1 ); \
+  TEST_RUN( testGamutHull, "Gamut hull and volume", 1 ); \
+  TEST_RUN( testProofGrid, "Proofing grid sampling", 1 ); \
+  TEST_RUN( testProofCache, "Proofing abstract cache", 1 ); \
+  TEST_RUN( testCGATS, "CGATS parsing", 1 ); \
   TEST_RUN( testFilterNode, "FilterNode Options", 1 ); \
   TEST_RUN( testConversion, "CMM selection", 1 ); \
   TEST_RUN( testCMMlists, "CMMs listing", 1 ); \
   TEST_RUN( testICCsCheck, "CMMs ICC conversion check", 1 ); \
   TEST_RUN( testCCorrectFlags, "Conversion Correct Option Flags", 1 ); \
   TEST_RUN( testCache, "Cache", 1 ); \
+  TEST_RUN( testStats, "Instrumentation", 1 ); \
+  TEST_RUN( testEnv, "Environment snapshot", 1 ); \
   TEST_RUN( testPaths, "Paths", 1 );
 
 #include "oy_test.h"
@@ -1937,6 +1954,101 @@ oyTESTRESULT_e testOptionsType ()
   return result;
 }
 
+#include "oyObserver_s.h"
+
+static int oy_test_signals[16], oy_test_signals_n = 0;
+static int oyTestRecordSignal        ( oyObserver_s      * observer OY_UNUSED,
+                                       oySIGNAL_e          signal_type,
+                                       oyStruct_s        * signal_data OY_UNUSED )
+{
+  if(oy_test_signals_n < 16)
+    oy_test_signals[oy_test_signals_n++] = signal_type;
+  return 0;
+}
+
+oyTESTRESULT_e testObserver ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  int i, n;
+
+  fprintf(stdout, "\n" );
+
+  oyOption_s * model = oyOption_FromRegistration( OY_STD "/observed.test", testobj ),
+             * observer = oyOption_New( testobj );
+
+  n = oyStruct_ObserverSignal( (oyStruct_s*)model, oySIGNAL_DATA_CHANGED, 0 );
+  if( n == 0 && !oyStruct_IsObserved( (oyStruct_s*)model, NULL ) )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyStruct_ObserverSignal() without observer  " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyStruct_ObserverSignal() without observer  " );
+  }
+
+  oyStruct_ObserverAdd( (oyStruct_s*)model, (oyStruct_s*)observer, NULL,
+                        oyTestRecordSignal );
+  oy_test_signals_n = 0;
+  oyStruct_ObserverSignal( (oyStruct_s*)model, oySIGNAL_DATA_CHANGED, 0 );
+  oyStruct_ObserverSignal( (oyStruct_s*)model, oySIGNAL_USER1, 0 );
+  if( oy_test_signals_n == 2 &&
+      oy_test_signals[0] == oySIGNAL_DATA_CHANGED &&
+      oy_test_signals[1] == oySIGNAL_USER1 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyStruct_ObserverSignal() direct            " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyStruct_ObserverSignal() direct %d         ", oy_test_signals_n );
+  }
+
+  oy_test_signals_n = 0;
+  oyStruct_SignalBatchBegin( (oyStruct_s*)model );
+  oyStruct_ObserverSignal( (oyStruct_s*)model, oySIGNAL_USER2, 0 );
+  for(i = 0; i < 10; ++i)
+  {
+    char num[16];
+    sprintf( num, "%d", i );
+    oyOption_SetFromString( model, num, 0 );
+  }
+  oyStruct_ObserverSignal( (oyStruct_s*)model, oySIGNAL_USER2, 0 );
+  oyStruct_ObserverSignal( (oyStruct_s*)model, oySIGNAL_USER1, 0 );
+  /* nested scopes send with the outermost one */
+  oyStruct_SignalBatchBegin( (oyStruct_s*)model );
+  oyStruct_ObserverSignal( (oyStruct_s*)model, oySIGNAL_DATA_CHANGED, 0 );
+  oyStruct_SignalBatchEnd( (oyStruct_s*)model );
+  n = oy_test_signals_n;
+  i = oyStruct_SignalBatchEnd( (oyStruct_s*)model );
+  if( n == 0 && i == 3 && oy_test_signals_n == 3 &&
+      oy_test_signals[0] == oySIGNAL_USER2 &&
+      oy_test_signals[1] == oySIGNAL_DATA_CHANGED &&
+      oy_test_signals[2] == oySIGNAL_USER1 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyStruct_SignalBatchEnd() coalesced in order" );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyStruct_SignalBatchEnd() coalesced in order %d %d", i, oy_test_signals_n );
+  }
+
+  oy_test_signals_n = 0;
+  oyStruct_DisableSignalSend( (oyStruct_s*)model );
+  oyStruct_ObserverSignal( (oyStruct_s*)model, oySIGNAL_DATA_CHANGED, 0 );
+  oyStruct_EnableSignalSend( (oyStruct_s*)model );
+  oyStruct_ObserverRemove( (oyStruct_s*)model, (oyStruct_s*)observer,
+                           oyTestRecordSignal );
+  oyStruct_ObserverSignal( (oyStruct_s*)model, oySIGNAL_DATA_CHANGED, 0 );
+  if( oy_test_signals_n == 0 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "disabled and removed observer               " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "disabled and removed observer %d            ", oy_test_signals_n );
+  }
+
+  oyOption_Release( &model );
+  oyOption_Release( &observer );
+
+  return result;
+}
+
 #include "oyranos_icc.h"
 
 oyTESTRESULT_e testProfile ()
@@ -2520,6 +2632,150 @@ oyTESTRESULT_e testProfileLists ()
 
 #include "oyProfile_s_.h"           /* oyProfile_ToFile_ */
 #include "oyranos_color.h"
+#include <sys/stat.h>                /* chmod() */
+#include <unistd.h>                  /* geteuid() */
+
+oyTESTRESULT_e testProfileMapped ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t flags = OY_NO_CACHE_READ | OY_NO_CACHE_WRITE;
+  uint32_t i, n = 0;
+  char ** names = oyProfileListGet( NULL, &n, oyAllocateFunc_ );
+  oyProfile_s * p1 = NULL, * p2 = NULL, * p3 = NULL;
+  const char * name = NULL;
+
+  fprintf(stdout, "\n" );
+
+  /* mapping is used for larger profiles only */
+  for(i = 0; i < n && !p1; ++i)
+  {
+    p1 = oyProfile_FromFile( names[i], flags, NULL );
+    if(oyProfile_GetSize( p1, 0 ) >= 65536 &&
+       oyIsMappedMem_( ((oyProfile_s_*)p1)->block_ ))
+      name = names[i];
+    else
+      oyProfile_Release( &p1 );
+  }
+
+  if(!p1)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "no read only profile >= 64 KiB found in %u       ", n );
+    oyStringListRelease( &names, n, oyDeAllocateFunc_ );
+    return result;
+  }
+
+  p2 = oyProfile_FromFile( name, flags, NULL );
+  oyPointer b1 = ((oyProfile_s_*)p1)->block_,
+            b2 = ((oyProfile_s_*)p2)->block_;
+  if(b1 && b1 == b2 && oyIsMappedMem_( b1 ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "shared mapping %s %d", name, (int)oyProfile_GetSize( p1, 0 ) );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "shared mapping %s                                 ", name );
+  }
+
+  size_t size = 0, fsize = 0;
+  char * mem = (char*) oyProfile_GetMem( p2, &size, 0, oyAllocateFunc_ );
+  char * file = oyReadFileToMem_( oyProfile_GetFileName( p2, -1 ), &fsize,
+                                  oyAllocateFunc_ );
+  if(mem && file && size == fsize && memcmp( mem, file, size ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyProfile_GetMem() == file                        " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_GetMem() == file %d %d                  ", (int)size, (int)fsize );
+  }
+  oyFree_m_( mem );
+
+  p3 = oyProfile_Copy( p2, testobj );
+  if(((oyProfile_s_*)p3)->block_ == b1)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyProfile_Copy() shares mapping                   " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_Copy() shares mapping                   " );
+  }
+
+  /* writing must not reach the file or the other profiles */
+  oyProfile_SetSignature( p2, icSigAbstractClass, oySIGNATURE_CLASS );
+  if(((oyProfile_s_*)p2)->block_ != b1 &&
+     oyProfile_GetSignature( p2, oySIGNATURE_CLASS ) == icSigAbstractClass &&
+     oyProfile_GetSignature( p1, oySIGNATURE_CLASS ) != icSigAbstractClass &&
+     memcmp( b1, file, 128 ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyProfile_SetSignature() unshares                 " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_SetSignature() unshares                 " );
+  }
+
+  /* a writable file can be truncated in place by any tool */
+  const char * copy_name = "/tmp/oy_test_mapped.icc";
+  oyProfile_s * pc1 = NULL, * pc2 = NULL;
+  int error = file ? oyWriteMemToFile_( copy_name, file, fsize ) : 1;
+  if(!error)
+    pc1 = oyProfile_FromFile( copy_name, flags, NULL );
+  oyPointer bc1 = pc1 ? ((oyProfile_s_*)pc1)->block_ : NULL;
+  if(bc1 && !oyIsMappedMem_( bc1 ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "writable file is read, not mapped                 " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "writable file is read, not mapped                 " );
+  }
+  oyProfile_Release( &pc1 );
+
+  /* a rewrite replaces the file; live mappings keep the old content */
+  if(!error && chmod( copy_name, 0444 ) == 0)
+    pc1 = oyProfile_FromFile( copy_name, flags, NULL );
+  bc1 = pc1 ? ((oyProfile_s_*)pc1)->block_ : NULL;
+  if(bc1 && !oyIsMappedMem_( bc1 ) && geteuid() == 0)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "root can write to any file; no mapping            " );
+  } else
+  {
+    if(bc1 && oyIsMappedMem_( bc1 ))
+    {
+      char * half = (char*) oyAllocateFunc_( fsize / 2 );
+      memcpy( half, file, fsize / 2 );
+      error = oyWriteMemToFile_( copy_name, half, fsize / 2 );
+      oyFree_m_( half );
+      pc2 = oyProfile_FromFile( copy_name, flags, NULL );
+    }
+    size_t csize = 0;
+    char * cfile = oyReadFileToMem_( copy_name, &csize, oyAllocateFunc_ );
+    if(bc1 && !error && csize == fsize / 2 &&
+       memcmp( bc1, file, fsize ) == 0 &&
+       (!pc2 || ((oyProfile_s_*)pc2)->block_ != bc1))
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyWriteMemToFile_() keeps mapping valid           " );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyWriteMemToFile_() keeps mapping valid %d %d      ", error, (int)csize );
+    }
+    if(cfile) oyFree_m_( cfile );
+  }
+  oyProfile_Release( &pc1 );
+  oyProfile_Release( &pc2 );
+  oyRemoveFile_( copy_name );
+
+  if(file) oyFree_m_( file );
+
+  oyProfile_Release( &p1 );
+  oyProfile_Release( &p3 );
+  if(!oyIsMappedMem_( b1 ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "last user unmaps                                  " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "last user unmaps                                  " );
+  }
+  oyProfile_Release( &p2 );
+  oyStringListRelease( &names, n, oyDeAllocateFunc_ );
+
+  return result;
+}
 
 oyTESTRESULT_e testEffects ()
 {
@@ -2669,6 +2925,171 @@ oyTESTRESULT_e testEffects ()
   return result;
 }
 
+#include "oyranos_monitor_effect.h"
+
+static void testVCGTSet16_( uint8_t * data, int pos, uint16_t v )
+{ data[pos] = v >> 8; data[pos+1] = v & 0xff; }
+static void testVCGTSet32_( uint8_t * data, int pos, uint32_t v )
+{ testVCGTSet16_( data, pos, v >> 16 ); testVCGTSet16_( data, pos+2, v & 0xffff ); }
+
+/* sRGB copy with a vcgt tag from data */
+static oyProfile_s * testVCGTProfile_( uint8_t * data, int size )
+{
+  oyProfile_s * web = oyProfile_FromStd( oyASSUMED_WEB, 0, testobj ),
+              * p = oyProfile_Copy( web, testobj );
+  oyProfileTag_s * tag;
+  void * mem = oyAllocateFunc_( size );
+
+  /* parse the original tags first */
+  oyProfile_GetTagCount( p );
+  memcpy( mem, data, size );
+  testVCGTSet32_( (uint8_t*)mem, 0, icSigVideoCardGammaTable );
+  tag = oyProfileTag_CreateFromData( (icTagSignature) icSigVideoCardGammaTable,
+                                     (icTagTypeSignature) icSigVideoCardGammaTable,
+                                     oyOK, size, mem, testobj );
+  oyProfile_TagMoveIn( p, &tag, -1 );
+  oyProfile_Release( &web );
+  return p;
+}
+
+oyTESTRESULT_e testVCGT ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint8_t data[18 + 3*4*2];
+  uint16_t start[12] = {0,0,0, 20000,20000,20000, 40000,40000,40000, 65535,65535,65535},
+           end[12] = {0,0,0, 10000,20000,30000, 20000,40000,60000, 32768,65535,65535},
+           mix[12], * ramp;
+  oyProfile_s * p;
+  int width, i, fails = 0;
+
+  fprintf(stdout, "\n" );
+
+  /* 8 bit table, one curve for all channels */
+  memset( data, 0, sizeof(data) );
+  testVCGTSet16_( data, 12, 1 );
+  testVCGTSet16_( data, 14, 4 );
+  testVCGTSet16_( data, 16, 1 );
+  data[18] = 0; data[19] = 64; data[20] = 128; data[21] = 255;
+  p = testVCGTProfile_( data, 22 );
+  width = 0;
+  ramp = oyProfile_GetVCGT( p, &width );
+  if(ramp && width == 4 && ramp[3*1+2] == 64*257 && ramp[3*3+0] == 65535)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyProfile_GetVCGT( 8 bit )                       " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_GetVCGT( 8 bit ) %d %d                 ", width, ramp?ramp[3]:-1 );
+  }
+  free( ramp );
+  oyProfile_Release( &p );
+
+  /* 16 bit tables, one per channel */
+  memset( data, 0, sizeof(data) );
+  testVCGTSet16_( data, 12, 3 );
+  testVCGTSet16_( data, 14, 4 );
+  testVCGTSet16_( data, 16, 2 );
+  for(i = 0; i < 12; ++i)
+    testVCGTSet16_( data, 18 + 2*i, end[(i%4)*3 + i/4] );
+  p = testVCGTProfile_( data, sizeof(data) );
+  width = 0;
+  ramp = oyProfile_GetVCGT( p, &width );
+  if(ramp && width == 4 && memcmp( ramp, end, sizeof(end) ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyProfile_GetVCGT( 16 bit )                      " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_GetVCGT( 16 bit ) %d                   ", width );
+  }
+  free( ramp );
+  oyProfile_Release( &p );
+
+  /* round trip over oyProfile_SetVCGT() */
+  {
+    oyProfile_s * web = oyProfile_FromStd( oyASSUMED_WEB, 0, testobj );
+    p = oyProfile_Copy( web, testobj );
+    oyProfile_Release( &web );
+  }
+  oyProfile_GetTagCount( p );
+  oyProfile_SetVCGT( p, start, 4 );
+  width = 0;
+  ramp = oyProfile_GetVCGT( p, &width );
+  if(ramp && width == 4 && memcmp( ramp, start, sizeof(start) ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyProfile_SetVCGT()                              " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_SetVCGT() %d                           ", width );
+  }
+  free( ramp );
+  oyProfile_Release( &p );
+
+  /* parametric: gamma 2.0 and min 0.0 / max 1.0 for red,
+   * gamma 1.0 and 0.25 - 0.75 for green and blue */
+  memset( data, 0, sizeof(data) );
+  testVCGTSet32_( data, 8, 1 );
+  testVCGTSet32_( data, 12, 2 << 16 );
+  testVCGTSet32_( data, 20, 1 << 16 );
+  for(i = 1; i < 3; ++i)
+  {
+    testVCGTSet32_( data, 12 + i*12, 1 << 16 );
+    testVCGTSet32_( data, 16 + i*12, 1 << 14 );
+    testVCGTSet32_( data, 20 + i*12, 3 << 14 );
+  }
+  p = testVCGTProfile_( data, 48 );
+  width = 5;
+  ramp = oyProfile_GetVCGT( p, &width );
+  if(ramp && width == 5 &&
+     ramp[3*2+0] == OY_ROUNDp(0.25*65535) && ramp[3*4+0] == 65535 &&
+     ramp[3*0+1] == OY_ROUNDp(0.25*65535) && ramp[3*2+2] == OY_ROUNDp(0.5*65535))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyProfile_GetVCGT( parametric )                  " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_GetVCGT( parametric ) %d %d            ", width, ramp?ramp[6]:-1 );
+  }
+  free( ramp );
+  oyProfile_Release( &p );
+
+  oyRampMixU16( start, end, mix, 12, 0.5 );
+  for(i = 0; i < 12; ++i)
+    if(abs( 2*mix[i] - start[i] - end[i] ) > 1)
+      ++fails;
+  oyRampMixU16( start, end, mix, 12, 1.5 );
+  if(memcmp( mix, end, sizeof(end) ) != 0)
+    ++fails;
+  if(!fails)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyRampMixU16()                                   " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyRampMixU16() %d                                ", fails );
+  }
+
+  p = oyProfile_FromStd( oyASSUMED_WEB, 0, testobj );
+  {
+    uint16_t * ramps = oyProfileGetWhitePointFade( 256, p, NULL, NULL, 10 );
+    double clck = oyClock();
+    uint16_t step[256*3];
+
+    for(i = 0; i < 1000; ++i)
+      oyRampMixU16( ramps, &ramps[256*3*10], step, 256*3, i/1000.0 );
+    clck = oyClock() - clck;
+
+    if(ramps && memcmp( ramps, &ramps[256*3*10], 256*3*sizeof(uint16_t) ) == 0)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyProfileGetWhitePointFade( 10 steps ) mix   %s",
+                   oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC,"ramp"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_XFAIL,
+      "oyProfileGetWhitePointFade( 10 steps )           " );
+    }
+    free( ramps );
+  }
+  oyProfile_Release( &p );
+
+  return result;
+}
+
 #include "oyImage_s.h"
 #include "oyConversion_s.h"
 
@@ -3588,6 +4009,7 @@ oyTESTRESULT_e testClut ()
 }
 
 
+#include "oyranos_object_internal.h"
 oyTESTRESULT_e testRegistrationMatch ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
@@ -3704,10 +4126,105 @@ oyTESTRESULT_e testRegistrationMatch ()
     "oyFilterStringMatch(sub string match) " );
   }
 
+  const char * regs[] = {
+    OY_INTERNAL "/icc_color.lcms",
+    "org/oyranos/openicc/icc_color/context.4+lcm2._icc_version_2.rendering_intent_proof",
+    "org/freedesktop/openicc/device/monitor/manufacturer/short",
+    "org/freedesktop/openicc/icc_color/display.icc_profile.abstract.white_point.automatic.oy-monitor",
+    "org/oyranos/openicc/icc_color/7_icc._lcm2.-x",
+    "abc-def-ghi", "a..b//c.", "", NULL };
+  const char * patterns[] = {
+    "icc_color", "lcms", "//icc_color/rendering_intent_proof",
+    "//" OY_TYPE_STD "/lcms", "4+lcm2", "4_lcm2", "4-lcm2", "7_icc",
+    "display.abstract.icc_profile", "-x", "+x", "_x", "manufacturer",
+    "org/freedesktop", "+def._ghi.-jkl", "def", "//", ".", "", NULL };
+  const int flags[] = { 0, OY_MATCH_SUB_STRING, OY_SYNTAX_SKIP_REG,
+                        OY_SYNTAX_SKIP_PATTERN,
+                        OY_SYNTAX_SKIP_REG | OY_SYNTAX_SKIP_PATTERN };
+  const oyOBJECT_e apis[] = { oyOBJECT_NONE, oyOBJECT_CMM_API4_S,
+                              oyOBJECT_CMM_API7_S };
+  int i, j, k, l, count = 0, diff = 0;
+  for(i = 0; i < (int)(sizeof(regs)/sizeof(regs[0])); ++i)
+  for(j = 0; j < (int)(sizeof(patterns)/sizeof(patterns[0])); ++j)
+  {
+    oyRegistration_s * reg_c = oyRegistrationCompileDefault_m( regs[i], 0 ),
+                     * pattern_c = oyRegistrationCompileDefault_m( patterns[j], 0 );
+    for(k = 0; k < (int)(sizeof(flags)/sizeof(flags[0])); ++k)
+    for(l = 0; l < (int)(sizeof(apis)/sizeof(apis[0])); ++l)
+    {
+      int a = oyFilterStringMatch( regs[i], patterns[j], apis[l], OY_SLASH_C,
+                                   '.', flags[k] ),
+          b = oyRegistrationMatch_( reg_c, pattern_c, apis[l], flags[k] );
+      if(a != b)
+      {
+        ++diff;
+        fprintf( zout, "\t%s %s flags: %d api: %d  %d != %d\n",
+                 oyNoEmptyString_m(regs[i]), oyNoEmptyString_m(patterns[j]),
+                 flags[k], apis[l], a, b );
+      }
+      ++count;
+    }
+    oyRegistrationRelease_( &reg_c, 0 );
+    oyRegistrationRelease_( &pattern_c, 0 );
+  }
+  if( !diff )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyRegistrationMatch_() == oyFilterStringMatch() %d", count );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyRegistrationMatch_() == oyFilterStringMatch() %d/%d", diff, count );
+  }
+
+  /* module and connector registrations are looked up by content */
+  char * reg_copy = oyStringCopy( regs[3], oyAllocateFunc_ );
+  const oyRegistration_s * cached = oyRegistrationCached_( regs[3] );
+  diff = 0;
+  if(cached != oyRegistrationCached_( reg_copy ) ||
+     cached == oyRegistrationCached_( regs[2] ))
+    ++diff;
+  for(j = 0; j < (int)(sizeof(patterns)/sizeof(patterns[0])); ++j)
+  {
+    oyRegistration_s * pattern_c = oyRegistrationCompileDefault_m( patterns[j], 0 );
+    if(oyRegistrationMatchCached_( reg_copy, pattern_c, oyOBJECT_NONE ) !=
+       oyFilterRegistrationMatch( regs[3], patterns[j], oyOBJECT_NONE ))
+      ++diff;
+    oyRegistrationRelease_( &pattern_c, 0 );
+  }
+  oyFree_m_( reg_copy );
+  if( cached && !diff )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyRegistrationCached_()               " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyRegistrationCached_() %d            ", diff );
+  }
+
+  oyOptions_s * opts = NULL;
+  oyOptions_SetFromString( &opts, OY_INTERNAL "/icc_color/rendering_intent",
+                           "1", OY_CREATE_NEW );
+  oyOptions_SetFromString( &opts, OY_INTERNAL "/icc_color/rendering_bpc",
+                           "1", OY_CREATE_NEW );
+  oyOption_s * o = oyOptions_Find( opts, "rendering_bpc", oyNAME_PATTERN );
+  oyOption_SetRegistration( o, OY_INTERNAL "/icc_color/rendering_gamut_warning" );
+  oyOption_Release( &o );
+  o = oyOptions_Find( opts, "rendering_bpc", oyNAME_PATTERN );
+  count = o ? 1 : 0;
+  oyOption_Release( &o );
+  o = oyOptions_Find( opts, "rendering_gamut_warning", oyNAME_PATTERN );
+  if( o && !count &&
+      oyOptions_CountType( opts, "icc_color", oyOBJECT_NONE ) == 2 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyOptions_Find() after oyOption_SetRegistration()" );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyOptions_Find() after oyOption_SetRegistration()" );
+  }
+  oyOption_Release( &o );
+  oyOptions_Release( &opts );
+
   return result;
 }
 
-#include "oyranos_object_internal.h"
 oyTESTRESULT_e test_oyTextIccDictMatch ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
@@ -4333,61 +4850,597 @@ oyTESTRESULT_e testCMMDevicesDetails ()
   return result;
 }
 
-oyTESTRESULT_e testCMMRankMap ()
+#define TEST_PPD_DIR "test2-ppd"
+static int testPrinterPPDWrite( const char * color_model )
+{
+  char * text = NULL;
+  int error;
+  oyStringAddPrintf( &text, 0,0,
+    "*PPD-Adobe: \"4.3\"\n"
+    "*FormatVersion: \"4.3\"\n"
+    "*FileVersion: \"1.0\"\n"
+    "*LanguageVersion: English\n"
+    "*LanguageEncoding: ISOLatin1\n"
+    "*PCFileName: \"OYTEST.PPD\"\n"
+    "*Manufacturer: \"Oyranos\"\n"
+    "*Product: \"(Test Printer)\"\n"
+    "*ModelName: \"Oyranos Test Printer\"\n"
+    "*ShortNickName: \"Oyranos Test Printer\"\n"
+    "*NickName: \"Oyranos Test Printer\"\n"
+    "*PSVersion: \"(3010.000) 0\"\n"
+    "*ColorDevice: True\n"
+    "*ColorKeyWords: \"ColorModel\"\n"
+    "*OpenUI *ColorModel/Color Mode: PickOne\n"
+    "*DefaultColorModel: %s\n"
+    "*ColorModel RGB/Color: \"<</cupsColorSpace 1>>setpagedevice\"\n"
+    "*ColorModel Gray/Grayscale: \"<</cupsColorSpace 0>>setpagedevice\"\n"
+    "*CloseUI: *ColorModel\n", color_model );
+  error = oyWriteMemToFile_( TEST_PPD_DIR OY_SLASH "oytest.ppd", text, strlen(text) );
+  oyFree_m_( text );
+  return error;
+}
+
+static const char * testPrinterPPDColorModel( oyConfigs_s ** devices,
+                                              double * seconds )
+{
+  oyOptions_s * options = NULL;
+  oyConfig_s * device;
+  const char * value;
+  double clck = oyClock();
+
+  oyConfigs_Release( devices );
+  oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/command",
+                           "properties", OY_CREATE_NEW );
+  oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/ppd_dir",
+                           TEST_PPD_DIR, OY_CREATE_NEW );
+  oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/device_name",
+                           "oytest", OY_CREATE_NEW );
+  oyDevicesGet( OY_TYPE_STD, "printer", options, devices );
+  *seconds = (oyClock() - clck)/(double)CLOCKS_PER_SEC;
+  oyOptions_Release( &options );
+
+  device = oyConfigs_Get( *devices, 0 );
+  value = oyConfig_FindString( device, "ColorModel", 0 );
+  oyConfig_Release( &device );
+  return value;
+}
+
+oyTESTRESULT_e testCMMPrinterPPD ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  oyConfigs_s * devices = NULL;
+  const char * value;
+  double first = 0, second = 0, parses = 0;
+  int old_flags;
 
   fprintf(stdout, "\n" );
 
-#ifdef USE_GETTEXT
-  setlocale(LC_ALL,"");
-#endif
-
-  int error = 0;
-  oyConfig_s * device;
-  oyOptions_s * options = 0;
-  oyConfigs_s * devices = 0;
+  if(testPrinterPPDWrite( "RGB" ))
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "write " TEST_PPD_DIR "/oytest.ppd           " );
+    return result;
+  }
 
-  oyOptions_SetFromString( &options,
-                   "//" OY_TYPE_STD "/config/icc_profile.x_color_region_target",
-                         "yes", OY_CREATE_NEW );
-  error = oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/command",
-                                   "properties", OY_CREATE_NEW );  
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
-  error = oyDevicesGet( OY_TYPE_STD, "monitor", options, &devices );
-  if(error && displayFail() == oyTESTRESULT_FAIL) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDevicesGet() error: %d", error )
-  oyOptions_Release( &options );
+  value = testPrinterPPDColorModel( &devices, &first );
+  if(value && strcmp( value, "RGB" ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "ppd_dir device ColorModel: %s          ", value );
+  } else
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "ppd_dir device ColorModel: %s (no CUPS module?)", oyNoEmptyString_m_(value) );
+    oyConfigs_Release( &devices );
+    return result;
+  }
 
-  int count = oyConfigs_Count( devices ),
-      i;
+  old_flags = oyStatsSet( oySTATS_ENABLE );
+  oyStatsReset();
+  value = testPrinterPPDColorModel( &devices, &second );
+  oyStatsGet( oySTATS_DEVICE_PARSE, &parses, NULL, NULL );
+  if(value && strcmp( value, "RGB" ) == 0 && parses == 0.0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "cached PPD %s    first: %.04f s",
+                 oyProfilingToString(1,second,"properties"), first );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "cached PPD ColorModel: %s parses: %g", oyNoEmptyString_m_(value), parses );
+  }
 
-  if( count )
+  /* the changed size invalidates the parsed PPD */
+  testPrinterPPDWrite( "Gray" );
+  oyStatsReset();
+  value = testPrinterPPDColorModel( &devices, &second );
+  oyStatsGet( oySTATS_DEVICE_PARSE, &parses, NULL, NULL );
+  oyStatsSet( old_flags );
+  if(value && strcmp( value, "Gray" ) == 0 && parses == 1.0)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "monitor(s) found               %d (%d)", (int)count, error );
-  } else if(displayFail() == oyTESTRESULT_FAIL)
-  { PRINT_SUB( displayFail(),
-    "no monitor found               %d (%d)", (int)count, error );
+    "changed PPD is parsed again: %s       ", value );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "changed PPD is parsed again: %s parses: %g", oyNoEmptyString_m_(value), parses );
   }
 
-  for(i = 0; i < count; ++i)
-  {
-    char * json_text = 0;
-    device = oyConfigs_Get( devices, i );
-    oyDeviceToJSON( device, 0, &json_text, malloc );
+  oyConfigs_Release( &devices );
 
-    if( json_text && json_text[0] )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "json from device [%d]         %d    ", i, (int)strlen(json_text) );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-    "json from device failed for [%d]      ", i );
-    }
+  return result;
+}
+#undef TEST_PPD_DIR
 
-    const oyRankMap * map = oyConfig_GetRankMap( device );
-    if( map )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "Map from device  [%d]                 ", i );
-    } else
+#include <unistd.h> /* usleep() */
+
+/* the SANE "test" backend needs no hardware */
+#define TEST_SANE_DIR "test2-sane"
+static int testScannerList( oyConfigs_s ** devices, const char * cache,
+                            double freshness, double * seconds )
+{
+  oyOptions_s * options = NULL;
+  double clck = oyClock();
+
+  oyConfigs_Release( devices );
+  oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/command",
+                           "list", OY_CREATE_NEW );
+  oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/backend",
+                           "test", OY_CREATE_NEW );
+  if(cache)
+    oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/cache",
+                             cache, OY_CREATE_NEW );
+  if(freshness)
+    oyOptions_SetFromDouble( &options, "//" OY_TYPE_STD "/config/freshness",
+                             freshness, 0, OY_CREATE_NEW );
+  oyDevicesGet( OY_TYPE_STD, "scanner", options, devices );
+  *seconds = (oyClock() - clck)/(double)CLOCKS_PER_SEC;
+  oyOptions_Release( &options );
+
+  return oyConfigs_Count( *devices );
+}
+
+static int testScannerProperties( const char * device_name, double * seconds )
+{
+  oyOptions_s * options = NULL;
+  oyConfigs_s * devices = NULL;
+  oyConfig_s * device;
+  double clck = oyClock();
+  int count;
+
+  oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/command",
+                           "properties", OY_CREATE_NEW );
+  oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/device_name",
+                           device_name, OY_CREATE_NEW );
+  oyDevicesGet( OY_TYPE_STD, "scanner", options, &devices );
+  *seconds = (oyClock() - clck)/(double)CLOCKS_PER_SEC;
+  oyOptions_Release( &options );
+
+  device = oyConfigs_Get( devices, 0 );
+  count = device ? oyOptions_Count( *oyConfig_GetOptions( device,"backend_core" ) ) : 0;
+  oyConfig_Release( &device );
+  oyConfigs_Release( &devices );
+  return count;
+}
+
+oyTESTRESULT_e testCMMScannerCache ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  oyConfigs_s * devices = NULL;
+  oyConfig_s * device;
+  char * name = NULL;
+  const char * conf = "test\n";
+  char test_conf[64];
+  double first = 0, second = 0;
+  int count, cached, i;
+
+  fprintf(stdout, "\n" );
+
+  /* enable only the "test" backend */
+  oyWriteMemToFile_( TEST_SANE_DIR OY_SLASH "dll.conf", conf, strlen(conf) );
+  sprintf( test_conf, "number_of_devices 2\n" );
+  oyWriteMemToFile_( TEST_SANE_DIR OY_SLASH "test.conf", test_conf, strlen(test_conf) );
+  setenv( "SANE_CONFIG_DIR", TEST_SANE_DIR, 1 );
+
+  count = testScannerList( &devices, "refresh", 0, &first );
+  if(count)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "\"test\" backend devices: %d          ", count );
+  } else
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "\"test\" backend devices: %d (no SANE module?)", count );
+    unsetenv( "SANE_CONFIG_DIR" );
+    return result;
+  }
+  device = oyConfigs_Get( devices, 0 );
+  name = oyStringCopy( oyConfig_FindString( device, "device_name", 0 ), oyAllocateFunc_ );
+  oyConfig_Release( &device );
+
+  cached = testScannerList( &devices, NULL, 0, &second );
+  if(cached == count)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "cached list %s    first: %.04f s",
+                 oyProfilingToString(1,second,"list"), first );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "cached list: %d                       ", cached );
+  }
+
+  /* a device_handle call leaves a SANE session open, which blocks
+   * background enumeration until the caller closes it */
+  {
+    oyOptions_s * options = NULL;
+    oyConfigs_Release( &devices );
+    oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/command",
+                             "list", OY_CREATE_NEW );
+    oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/device_handle",
+                             "", OY_CREATE_NEW );
+    oyDevicesGet( OY_TYPE_STD, "scanner", options, &devices );
+    /* closes the handles */
+    oyConfigs_Release( &devices );
+    oyOptions_Release( &options );
+    oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/command",
+                             "list", OY_CREATE_NEW );
+    oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/session",
+                             "close", OY_CREATE_NEW );
+    oyDevicesGet( OY_TYPE_STD, "scanner", options, &devices );
+    oyOptions_Release( &options );
+  }
+
+  /* a outdated list is served while a worker enumerates again */
+  sprintf( test_conf, "number_of_devices %d\n", count + 1 );
+  oyWriteMemToFile_( TEST_SANE_DIR OY_SLASH "test.conf", test_conf, strlen(test_conf) );
+  cached = testScannerList( &devices, NULL, 0.000001, &second );
+  if(cached == count)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "stale list %s",
+                 oyProfilingToString(1,second,"list") );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "stale list: %d                        ", cached );
+  }
+  /* the fresh list arrives from the worker */
+  for(i = 0; i < 100 && cached == count; ++i)
+  {
+    usleep( 50000 );
+    cached = testScannerList( &devices, NULL, 0, &second );
+  }
+  if(cached == count + 1)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "stale list refreshed in background   %d", cached );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "stale list refreshed in background   %d/%d", cached, count + 1 );
+  }
+  sprintf( test_conf, "number_of_devices %d\n", count );
+  oyWriteMemToFile_( TEST_SANE_DIR OY_SLASH "test.conf", test_conf, strlen(test_conf) );
+  testScannerList( &devices, "refresh", 0, &second );
+
+  count = testScannerProperties( name, &first );
+  cached = testScannerProperties( name, &second );
+  if(count && cached == count)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "cached properties %s    first: %.04f s",
+                 oyProfilingToString(1,second,"properties"), first );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "cached properties: %d/%d %s           ", cached, count, oyNoEmptyString_m_(name) );
+  }
+
+  oyConfigs_Release( &devices );
+  oyFree_m_( name );
+  unsetenv( "SANE_CONFIG_DIR" );
+
+  return result;
+}
+#undef TEST_SANE_DIR
+
+/* a minimal DNG: a RGB or JPEG thumbnail in IFD0 and the CFA data in a sub IFD */
+#include "raw_testdata.h"
+#define TEST_RAW_FILE "test2-raw" OY_SLASH "oytest.dng"
+typedef struct { uint8_t * mem; uint32_t ifd, extra; } testTiff_s;
+static void testTiffPut16( uint8_t * p, uint16_t v ) { p[0] = v & 0xff; p[1] = v >> 8; }
+static void testTiffPut32( uint8_t * p, uint32_t v ) { testTiffPut16( p, v & 0xffff ); testTiffPut16( p+2, v >> 16 ); }
+static void testTiffEntry( testTiff_s * t, uint16_t tag, uint16_t type,
+                           uint32_t count, const void * values )
+{
+  uint32_t size = type == 3 ? 2 : type == 4 ? 4 : type == 10 ? 8 : 1,
+           bytes = size * count, i;
+  uint8_t * e = t->mem + t->ifd, * v = e + 8;
+
+  testTiffPut16( e, tag ); testTiffPut16( e+2, type ); testTiffPut32( e+4, count );
+  /* values over four bytes go to the extra area */
+  if(bytes > 4)
+  {
+    testTiffPut32( e+8, t->extra );
+    v = t->mem + t->extra;
+    t->extra += (bytes + 1) & ~1;
+  }
+  for(i = 0; i < count; ++i)
+    if(size == 2) testTiffPut16( v + 2*i, ((const uint16_t*)values)[i] );
+    else if(size == 4) testTiffPut32( v + 4*i, ((const uint32_t*)values)[i] );
+    else if(size == 8)
+    { testTiffPut32( v + 8*i, ((const int32_t*)values)[2*i] );
+      testTiffPut32( v + 8*i + 4, ((const int32_t*)values)[2*i+1] ); }
+    else v[i] = ((const uint8_t*)values)[i];
+  t->ifd += 12;
+}
+static void testTiffLong( testTiff_s * t, uint16_t tag, uint32_t v ) { testTiffEntry( t, tag, 4, 1, &v ); }
+static void testTiffShort( testTiff_s * t, uint16_t tag, uint16_t v ) { testTiffEntry( t, tag, 3, 1, &v ); }
+static void testTiffIFD( testTiff_s * t, uint32_t pos, uint16_t n )
+{ t->ifd = pos; testTiffPut16( t->mem + pos, n ); t->ifd += 2; testTiffPut32( t->mem + pos + 2 + 12*n, 0 ); }
+
+/* jpeg selects the 64x32 raw_thumbnail_jpeg[] instead of a RGB thumbnail */
+static int testRawWrite( int width, int height, int thumb_width, int thumb_height,
+                         int jpeg )
+{
+  uint16_t ifd0_n = jpeg ? 20 : 18;
+  uint32_t sub_ifd = 8 + 2 + 12 * ifd0_n + 4,
+           thumb_off = 1024,
+           thumb_n = jpeg ? sizeof(raw_thumbnail_jpeg) :
+                            thumb_width * thumb_height * 3,
+           raw_off = thumb_off + thumb_n,
+           raw_n = width * height * 2,
+           size = raw_off + raw_n;
+  uint8_t * mem = (uint8_t*) calloc( 1, size );
+  testTiff_s t = { mem, 0, sub_ifd + 2 + 12 * 14 + 4 };
+  uint16_t bps[3] = {8,8,8}, cfa_dim[2] = {2,2};
+  uint8_t dng_version[4] = {1,4,0,0}, cfa[4] = {0,1,1,2};
+  int32_t matrix[18] = { 10000,10000, 0,10000, 0,10000,
+                         0,10000, 10000,10000, 0,10000,
+                         0,10000, 0,10000, 10000,10000 };
+  int x, y, error;
+
+  if(!mem) return 1;
+  mem[0] = mem[1] = 'I'; testTiffPut16( mem+2, 42 ); testTiffPut32( mem+4, 8 );
+
+  if(jpeg)
+  {
+    thumb_width = 64;
+    thumb_height = 32;
+  }
+
+  testTiffIFD( &t, 8, ifd0_n );
+  testTiffLong( &t, 254, 1 );          /* reduced resolution */
+  testTiffLong( &t, 256, thumb_width );
+  testTiffLong( &t, 257, thumb_height );
+  testTiffEntry( &t, 258, 3, 3, bps );
+  testTiffShort( &t, 259, jpeg ? 6 : 1 ); /* JPEG or uncompressed */
+  testTiffShort( &t, 262, jpeg ? 6 : 2 ); /* YCbCr or RGB */
+  testTiffEntry( &t, 271, 2, 8, "Oyranos" );
+  testTiffEntry( &t, 272, 2, 5, "Test" );
+  testTiffLong( &t, 273, thumb_off );
+  testTiffShort( &t, 277, 3 );
+  testTiffLong( &t, 278, thumb_height );
+  testTiffLong( &t, 279, thumb_n );
+  testTiffShort( &t, 284, 1 );
+  testTiffLong( &t, 330, sub_ifd );    /* SubIFDs */
+  if(jpeg)
+  {
+    testTiffLong( &t, 513, thumb_off );  /* JPEGInterchangeFormat */
+    testTiffLong( &t, 514, thumb_n );
+  }
+  testTiffEntry( &t, 50706, 1, 4, dng_version );
+  testTiffEntry( &t, 50708, 2, 13, "Oyranos Test" );
+  testTiffEntry( &t, 50721, 10, 9, matrix ); /* ColorMatrix1 */
+  testTiffShort( &t, 50778, 21 );      /* D65 */
+
+  testTiffIFD( &t, sub_ifd, 14 );
+  testTiffLong( &t, 254, 0 );
+  testTiffLong( &t, 256, width );
+  testTiffLong( &t, 257, height );
+  testTiffShort( &t, 258, 16 );
+  testTiffShort( &t, 259, 1 );
+  testTiffShort( &t, 262, 32803 );     /* CFA */
+  testTiffLong( &t, 273, raw_off );
+  testTiffShort( &t, 277, 1 );
+  testTiffLong( &t, 278, height );
+  testTiffLong( &t, 279, raw_n );
+  testTiffShort( &t, 284, 1 );
+  testTiffEntry( &t, 33421, 3, 2, cfa_dim );
+  testTiffEntry( &t, 33422, 1, 4, cfa );
+  testTiffLong( &t, 50717, 4095 );     /* WhiteLevel */
+
+  if(jpeg)
+    memcpy( mem + thumb_off, raw_thumbnail_jpeg, thumb_n );
+  else
+    for(y = 0; y < thumb_height; ++y)
+      for(x = 0; x < thumb_width * 3; ++x)
+        mem[thumb_off + y * thumb_width * 3 + x] = (uint8_t)(x * 255 / (thumb_width * 3));
+  for(y = 0; y < height; ++y)
+    for(x = 0; x < width; ++x)
+      testTiffPut16( mem + raw_off + 2 * (y * width + x), (uint16_t)((x + y) * 4000 / (width + height)) );
+
+  error = oyWriteMemToFile_( TEST_RAW_FILE, mem, size );
+  free( mem );
+  return error;
+}
+
+static oyImage_s * testRawRead( int preview, int preview_size, double * seconds )
+{
+  oyConversion_s * conversion = oyConversion_New( 0 );
+  oyFilterNode_s * in = oyFilterNode_NewWith( "//" OY_TYPE_STD "/file_read.meta", 0, 0 ),
+                 * out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", 0, 0 );
+  oyOptions_s * options = oyFilterNode_GetOptions( in, OY_SELECT_FILTER );
+  oyImage_s * image;
+  double clck = oyClock();
+
+  oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/file_read/filename",
+                           TEST_RAW_FILE, OY_CREATE_NEW );
+  oyOptions_SetFromInt( &options, "//" OY_TYPE_STD "/file_read/preview",
+                        preview, 0, OY_CREATE_NEW );
+  oyOptions_SetFromInt( &options, "//" OY_TYPE_STD "/file_read/preview_size",
+                        preview_size, 0, OY_CREATE_NEW );
+  oyOptions_Release( &options );
+
+  oyConversion_Set( conversion, in, 0 );
+  oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                        out, "//" OY_TYPE_STD "/data", 0 );
+  oyConversion_Set( conversion, 0, out );
+
+  image = oyConversion_GetImage( conversion, OY_OUTPUT );
+  oyImage_Release( &image );
+  image = oyConversion_GetImage( conversion, OY_INPUT );
+  *seconds = (oyClock() - clck)/(double)CLOCKS_PER_SEC;
+
+  oyConversion_Release( &conversion );
+  return image;
+}
+
+oyTESTRESULT_e testCMMRawPreview ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  oyImage_s * image;
+  oyOptions_s * tags;
+  double full = 0, seconds = 0;
+  int width, height, mode = 0;
+
+  fprintf(stdout, "\n" );
+
+  if(testRawWrite( 512, 256, 64, 32, 0 ))
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "write " TEST_RAW_FILE "          " );
+    return result;
+  }
+
+  image = testRawRead( 0, 0, &full );
+  width = oyImage_GetWidth( image );
+  if(width >= 500)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "full decode %dx%d    %.04f s", width, oyImage_GetHeight( image ), full );
+  } else
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "full decode %d (no lraw module?)     ", width );
+    oyImage_Release( &image );
+    return result;
+  }
+  oyImage_Release( &image );
+
+  image = testRawRead( 2, 0, &seconds );
+  width = oyImage_GetWidth( image );
+  tags = oyImage_GetTags( image );
+  oyOptions_FindInt( tags, "preview", 0, &mode );
+  if(width >= 250 && width <= 260 && mode == 2)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "half size %dx%d      %.1fx faster", width, oyImage_GetHeight( image ),
+                 seconds > 0 ? full/seconds : 0.0 );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "half size %d mode: %d             ", width, mode );
+  }
+  oyOptions_Release( &tags );
+  oyImage_Release( &image );
+
+  mode = 0;
+  image = testRawRead( 1, 0, &seconds );
+  width = oyImage_GetWidth( image );
+  height = oyImage_GetHeight( image );
+  tags = oyImage_GetTags( image );
+  oyOptions_FindInt( tags, "preview", 0, &mode );
+  if(width == 64 && height == 32 && mode == 1)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "embedded thumbnail %dx%d %.1fx faster", width, height,
+                 seconds > 0 ? full/seconds : 0.0 );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "embedded thumbnail %dx%d mode: %d    ", width, height, mode );
+  }
+  oyOptions_Release( &tags );
+  oyImage_Release( &image );
+
+  image = testRawRead( 0, 100, &seconds );
+  width = oyImage_GetWidth( image );
+  height = oyImage_GetHeight( image );
+  if(width && width <= 100 && height <= 100)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "preview_size 100 %dx%d   %.1fx faster", width, height,
+                 seconds > 0 ? full/seconds : 0.0 );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "preview_size 100 %dx%d             ", width, height );
+  }
+  oyImage_Release( &image );
+
+  /* cameras embed JPEG thumbnails mostly */
+  if(testRawWrite( 512, 256, 64, 32, 1 ))
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "write JPEG thumbnail " TEST_RAW_FILE );
+    return result;
+  }
+  mode = 0;
+  image = testRawRead( 1, 0, &seconds );
+  width = oyImage_GetWidth( image );
+  height = oyImage_GetHeight( image );
+  tags = oyImage_GetTags( image );
+  oyOptions_FindInt( tags, "preview", 0, &mode );
+#if defined(HAVE_JPEG)
+  if(width == 64 && height == 32 && mode == 1)
+#else
+  /* without libjpeg the half size decode is the fallback */
+  if(width >= 250 && width <= 260 && mode == 2)
+#endif
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "JPEG thumbnail %dx%d mode: %d %.1fx faster", width, height, mode,
+                 seconds > 0 ? full/seconds : 0.0 );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "JPEG thumbnail %dx%d mode: %d        ", width, height, mode );
+  }
+  oyOptions_Release( &tags );
+  oyImage_Release( &image );
+
+  return result;
+}
+#undef TEST_RAW_FILE
+
+oyTESTRESULT_e testCMMRankMap ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+#ifdef USE_GETTEXT
+  setlocale(LC_ALL,"");
+#endif
+
+  int error = 0;
+  oyConfig_s * device;
+  oyOptions_s * options = 0;
+  oyConfigs_s * devices = 0;
+
+  oyOptions_SetFromString( &options,
+                   "//" OY_TYPE_STD "/config/icc_profile.x_color_region_target",
+                         "yes", OY_CREATE_NEW );
+  error = oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/command",
+                                   "properties", OY_CREATE_NEW );  
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
+  error = oyDevicesGet( OY_TYPE_STD, "monitor", options, &devices );
+  if(error && displayFail() == oyTESTRESULT_FAIL) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDevicesGet() error: %d", error )
+  oyOptions_Release( &options );
+
+  int count = oyConfigs_Count( devices ),
+      i;
+
+  if( count )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "monitor(s) found               %d (%d)", (int)count, error );
+  } else if(displayFail() == oyTESTRESULT_FAIL)
+  { PRINT_SUB( displayFail(),
+    "no monitor found               %d (%d)", (int)count, error );
+  }
+
+  for(i = 0; i < count; ++i)
+  {
+    char * json_text = 0;
+    device = oyConfigs_Get( devices, i );
+    oyDeviceToJSON( device, 0, &json_text, malloc );
+
+    if( json_text && json_text[0] )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "json from device [%d]         %d    ", i, (int)strlen(json_text) );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+    "json from device failed for [%d]      ", i );
+    }
+
+    const oyRankMap * map = oyConfig_GetRankMap( device );
+    if( map )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "Map from device  [%d]                 ", i );
+    } else
     { PRINT_SUB( oyTESTRESULT_FAIL,
     "Map from device failed for [%d]       ", i );
     }
@@ -4903,6 +5956,129 @@ oyTESTRESULT_e testCMMMonitorModule ()
   return result;
 }
 
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+/* runs in an own thread and thus through an own X connection */
+static void * testMonitorCacheUnset_ ( void              * device )
+{
+  oyDeviceUnset( (oyConfig_s*) device );
+  return NULL;
+}
+#endif
+/* ask a fresh device object, as the profile would else stick in its options */
+static oyProfile_s * testMonitorCacheProfile_( const char * device_name )
+{
+  oyConfig_s * device = NULL;
+  oyOptions_s * options = NULL;
+  oyProfile_s * p = NULL;
+
+  oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/command",
+                           "properties", OY_CREATE_NEW );
+  oyDeviceGet( OY_TYPE_STD, "monitor", device_name, options, &device );
+  oyDeviceGetProfile( device, options, &p );
+  oyConfig_Release( &device );
+  oyOptions_Release( &options );
+
+  return p;
+}
+
+oyTESTRESULT_e testCMMMonitorCache ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  oyConfigs_s * devices = 0;
+  oyConfig_s * device = 0;
+  oyOptions_s * options = 0;
+  oyProfile_s * p = 0;
+  double opens = 0, hits = 0;
+  char * device_name = 0;
+  int error = 0, count, i, old_flags;
+
+  fprintf(stdout, "\n" );
+
+  if(displayFail() != oyTESTRESULT_FAIL)
+  { PRINT_SUB( oyTESTRESULT_XFAIL, "no DISPLAY" );
+    return result;
+  }
+
+  oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/command",
+                           "properties", OY_CREATE_NEW );
+
+  /* the first call opens the connection */
+  error = oyDevicesGet( OY_TYPE_STD, "monitor", options, &devices );
+  count = oyConfigs_Count( devices );
+  device = oyConfigs_Get( devices, 0 );
+  device_name = oyStringCopy( oyConfig_FindString( device, "device_name", 0 ),
+                              oyAllocateFunc_ );
+  oyConfigs_Release( &devices );
+
+  old_flags = oyStatsSet( oySTATS_ENABLE );
+  oyStatsReset();
+  for(i = 0; i < 3; ++i)
+  {
+    error = oyDevicesGet( OY_TYPE_STD, "monitor", options, &devices );
+    if(oyConfigs_Count( devices ) != count)
+      error = 1;
+    oyConfigs_Release( &devices );
+  }
+  oyStatsGet( oySTATS_DEVICE_OPEN, &opens, NULL, NULL );
+  oyStatsGet( oySTATS_CACHE_HIT, &hits, NULL, NULL );
+  oyStatsSet( old_flags );
+  oyOptions_Release( &options );
+
+  if(!error && count && opens == 0.0 && hits >= 3.0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "repeated properties reuse the display %d opens: %g hits: %g", count, opens, hits );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "repeated properties reuse the display %d opens: %g hits: %g", count, opens, hits );
+  }
+
+  /* a change from an other connection must reach the cached one */
+  p = testMonitorCacheProfile_( device_name );
+  if(!p)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "no monitor profile set for %s", oyNoEmptyString_m_(device_name) );
+  }
+#if defined(HAVE_PTHREAD)
+  else
+  {
+    pthread_t thread;
+    oyProfile_s * p2;
+
+    oyProfile_Release( &p );
+    error = pthread_create( &thread, NULL, testMonitorCacheUnset_, device );
+    if(!error)
+      pthread_join( thread, NULL );
+    p2 = testMonitorCacheProfile_( device_name );
+    if(!error && !p2)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "properties see the profile unset by an other connection" );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "properties see the profile unset by an other connection %d", error );
+    }
+    oyProfile_Release( &p2 );
+
+    /* restore the monitor profile */
+    oyDeviceSetup( device, NULL );
+    p2 = testMonitorCacheProfile_( device_name );
+    if(p2)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "properties see the profile set again" );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "properties see the profile set again" );
+    }
+    oyProfile_Release( &p2 );
+  }
+#endif
+  oyProfile_Release( &p );
+  oyConfig_Release( &device );
+  oyFree_m_( device_name );
+
+  return result;
+}
+
 oyTESTRESULT_e testCMMmonitorDBmatch ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
@@ -6319,10 +7495,256 @@ oyTESTRESULT_e testImagePixel()
   return result;
 }
 
-oyTESTRESULT_e testRectangles()
+/* former per pixel expose code of the oyra module as reference */
+static void testExposeClipRef( double * c, int n, int range_max, double expose )
 {
-  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
-  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+  int max = 0, max_pos = 0,
+      mid, mid_pos,
+      min = range_max, min_pos = 0,
+      i;
+
+  for(i = 0; i < n; ++i)
+  {
+    if(max < c[i]) { max = c[i]; max_pos = i; }
+    if(min > c[i]) { min = c[i]; min_pos = i; }
+  }
+
+  if( min * expose > range_max)
+    for(i = 0; i < n; ++i)
+      c[i] = range_max;
+  else if(max * expose <= range_max)
+    for(i = 0; i < n; ++i)
+      c[i] *= expose;
+  else if(n > 1)
+  {
+    double exposed_min = min * expose;
+    double mid_part;
+    double exposed_mid;
+
+    mid_pos = min_pos != 0 && max_pos != 0 ? 0 : min_pos != 1 && max_pos != 1 ? 1 : 2;
+    mid = c[mid_pos];
+
+    mid_part = (double)( mid - min )/(double)( max - min );
+
+    c[min_pos] = exposed_min + 0.5;
+    exposed_mid = exposed_min + mid_part * (range_max - exposed_min);
+    c[mid_pos] = exposed_mid + 0.5;
+    c[max_pos] = range_max;
+  }
+}
+
+static void testExposeRef            ( uint8_t           * buf,
+                                       int                 pixels,
+                                       int                 channels,
+                                       oyDATATYPE_e        data_type,
+                                       double              expose )
+{
+  int bps = oyDataTypeGetSize( data_type ), x, i;
+  int max = data_type == oyUINT8 ? 255 : data_type == oyUINT16 ? 65535 : 1;
+
+  for(x = 0; x < pixels; ++x)
+  {
+    uint8_t * p = &buf[x*channels*bps];
+    if(channels >= 3)
+    {
+      double rgb[3];
+      for(i = 0; i < 3; ++i)
+        switch(data_type)
+        {
+        case oyUINT8:  rgb[i] = p[i]; break;
+        case oyUINT16: rgb[i] = ((uint16_t*)p)[i]; break;
+        case oyFLOAT:  rgb[i] = ((float*)p)[i]; break;
+        case oyDOUBLE: rgb[i] = ((double*)p)[i]; break;
+        default: break;
+        }
+      testExposeClipRef( rgb, 3, max, expose );
+      for(i = 0; i < 3; ++i)
+        switch(data_type)
+        {
+        case oyUINT8:  p[i] = rgb[i]; break;
+        case oyUINT16: ((uint16_t*)p)[i] = rgb[i]; break;
+        case oyFLOAT:  ((float*)p)[i] = rgb[i]; break;
+        case oyDOUBLE: ((double*)p)[i] = rgb[i]; break;
+        default: break;
+        }
+    } else
+    for(i = 0; i < channels; ++i)
+    {
+      int v;
+      switch(data_type)
+      {
+      case oyUINT8:
+        v = p[i] * expose;
+        if(v > 255) v = 255;
+        p[i] = v;
+        break;
+      case oyUINT16:
+        v = ((uint16_t*)p)[i];
+        v *= expose;
+        if(v > 65535) v = 65535;
+        ((uint16_t*)p)[i] = v;
+        break;
+      case oyFLOAT:  ((float*)p)[i] *= expose; break;
+      case oyDOUBLE: ((double*)p)[i] *= expose; break;
+      default: break;
+      }
+    }
+  }
+}
+
+static oyConversion_s * testExposeConversion (
+                                       oyImage_s         * image,
+                                       double              expose )
+{
+  oyConversion_s * conv = oyConversion_New( testobj );
+  oyFilterNode_s * in = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", 0, testobj ),
+                 * ex = oyFilterNode_NewWith( "//" OY_TYPE_STD "/expose", 0, testobj ),
+                 * out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", 0, testobj );
+  oyOptions_s * opts = oyFilterNode_GetOptions( ex, OY_SELECT_FILTER );
+  int error;
+
+  oyConversion_Set( conv, in, 0 );
+  oyFilterNode_SetData( in, (oyStruct_s*)image, 0, 0 );
+  oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/expose/expose",
+                           expose, 0, OY_CREATE_NEW );
+  oyOptions_Release( &opts );
+  error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                                ex, "//" OY_TYPE_STD "/data", 0 );
+  if(error <= 0)
+    error = oyFilterNode_Connect( ex, "//" OY_TYPE_STD "/data",
+                                  out, "//" OY_TYPE_STD "/data", 0 );
+  oyConversion_Set( conv, 0, out );
+
+  oyFilterNode_Release( &in );
+  oyFilterNode_Release( &ex );
+  oyFilterNode_Release( &out );
+
+  if(error > 0)
+    oyConversion_Release( &conv );
+
+  return conv;
+}
+
+oyTESTRESULT_e testImageExpose()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_rgb = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj ),
+              * p_gray = oyProfile_FromStd( oyASSUMED_GRAY, icc_profile_flags, testobj );
+  oyDATATYPE_e data_types[4] = {oyUINT8, oyUINT16, oyFLOAT, oyDOUBLE};
+  double exposures[3] = {0.5, 1.7, 3.0};
+  int w = 31, h = 7, t, e, c, i, error = 0;
+
+  fprintf(stdout, "\n" );
+
+  /* compare all data types against the former implementation */
+  for(t = 0; t < 4; ++t)
+  for(c = 1; c <= 3; c += 2)
+  {
+    oyDATATYPE_e data_type = data_types[t];
+    int bps = oyDataTypeGetSize( data_type ),
+        samples = w * h * c,
+        size = samples * bps,
+        diffs = 0;
+    uint8_t * buf = (uint8_t*) malloc( size ),
+            * ref = (uint8_t*) malloc( size );
+
+    for(e = 0; e < 3; ++e)
+    {
+      oyImage_s * image;
+      oyConversion_s * conv;
+
+      srand( 1 );
+      for(i = 0; i < samples; ++i)
+        switch(data_type)
+        {
+        case oyUINT8:  buf[i] = rand() % 256; break;
+        case oyUINT16: ((uint16_t*)buf)[i] = rand() % 65536; break;
+        case oyFLOAT:  ((float*)buf)[i] = rand() / (float)RAND_MAX; break;
+        case oyDOUBLE: ((double*)buf)[i] = rand() / (double)RAND_MAX; break;
+        default: break;
+        }
+      memcpy( ref, buf, size );
+      testExposeRef( ref, w * h, c, data_type, exposures[e] );
+
+      image = oyImage_Create( w, h, buf,
+                              oyChannels_m(c) | oyDataType_m(data_type),
+                              c == 1 ? p_gray : p_rgb, testobj );
+      conv = testExposeConversion( image, exposures[e] );
+      if(conv)
+        error = oyConversion_RunPixels( conv, NULL );
+      else
+        error = 1;
+      oyConversion_Release( &conv );
+      oyImage_Release( &image );
+
+      if(error || memcmp( buf, ref, size ) != 0)
+        ++diffs;
+    }
+
+    if( !diffs )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "expose %s %d channel(s) bit exact                 ",
+      oyDataTypeToText(data_type), c );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "expose %s %d channel(s) bit exact  diffs: %d",
+      oyDataTypeToText(data_type), c, diffs );
+    }
+
+    free( buf );
+    free( ref );
+  }
+
+  /* 24 MP image */
+  for(t = 0; t < 2; ++t)
+  {
+    oyDATATYPE_e data_type = data_types[t];
+    int bw = 6000, bh = 4000;
+    size_t size = (size_t)bw * bh * 3 * oyDataTypeGetSize( data_type );
+    uint8_t * buf = (uint8_t*) calloc( size, 1 );
+    oyImage_s * image = oyImage_Create( bw, bh, buf,
+                                        oyChannels_m(3) | oyDataType_m(data_type),
+                                        p_rgb, testobj );
+    oyConversion_s * conv = testExposeConversion( image, 1.5 );
+    double clck;
+
+    for(i = 0; i < (int)size; ++i)
+      buf[i] = i % 251;
+
+    clck = oyClock();
+    if(conv)
+      error = oyConversion_RunPixels( conv, NULL );
+    else
+      error = 1;
+    clck = oyClock() - clck;
+
+    if( !error )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "expose 24 MP %s   %s", oyDataTypeToText(data_type),
+      oyProfilingToString(bw*bh,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "expose 24 MP %s                                    ",
+      oyDataTypeToText(data_type) );
+    }
+
+    oyConversion_Release( &conv );
+    oyImage_Release( &image );
+    free( buf );
+  }
+
+  oyProfile_Release( &p_rgb );
+  oyProfile_Release( &p_gray );
+
+  return result;
+}
+
+oyTESTRESULT_e testRectangles()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
                                        "//" OY_TYPE_STD "/icc_color", NULL, 0 );
   oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
   int error = 0;
@@ -6568,52 +7990,1189 @@ oyTESTRESULT_e testScreenPixel()
       oyImage_WritePPM( output, fn, num );
     }
 
-    y = 128;
-    for(x = 0; x < dst_width; ++x)
+    y = 128;
+    for(x = 0; x < dst_width; ++x)
+    {
+      if( buf_16out[y*dst_width*channels + x*channels + 3] &&
+          buf_16out[y*dst_width*channels + x*channels + 3] != x )
+      {
+        err = buf_16out[y*dst_width*channels + x*channels + 3];
+        break;
+      }
+    }
+    
+    if( err == 0 )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyDrawScreenImage   fills correct positions        " );
+    } else
+    { PRINT_SUB( oyTESTRESULT_XFAIL,
+      "oyDrawScreenImage   fills correct positions  %d/%d", x,err );
+    }
+
+
+    if(oy_debug)
+    fprintf( zout, "\nDONE [%d] ##################################### %s\n\n", i, oyRectangle_Show(display_rectangle) );
+  }
+  clck = oyClock() - clck;
+
+  if( !error &&
+      dirty <= 0
+    )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyDrawScreenImage                  %s",
+                 oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "draws"));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyDrawScreenImage                                  " );
+  }
+
+
+
+  oyConversion_Release ( &cc );
+  oyPixelAccess_Release( &pixel_access );
+  oyProfile_Release( &p_rgb );
+  oyProfile_Release( &p_web );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+  free(buf_16in);
+  free(buf_16out);
+
+  return result;
+}
+
+static int testDisplayTilesDraw( oyConversion_s * cc, oyPixelAccess_s * ticket,
+                                 oyRectangle_s * display_rectangle,
+                                 oyImage_s * output, int * converted )
+{
+  oyRectangle_s_ old_display_rectangle_ = {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0};
+  oyFilterNode_s * out = oyConversion_GetNode( cc, OY_OUTPUT );
+  oyOptions_s * opts = oyFilterNode_GetOptions( out, 0 );
+  int dirty = 1, i;
+  int32_t tiles = -1;
+
+  /* the first draws might ask for a update of the monitor profiles */
+  for(i = 0; i < 4 && dirty > 0; ++i)
+    dirty = oyDrawScreenImage( cc, ticket, display_rectangle,
+                               (oyRectangle_s*)&old_display_rectangle_,
+                               NULL, "oy-test", oyUINT16,
+                               NULL, NULL, 1, output );
+
+  oyOptions_FindInt( opts, "converted_tiles", 0, &tiles );
+  *converted = tiles;
+
+  oyOptions_Release( &opts );
+  oyFilterNode_Release( &out );
+  return dirty;
+}
+
+/* a complete draw through a new conversion for reference */
+static int testDisplayTilesFull( oyImage_s * input, oyRectangle_s * display_rectangle,
+                                 double start_x, uint16_t * buf_full,
+                                 oyPixel_t layout, oyProfile_s * p_web )
+{
+  int width = oyImage_GetWidth( input ),
+      height = oyImage_GetHeight( input ),
+      dirty, full_tiles = -1;
+  oyImage_s * full = oyImage_Create( width, height, buf_full, layout, p_web, testobj );
+  oyConversion_s * cc_full = oyConversion_FromImageForDisplay( input, full, NULL,
+                                       oyOPTIONATTRIBUTE_ADVANCED,
+                                       oyUINT16, NULL, testobj );
+  oyFilterNode_s * out = oyConversion_GetNode( cc_full, OY_OUTPUT );
+  oyFilterPlug_s * plug = oyFilterNode_GetPlug( out, 0 );
+  oyPixelAccess_s * ticket_full = oyPixelAccess_Create( 0,0, plug,
+                                                 oyPIXEL_ACCESS_IMAGE, testobj );
+
+  oyPixelAccess_ChangeRectangle( ticket_full, start_x, 0, NULL );
+  dirty = testDisplayTilesDraw( cc_full, ticket_full, display_rectangle, full, &full_tiles );
+
+  oyPixelAccess_Release( &ticket_full );
+  oyFilterPlug_Release( &plug );
+  oyFilterNode_Release( &out );
+  oyConversion_Release( &cc_full );
+  oyImage_Release( &full );
+
+  return dirty;
+}
+
+static void testDisplayTilesPaint( uint16_t * buf, int width, int channels,
+                                   int x0, int y0, int x1, int y1, uint16_t v )
+{
+  int x, y;
+  for(y = y0; y < y1; ++y)
+    for(x = x0; x < x1; ++x)
+    {
+      buf[y*width*channels + x*channels + 0] = v;
+      buf[y*width*channels + x*channels + 2] = 65535 - v;
+    }
+}
+
+oyTESTRESULT_e testDisplayTiles()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  const int width = 2 * 1024,
+            height = 256,
+            channels = 4;
+  size_t size = sizeof(uint16_t) * width * height * channels;
+  uint16_t * buf_in  = (uint16_t*) calloc( 1, size ),
+           * buf_out = (uint16_t*) calloc( 1, size ),
+           * buf_ref = (uint16_t*) calloc( 1, size ),
+           * buf_full = (uint16_t*) calloc( 1, size );
+  oyPixel_t layout = oyChannels_m(channels) | oyDataType_m(oyUINT16);
+  int x,y, dirty, tiles = -1, count;
+
+  fprintf(stdout, "\n" );
+
+  for(y = 0; y < height; ++y)
+    for(x = 0; x < width; ++x)
+    {
+      buf_in[y*width*channels + x*channels + 0] = (y / (double)(height-1)) * 65535;
+      buf_in[y*width*channels + x*channels + 1] = (x / (double)(width-1)) * 65535;
+      buf_in[y*width*channels + x*channels + 2] = 30000;
+      buf_in[y*width*channels + x*channels + 3] = x;
+    }
+
+  oyImage_s * input = oyImage_Create( width, height, buf_in, layout, p_web, testobj ),
+            * output = oyImage_Create( width, height, buf_out, layout, p_web, testobj );
+  oyConversion_s * cc = oyConversion_FromImageForDisplay( input, output, NULL,
+                                         oyOPTIONATTRIBUTE_ADVANCED,
+                                         oyUINT16, NULL, testobj );
+  oyFilterNode_s * out = oyConversion_GetNode( cc, OY_OUTPUT );
+  oyFilterPlug_s * plug = oyFilterNode_GetPlug( out, 0 );
+  oyPixelAccess_s * ticket = oyPixelAccess_Create( 0,0, plug,
+                                                   oyPIXEL_ACCESS_IMAGE, testobj );
+  oyOptions_s * node_opts = oyFilterNode_GetOptions( out, 0 );
+  oyRectangle_s_ display_rectangle_ = {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,(double)width,(double)height};
+  oyRectangle_s * display_rectangle = (oyRectangle_s*) &display_rectangle_;
+  oyFilterPlug_Release( &plug );
+  oyFilterNode_Release( &out );
+
+  /* the cache is opt-in */
+  oyOptions_SetFromInt( &node_opts, "//" OY_TYPE_STD "/display/cache_tiles", 1, 0,
+                        OY_CREATE_NEW );
+
+  /* two of the three "oy-test" monitors cover the image: 2 x 16 x 4 tiles */
+  dirty = testDisplayTilesDraw( cc, ticket, display_rectangle, output, &tiles );
+  if(dirty <= 0 && tiles == 128)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "first draw converts all tiles        %d", tiles );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "first draw converts all tiles        %d dirty: %d", tiles, dirty );
+  }
+  memcpy( buf_ref, buf_out, size );
+
+  dirty = testDisplayTilesDraw( cc, ticket, display_rectangle, output, &tiles );
+  if(dirty <= 0 && tiles == 0 && memcmp( buf_ref, buf_out, size ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "unchanged redraw uses cached tiles   %d", tiles );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "unchanged redraw uses cached tiles   %d dirty: %d", tiles, dirty );
+  }
+
+  /* changed source pixels with a new input revision */
+  testDisplayTilesPaint( buf_in, width, channels, 1000, 100, 1200, 200, 65535 );
+  {
+    oyOptions_s * tags = oyImage_GetTags( input );
+    oyOptions_SetFromInt( &tags, "//" OY_TYPE_STD "/display/image_revision", 1, 0,
+                          OY_CREATE_NEW );
+    oyOptions_Release( &tags );
+  }
+  dirty = testDisplayTilesDraw( cc, ticket, display_rectangle, output, &tiles );
+  testDisplayTilesFull( input, display_rectangle, 0, buf_full, layout, p_web );
+  if(dirty <= 0 && tiles == 128 && memcmp( buf_full, buf_out, size ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "input image_revision converts all    %d", tiles );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "input image_revision converts all    %d dirty: %d", tiles, dirty );
+  }
+  memcpy( buf_ref, buf_out, size );
+
+  /* change a area inside tile columns 1-3 and rows 0-1 */
+  testDisplayTilesPaint( buf_in, width, channels, 100, 10, 200, 70, 65535 );
+  {
+    oyOptions_s * tags = oyImage_GetTags( output );
+    oyRectangle_s * r = oyRectangle_NewWith( 100, 10, 100, 60, 0 );
+    oyOptions_MoveInStruct( &tags, "//" OY_TYPE_STD "/display/dirty_rectangle",
+                            (oyStruct_s**)&r, OY_CREATE_NEW );
+    dirty = testDisplayTilesDraw( cc, ticket, display_rectangle, output, &tiles );
+    count = oyOptions_CountType( tags, "//" OY_TYPE_STD "/display/dirty_rectangle",
+                                 oyOBJECT_RECTANGLE_S );
+    oyOptions_Release( &tags );
+  }
+  if(dirty <= 0 && tiles == 6 && count == 0 &&
+     memcmp( buf_ref, buf_out, size ) != 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "dirty_rectangle converts touched tiles %d", tiles );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "dirty_rectangle converts touched tiles %d dirty: %d tags: %d", tiles, dirty, count );
+  }
+
+  /* compare with a complete conversion */
+  dirty = testDisplayTilesFull( input, display_rectangle, 0, buf_full, layout, p_web );
+  if(dirty <= 0 && memcmp( buf_full, buf_out, size ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "incremental draw == complete draw             " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "incremental draw == complete draw     dirty: %d", dirty );
+  }
+
+  /* a new output revision outdates all tiles */
+  {
+    oyOptions_s * tags = oyImage_GetTags( output );
+    oyOptions_SetFromInt( &tags, "//" OY_TYPE_STD "/display/image_revision", 1, 0,
+                          OY_CREATE_NEW );
+    oyOptions_Release( &tags );
+  }
+  dirty = testDisplayTilesDraw( cc, ticket, display_rectangle, output, &tiles );
+  if(dirty <= 0 && tiles == 128 && memcmp( buf_full, buf_out, size ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "image_revision converts all tiles    %d", tiles );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "image_revision converts all tiles    %d dirty: %d", tiles, dirty );
+  }
+
+  /* scroll a narrower view by one tile column; the cached tiles move along
+   * and only the exposed strip and the column crossing the monitor border
+   * are converted */
+  display_rectangle_.width = width - 64;
+  testDisplayTilesDraw( cc, ticket, display_rectangle, output, &tiles );
+  oyPixelAccess_ChangeRectangle( ticket, 64.0 / width, 0, NULL );
+  dirty = testDisplayTilesDraw( cc, ticket, display_rectangle, output, &tiles );
+  testDisplayTilesFull( input, display_rectangle, 64.0 / width, buf_full, layout, p_web );
+  count = 0;
+  for(y = 0; y < height; ++y)
+    if(memcmp( &buf_full[y*width*channels], &buf_out[y*width*channels],
+               (width - 64) * channels * sizeof(uint16_t) ) != 0)
+      ++count;
+  if(dirty <= 0 && 0 < tiles && tiles < 124 && count == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "scroll converts the exposed tiles    %d", tiles );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "scroll converts the exposed tiles    %d dirty: %d rows: %d", tiles, dirty, count );
+  }
+  display_rectangle_.width = width;
+  oyPixelAccess_ChangeRectangle( ticket, 0, 0, NULL );
+
+  /* without the option each draw sees changed pixels */
+  oyOptions_SetFromInt( &node_opts, "//" OY_TYPE_STD "/display/cache_tiles", 0, 0,
+                        OY_CREATE_NEW );
+  testDisplayTilesPaint( buf_in, width, channels, 1500, 0, 1600, 256, 0 );
+  dirty = testDisplayTilesDraw( cc, ticket, display_rectangle, output, &tiles );
+  testDisplayTilesFull( input, display_rectangle, 0, buf_full, layout, p_web );
+  count = oyOptions_CountType( node_opts, "//" OY_TYPE_STD "/display/tile_cache",
+                               oyOBJECT_BLOB_S );
+  if(dirty <= 0 && tiles == -1 && count == 0 &&
+     memcmp( buf_full, buf_out, size ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "cache_tiles=0 converts changed input " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "cache_tiles=0 converts changed input %d dirty: %d caches: %d", tiles, dirty, count );
+  }
+
+  oyOptions_Release( &node_opts );
+  oyPixelAccess_Release( &ticket );
+  oyConversion_Release( &cc );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+  oyProfile_Release( &p_web );
+  free( buf_in );
+  free( buf_out );
+  free( buf_ref );
+  free( buf_full );
+
+  return result;
+}
+
+oyTESTRESULT_e testConversionTickets()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj ),
+              * p_lab = oyProfile_FromStd( oyASSUMED_LAB, icc_profile_flags, testobj );
+  const int width = 256,
+            height = 128,
+            channels = 3;
+  size_t size = sizeof(uint16_t) * width * height * channels;
+  uint16_t * buf_in  = (uint16_t*) calloc( 1, size ),
+           * buf_out = (uint16_t*) calloc( 1, size ),
+           * buf_ref = (uint16_t*) calloc( 1, size );
+  oyPixel_t layout = oyChannels_m(channels) | oyDataType_m(oyUINT16);
+  int i, error = 0, n = 10000;
+  double clck;
+
+  fprintf(stdout, "\n" );
+
+  for(i = 0; i < width * height * channels; ++i)
+    buf_in[i] = (i * 97) % 65535;
+
+  oyImage_s * input = oyImage_Create( width, height, buf_in, layout, p_web, testobj ),
+            * output = oyImage_Create( width, height, buf_out, layout, p_lab, testobj ),
+            * ref = oyImage_Create( width, height, buf_ref, layout, p_lab, testobj );
+  oyConversion_s * cc = oyConversion_CreateBasicPixels( input, output, NULL, testobj ),
+                 * cc_ref = oyConversion_CreateBasicPixels( input, ref, NULL, testobj );
+  oyRectangle_s * tile = oyRectangle_NewFrom( NULL, testobj );
+  oyPixelAccess_s * ticket = oyConversion_GetTicket( cc, 0,0, oyPIXEL_ACCESS_IMAGE ),
+                  * first = ticket;
+
+  oyConversion_RecycleTicket( cc, &ticket );
+  ticket = oyConversion_GetTicket( cc, 0,0, oyPIXEL_ACCESS_IMAGE );
+  if(ticket && ticket == first)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyConversion_RecycleTicket() reuses ticket" );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyConversion_RecycleTicket() reuses ticket" );
+  }
+  oyConversion_RecycleTicket( cc, &ticket );
+
+  /* 64x64 tiles; ROI's are relative to the image width */
+  for(i = 0; i < 8 && error <= 0; ++i)
+  {
+    double x = (i % 4) * 0.25,
+           y = (i / 4) * 0.25;
+    ticket = oyConversion_GetTicket( cc, 0,0, oyPIXEL_ACCESS_IMAGE );
+    oyRectangle_SetGeo( tile, x,y, 0.25,0.25 );
+    oyPixelAccess_ChangeRectangle( ticket, x,y, tile );
+    error = oyConversion_RunPixels( cc, ticket );
+    oyConversion_RecycleTicket( cc, &ticket );
+  }
+  if(error <= 0)
+    error = oyConversion_RunPixels( cc_ref, NULL );
+  if(error <= 0 && memcmp( buf_out, buf_ref, size ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "pooled tiles == complete conversion" );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "pooled tiles == complete conversion  error: %d", error );
+  }
+
+  /* a referenced ticket is not recycled */
+  ticket = oyConversion_GetTicket( cc, 0,0, oyPIXEL_ACCESS_IMAGE );
+  first = oyPixelAccess_Copy( ticket, NULL );
+  oyConversion_RecycleTicket( cc, &ticket );
+  ticket = oyConversion_GetTicket( cc, 0,0, oyPIXEL_ACCESS_IMAGE );
+  if(ticket && ticket != first)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "referenced ticket stays with its owner" );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "referenced ticket stays with its owner" );
+  }
+  oyConversion_RecycleTicket( cc, &ticket );
+  oyPixelAccess_Release( &first );
+
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+  {
+    ticket = oyConversion_GetTicket( cc, 0,0, oyPIXEL_ACCESS_IMAGE );
+    oyConversion_RecycleTicket( cc, &ticket );
+  }
+  clck = oyClock() - clck;
+  PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyConversion_GetTicket()            %s",
+    oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "tickets") );
+
+  oyFilterNode_s * out = oyConversion_GetNode( cc, OY_OUTPUT );
+  oyFilterPlug_s * plug = oyFilterNode_GetPlug( out, 0 );
+  clck = oyClock();
+  for(i = 0; i < n/10; ++i)
+  {
+    ticket = oyPixelAccess_Create( 0,0, plug, oyPIXEL_ACCESS_IMAGE, testobj );
+    oyPixelAccess_Release( &ticket );
+  }
+  clck = oyClock() - clck;
+  PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyPixelAccess_Create()              %s",
+    oyProfilingToString(n/10,clck/(double)CLOCKS_PER_SEC, "tickets") );
+  oyFilterPlug_Release( &plug );
+  oyFilterNode_Release( &out );
+
+  oyRectangle_Release( &tile );
+  oyConversion_Release( &cc );
+  oyConversion_Release( &cc_ref );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+  oyImage_Release( &ref );
+  oyProfile_Release( &p_web );
+  oyProfile_Release( &p_lab );
+  free( buf_in );
+  free( buf_out );
+  free( buf_ref );
+
+  return result;
+}
+
+oyTESTRESULT_e testGraphContexts()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj ),
+              * p_lab = oyProfile_FromStd( oyASSUMED_LAB, icc_profile_flags, testobj ),
+              * p_xyz = oyProfile_FromStd( oyASSUMED_XYZ, icc_profile_flags, testobj );
+  /* the 1. and 3. ICC node do the same */
+  oyProfile_s * profiles[5] = { p_web, p_lab, p_web, p_lab, p_xyz };
+  const int w = 8, n = 5;
+  uint16_t buf[5][8*8*3];
+  oyFilterNode_s * nodes[5] = {0,0,0,0,0}, * out = 0;
+  oyConversion_s * cc = oyConversion_New( testobj );
+  oyFilterGraph_s * graph = 0;
+  int i, error = 0, ready = oyThreadLockingReady();
+  double clck, serial, concurrent;
+
+  fprintf(stdout, "\n" );
+
+  memset( buf, 0, sizeof(buf) );
+  /* root -> 4 x icc -> output */
+  for(i = 0; i < n && error <= 0; ++i)
+  {
+    oyImage_s * image = oyImage_Create( w, w, buf[i], OY_TYPE_123_16,
+                                        profiles[i], testobj );
+    if(i == 0)
+      nodes[i] = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", NULL, testobj );
+    else
+      nodes[i] = oyFilterNode_FromOptions( OY_CMM_STD, "//" OY_TYPE_STD "/icc_color",
+                                           NULL, testobj );
+    error = oyFilterNode_SetData( nodes[i], (oyStruct_s*)image, 0, 0 );
+    if(i && error <= 0)
+      error = oyFilterNode_Connect( nodes[i-1], "//" OY_TYPE_STD "/data",
+                                    nodes[i], "//" OY_TYPE_STD "/data", 0 );
+    oyImage_Release( &image );
+  }
+  out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", NULL, testobj );
+  if(error <= 0)
+    error = oyFilterNode_Connect( nodes[n-1], "//" OY_TYPE_STD "/data",
+                                  out, "//" OY_TYPE_STD "/data", 0 );
+  if(error <= 0)
+    error = oyConversion_Set( cc, nodes[0], out );
+  graph = oyConversion_GetGraph( cc );
+
+  /* cold caches for a fair compare */
+  oyStructList_Clear( *oyCMMCacheList_() );
+  clck = oyClock();
+  if(error <= 0)
+    error = oyFilterGraph_PrepareContexts( graph, 1 | oyFILTERGRAPH_PREPARE_SERIAL );
+  serial = (oyClock() - clck)/(double)CLOCKS_PER_SEC;
+
+  oyStructList_Clear( *oyCMMCacheList_() );
+  clck = oyClock();
+  if(error <= 0)
+    error = oyFilterGraph_PrepareContexts( graph, 1 );
+  concurrent = (oyClock() - clck)/(double)CLOCKS_PER_SEC;
+
+  int contexts = 0;
+  for(i = 1; i < n; ++i)
+  {
+    oyPointer_s * ptr = oyFilterNode_GetBackendContext( nodes[i] );
+    if(ptr && oyPointer_GetPointer( ptr ))
+      ++contexts;
+    oyPointer_Release( &ptr );
+  }
+  oyPointer_s * ptr1 = oyFilterNode_GetBackendContext( nodes[1] ),
+              * ptr3 = oyFilterNode_GetBackendContext( nodes[3] );
+  if(error <= 0 && contexts == n - 1 && ptr1 && ptr3 &&
+     oyPointer_GetPointer( ptr1 ) == oyPointer_GetPointer( ptr3 ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyFilterGraph_PrepareContexts() %d contexts, 1 shared", contexts );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyFilterGraph_PrepareContexts() %d contexts error: %d", contexts, error );
+  }
+  oyPointer_Release( &ptr1 );
+  oyPointer_Release( &ptr3 );
+
+  PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "serial contexts                    %s", oyProfilingToString(1,serial,"graph") );
+  PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "%s contexts                %s", ready ? "concurrent" : "no locking",
+    oyProfilingToString(1,concurrent,"graph") );
+  if(concurrent > 0.0)
+    fprintf( zout, "\tsetup latency serial/concurrent: %.2f\n", serial/concurrent );
+
+  oyFilterGraph_Release( &graph );
+  oyConversion_Release( &cc );
+  oyProfile_Release( &p_web );
+  oyProfile_Release( &p_lab );
+  oyProfile_Release( &p_xyz );
+
+  return result;
+}
+
+static double testGamutVolume_( oyProfile_s * p1, oyProfile_s * p2,
+                                 double * shared, int * error )
+{
+  oyOptions_s * opts = oyOptions_New( testobj ),
+              * result = NULL;
+  oyProfile_s * p = oyProfile_Copy( p1, NULL );
+  oyOption_s * o;
+  double volume = 0.0;
+
+  oyOptions_MoveInStruct( &opts, "//" OY_TYPE_STD "/icc_profile.input",
+                          (oyStruct_s**) &p, OY_CREATE_NEW );
+  if(p2)
+  {
+    p = oyProfile_Copy( p2, NULL );
+    oyOptions_MoveInStruct( &opts, "//" OY_TYPE_STD "/icc_profile.input2",
+                            (oyStruct_s**) &p, OY_CREATE_NEW );
+  }
+  *error = oyOptions_Handle( "//" OY_TYPE_STD "/graph3d.gamut", opts,
+                             p2 ? "gamut_intersection" : "gamut_hull",
+                             &result );
+  o = oyOptions_Find( result, p2 ? "gamut_intersection.output.volume.double" :
+                                   "gamut_hull.output.volume.double",
+                      oyNAME_PATTERN );
+  if(o)
+  {
+    volume = oyOption_GetValueDouble( o, p2 ? 1 : 0 );
+    if(shared)
+      *shared = oyOption_GetValueDouble( o, 0 );
+  }
+
+  oyOption_Release( &o );
+  oyOptions_Release( &result );
+  oyOptions_Release( &opts );
+  return volume;
+}
+
+oyTESTRESULT_e testGamutHull()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj ),
+              * p_adobe = oyProfile_FromFile( "compatibleWithAdobeRGB1998.icc", icc_profile_flags, testobj );
+  double v_web, v_adobe, v_self = 0, shared = 0;
+  int error = 0;
+
+  fprintf(stdout, "\n" );
+
+  /* about 830 000 and 1 200 000 ΔE³ for the D50 PCS */
+  v_web = testGamutVolume_( p_web, NULL, NULL, &error );
+  if(error == -1)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "oyOptions_Handle( \"gamut_hull\" ) no module" );
+  } else if(780000 < v_web && v_web < 880000)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "sRGB gamut volume:              %.0f", v_web );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "sRGB gamut volume:              %.0f error: %d", v_web, error );
+  }
+
+  v_adobe = testGamutVolume_( p_adobe, NULL, NULL, &error );
+  if(!p_adobe)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "compatibleWithAdobeRGB1998.icc not found             " );
+  } else if(error == -1)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "oyOptions_Handle( \"gamut_hull\" ) no module" );
+  } else if(1100000 < v_adobe && v_adobe < 1300000)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "AdobeRGB gamut volume:          %.0f", v_adobe );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "AdobeRGB gamut volume:          %.0f error: %d", v_adobe, error );
+  }
+
+  /* the column sampling should match the hull volume */
+  v_self = testGamutVolume_( p_web, p_web, &shared, &error );
+  if(v_self > 0 && fabs(shared - v_self) / v_self < 0.03)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "sRGB / sRGB intersection:       %.0f", shared );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "sRGB / sRGB intersection:       %.0f != %.0f", shared, v_self );
+  }
+
+  if(v_adobe > 0)
+  {
+    testGamutVolume_( p_web, p_adobe, &shared, &error );
+    if(0.9 * v_web < shared && shared < 1.03 * v_web)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "sRGB / AdobeRGB intersection:   %.0f", shared );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "sRGB / AdobeRGB intersection:   %.0f error: %d", shared, error );
+    }
+  }
+
+  oyProfile_Release( &p_web );
+  oyProfile_Release( &p_adobe );
+
+  return result;
+}
+
+/* create the proofing effect uncached; returns the A2B0 CLUT tag memory */
+static char * testProofEffectClut_   ( oyProfile_s       * proof,
+                                       int                 grid_size,
+                                       int                 batch,
+                                       size_t            * size,
+                                       double            * seconds )
+{
+  oyOptions_s * opts = NULL, * result_opts = NULL;
+  oyProfile_s * abstract;
+  oyProfileTag_s * tag = NULL;
+  oyPointer block = NULL;
+  double t;
+
+  oyStructList_Clear( *oyCMMCacheList_() );
+  oyOptions_MoveInStruct( &opts, "//" OY_TYPE_STD "/icc_profile.proofing_profile",
+                          (oyStruct_s**) &proof, OY_CREATE_NEW );
+  oyOptions_SetFromString( &opts, "//" OY_TYPE_STD "/rendering_gamut_warning", "1", OY_CREATE_NEW );
+  oyOptions_SetFromInt( &opts, "//" OY_TYPE_STD "/proofing_grid", grid_size, 0, OY_CREATE_NEW );
+  oyOptions_SetFromInt( &opts, "//" OY_TYPE_STD "/proofing_batch", batch, 0, OY_CREATE_NEW );
+  t = oySeconds();
+  oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.proofing_effect",
+                    opts,"create_profile.proofing_effect",
+                    &result_opts );
+  *seconds = oySeconds() - t;
+  abstract = (oyProfile_s*)oyOptions_GetType( result_opts, -1, "icc_profile",
+                                              oyOBJECT_PROFILE_S );
+  /* only the CLUT; the header carries the creation time */
+  if(abstract)
+    tag = oyProfile_GetTagById( abstract, icSigAToB0Tag );
+  if(tag)
+    oyProfileTag_GetBlock( tag, &block, size, oyAllocateFunc_ );
+  /* the next call shall not find the user cache file */
+  if(oyOptions_FindString( result_opts, "file_name", 0 ))
+    oyRemoveFile_( oyOptions_FindString( result_opts, "file_name", 0 ) );
+  oyProfileTag_Release( &tag );
+  oyProfile_Release( &abstract );
+  oyOptions_Release( &result_opts );
+  oyOptions_Release( &opts );
+
+  return (char*) block;
+}
+
+oyTESTRESULT_e testProofGrid()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  int grids[3] = {33, 53, 65}, i;
+
+  fprintf(stdout, "\n" );
+
+  for(i = 0; i < 3; ++i)
+  {
+    int grid = grids[i];
+    size_t size1 = 0, size2 = 0;
+    char * clut1, * clut2;
+    double point = 0, batch = 0;
+
+    clut1 = testProofEffectClut_( oyProfile_FromStd( oyPROFILE_PROOF, 0, testobj ),
+                                  grid, 0, &size1, &point );
+    clut2 = testProofEffectClut_( oyProfile_FromStd( oyPROFILE_PROOF, 0, testobj ),
+                                  grid, 1, &size2, &batch );
+
+    if(!clut1 || !clut2)
+    { PRINT_SUB( oyTESTRESULT_XFAIL,
+      "create_profile.proofing_effect no lcm2                " );
+    } else if(size1 == size2 && memcmp( clut1, clut2, size1 ) == 0)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "proofing grid %d^3 point / batch CLUT identical %lu bytes", grid, (unsigned long)size1 );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "proofing grid %d^3 point / batch CLUT differ %lu %lu", grid,
+      (unsigned long)size1, (unsigned long)size2 );
+    }
+
+    if(clut1 && clut2)
+      PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "proofing grid %d^3 point %.03fs, batch %.03fs", grid, point, batch );
+
+    if(clut1) oyDeAllocateFunc_( clut1 );
+    if(clut2) oyDeAllocateFunc_( clut2 );
+    if(!clut1 || !clut2)
+      break;
+  }
+
+  return result;
+}
+
+#include <sys/stat.h>
+#if defined(__linux__)
+#include <sys/wait.h>
+#endif
+
+/* proofing effect through the caches; returns the profile memory */
+static char * testProofEffectCached_ ( oyProfile_s       * proof,
+                                       size_t            * size,
+                                       double            * seconds,
+                                       char             ** file_name )
+{
+  oyOptions_s * opts = NULL, * result_opts = NULL;
+  oyProfile_s * abstract;
+  char * block = NULL;
+  double t;
+
+  oyOptions_MoveInStruct( &opts, "//" OY_TYPE_STD "/icc_profile.proofing_profile",
+                          (oyStruct_s**) &proof, OY_CREATE_NEW );
+  oyOptions_SetFromString( &opts, "//" OY_TYPE_STD "/rendering_gamut_warning", "1", OY_CREATE_NEW );
+  t = oySeconds();
+  oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.proofing_effect",
+                    opts,"create_profile.proofing_effect",
+                    &result_opts );
+  *seconds = oySeconds() - t;
+  abstract = (oyProfile_s*)oyOptions_GetType( result_opts, -1, "icc_profile",
+                                              oyOBJECT_PROFILE_S );
+  if(abstract)
+    block = (char*) oyProfile_GetMem( abstract, size, 0, oyAllocateFunc_ );
+  if(file_name)
+    *file_name = oyStringCopy( oyOptions_FindString( result_opts, "file_name", 0 ),
+                               oyAllocateFunc_ );
+  oyProfile_Release( &abstract );
+  oyOptions_Release( &result_opts );
+  oyOptions_Release( &opts );
+
+  return block;
+}
+
+/* compare the A2B0 CLUT of two profiles; the header carries the creation time */
+static int    testProofClutEqual_    ( const char        * block1,
+                                       size_t              size1,
+                                       const char        * block2,
+                                       size_t              size2 )
+{
+  oyProfile_s * p1 = NULL, * p2 = NULL;
+  oyProfileTag_s * tag1 = NULL, * tag2 = NULL;
+  oyPointer clut1 = NULL, clut2 = NULL;
+  size_t clut1_size = 0, clut2_size = 0;
+  int equal;
+
+  if(block1 && block2)
+  {
+    p1 = oyProfile_FromMem( size1, (oyPointer)block1, 0, testobj );
+    p2 = oyProfile_FromMem( size2, (oyPointer)block2, 0, testobj );
+  }
+  if(p1 && p2)
+  {
+    tag1 = oyProfile_GetTagById( p1, icSigAToB0Tag );
+    tag2 = oyProfile_GetTagById( p2, icSigAToB0Tag );
+  }
+  if(tag1 && tag2)
+  {
+    oyProfileTag_GetBlock( tag1, &clut1, &clut1_size, oyAllocateFunc_ );
+    oyProfileTag_GetBlock( tag2, &clut2, &clut2_size, oyAllocateFunc_ );
+  }
+
+  equal = clut1 && clut2 && clut1_size == clut2_size &&
+          memcmp( clut1, clut2, clut1_size ) == 0;
+
+  if(clut1) oyDeAllocateFunc_( clut1 );
+  if(clut2) oyDeAllocateFunc_( clut2 );
+  oyProfileTag_Release( &tag1 );
+  oyProfileTag_Release( &tag2 );
+  oyProfile_Release( &p1 );
+  oyProfile_Release( &p2 );
+
+  return equal;
+}
+
+/* test2 runs itself with this variable set for the second process part */
+#define TEST_PROOF_CACHE_ENV "OY_TEST_PROOF_CACHE"
+
+oyTESTRESULT_e testProofCache()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  oyProfile_s * proof = oyProfile_FromStd( oyPROFILE_PROOF, 0, testobj ),
+              * mem_proof = NULL;
+  size_t size = 0, size1 = 0, size2 = 0, size3 = 0;
+  char * data = NULL, * block1 = NULL, * block2 = NULL, * block3 = NULL,
+       * fn1 = NULL, * fn2 = NULL, * fn3 = NULL;
+  double created = 0, shared = 0, loaded = 0;
+  const char * child_file = getenv( TEST_PROOF_CACHE_ENV );
+  struct stat st1, st3;
+
+  fprintf(stdout, "\n" );
+
+  if(proof)
+    data = (char*) oyProfile_GetMem( proof, &size, 0, oyAllocateFunc_ );
+  if(data)
+    mem_proof = oyProfile_FromMem( size, data, 0, testobj );
+  oyDeAllocateFunc_( data ); data = NULL;
+
+  if(!mem_proof || oyProfile_GetFileName( mem_proof, -1 ))
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "memory only proofing profile                          " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "memory only proofing profile %lu bytes                ", (unsigned long)size );
+  }
+
+  /* second process: the abstract must come unchanged from the user cache */
+  if(child_file && child_file[0])
+  {
+    block3 = testProofEffectCached_( oyProfile_Copy( mem_proof, NULL ), &size3, &loaded, &fn3 );
+    if(fn3)
+      data = (char*) oyReadFileToMem_( fn3, &size, oyAllocateFunc_ );
+    if(block3 && data && size == size3 && memcmp( data, block3, size ) == 0 &&
+       strcmp( fn3, child_file ) == 0)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "loaded from user cache %.03fs                         ", loaded );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "not loaded from user cache: %s", oyNoEmptyString_m_(fn3) );
+    }
+    if(data) oyFree_m_( data );
+    if(block3) oyFree_m_( block3 );
+    if(fn3) oyFree_m_( fn3 );
+    oyProfile_Release( &mem_proof );
+    oyProfile_Release( &proof );
+    return result;
+  }
+
+  /* first process: create from the memory profile; a file from a earlier
+   * run is dropped before */
+  oyStructList_Clear( *oyCMMCacheList_() );
+  block1 = testProofEffectCached_( oyProfile_Copy( mem_proof, NULL ), &size1, &created, &fn1 );
+  if(fn1)
+  {
+    oyRemoveFile_( fn1 );
+    oyFree_m_( fn1 );
+  }
+  if(block1) oyFree_m_( block1 );
+  oyStructList_Clear( *oyCMMCacheList_() );
+  block1 = testProofEffectCached_( oyProfile_Copy( mem_proof, NULL ), &size1, &created, &fn1 );
+  if(!block1)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "create_profile.proofing_effect no lcm2                " );
+    oyProfile_Release( &mem_proof );
+    oyProfile_Release( &proof );
+    return result;
+  }
+
+  if(fn1 && oyIsFile_( fn1 ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "proofing abstract stored: %s", fn1 );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "proofing abstract not stored: %s", oyNoEmptyString_m_(fn1) );
+  }
+
+  /* the file based proof has the same content and thus the same key */
+  block2 = testProofEffectCached_( oyProfile_Copy( proof, NULL ), &size2, &shared, &fn2 );
+  if(testProofClutEqual_( block1, size1, block2, size2 ) &&
+     fn1 && fn2 && strcmp( fn1, fn2 ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "file and memory proof share one abstract              " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "file and memory proof differ: %s %s", oyNoEmptyString_m_(fn1), oyNoEmptyString_m_(fn2) );
+  }
+
+  PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "created %.03fs, shared %.06fs", created, shared );
+
+  /* second process: test2 itself with only the user cache in common */
+  memset( &st1, 0, sizeof(st1) );
+  memset( &st3, 0, sizeof(st3) );
+#if defined(__linux__)
+  if(fn1 && stat( fn1, &st1 ) == 0)
+  {
+    int status = -1;
+    pid_t pid;
+    char number[32];
+
+    sprintf( number, "%d", test_number );
+    fflush( stdout );
+    fflush( stderr );
+    pid = fork();
+    if(pid == 0)
     {
-      if( buf_16out[y*dst_width*channels + x*channels + 3] &&
-          buf_16out[y*dst_width*channels + x*channels + 3] != x )
-      {
-        err = buf_16out[y*dst_width*channels + x*channels + 3];
-        break;
-      }
+      setenv( TEST_PROOF_CACHE_ENV, fn1, 1 );
+      if(!freopen( "/dev/null", "w", stdout ))
+        _exit( 127 );
+      execl( "/proc/self/exe", "test2", "--silent", number, (char*)NULL );
+      _exit( 127 );
     }
-    
-    if( err == 0 )
+    if(pid > 0)
+      waitpid( pid, &status, 0 );
+    stat( fn1, &st3 );
+
+    if(pid > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0 &&
+       st1.st_ino == st3.st_ino && st1.st_mtime == st3.st_mtime)
     { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "oyDrawScreenImage   fills correct positions        " );
+      "second process reused the user cache                  " );
     } else
-    { PRINT_SUB( oyTESTRESULT_XFAIL,
-      "oyDrawScreenImage   fills correct positions  %d/%d", x,err );
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "second process did not reuse the user cache: %d", status );
+    }
+  } else
+#endif
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "no second process                                     " );
+  }
+
+  /* a truncated file is replaced */
+  if(fn1)
+  {
+    oyWriteMemToFile_( fn1, block1, 64 );
+    oyStructList_Clear( *oyCMMCacheList_() );
+    block3 = testProofEffectCached_( oyProfile_Copy( mem_proof, NULL ), &size3, &loaded, NULL );
+    if(testProofClutEqual_( block1, size1, block3, size3 ) &&
+       oyReadFileSize_( fn1 ) == size3)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "broken cache file replaced                            " );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "broken cache file not replaced                        " );
     }
+    oyRemoveFile_( fn1 );
+  }
 
+  if(block1) oyFree_m_( block1 );
+  if(block2) oyFree_m_( block2 );
+  if(block3) oyFree_m_( block3 );
+  if(fn1) oyFree_m_( fn1 );
+  if(fn2) oyFree_m_( fn2 );
+  oyProfile_Release( &mem_proof );
+  oyProfile_Release( &proof );
 
-    if(oy_debug)
-    fprintf( zout, "\nDONE [%d] ##################################### %s\n\n", i, oyRectangle_Show(display_rectangle) );
+  return result;
+}
+
+#include "cgats_testdata.h"
+
+static oyImage_s * testParseCGATS_   ( const char        * cgats,
+                                       double              rgb_scale,
+                                       double            * seconds )
+{
+  oyOptions_s * opts = NULL, * result_opts = NULL;
+  oyImage_s * image;
+  double t;
+
+  oyOptions_SetFromString( &opts, "//" OY_TYPE_STD "/cgats", cgats, OY_CREATE_NEW );
+  if(rgb_scale > 0)
+    oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/rgb_scale", rgb_scale, 0, OY_CREATE_NEW );
+  t = oySeconds();
+  oyOptions_Handle( "//" OY_TYPE_STD "/parse_cgats",
+                    opts,"parse_cgats",
+                    &result_opts );
+  *seconds = oySeconds() - t;
+  image = (oyImage_s*) oyOptions_GetType( result_opts, -1, "colors",
+                                          oyOBJECT_IMAGE_S );
+  oyOptions_Release( &result_opts );
+  oyOptions_Release( &opts );
+
+  return image;
+}
+
+static double testCGATSValue_        ( oyImage_s         * image,
+                                       int                 patch,
+                                       int                 channel )
+{
+  oyArray2d_s * a = (oyArray2d_s*) oyImage_GetPixelData( image );
+  double ** rows = (double**) oyArray2d_GetData( a );
+  int channels = oyImage_GetPixelLayout( image, oyCHANS );
+  double v = rows[0][patch * channels + channel];
+  oyArray2d_Release( &a );
+  return v;
+}
+
+static int testCGATSTag_             ( oyImage_s         * image,
+                                       const char        * key,
+                                       const char        * value )
+{
+  oyOptions_s * tags = oyImage_GetTags( image );
+  const char * v = oyOptions_FindString( tags, key, 0 );
+  int match = v && strcmp( v, value ) == 0;
+  if(!match)
+    fprintf( zout, "  %s: \"%s\" != \"%s\"\n", key, oyNoEmptyString_m_(v), value );
+  oyOptions_Release( &tags );
+  return match;
+}
+
+oyTESTRESULT_e testCGATS()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  oyImage_s * image;
+  oyProfile_s * p;
+  double seconds = 0, small = 0, large = 0;
+  char * text;
+  int sets;
+
+  fprintf(stdout, "\n" );
+
+  image = testParseCGATS_( cgats_it8_7_4, 0, &seconds );
+  if(!image)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "parse_cgats no lcm2                                   " );
+    return result;
   }
-  clck = oyClock() - clck;
 
-  if( !error &&
-      dirty <= 0
-    )
+  p = oyImage_GetProfile( image );
+  if(oyImage_GetWidth( image ) == 4 &&
+     oyImage_GetPixelLayout( image, oyCHANS ) == 18 &&
+     oyProfile_GetSignature( p, oySIGNATURE_COLOR_SPACE ) == icSigCmykData)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyDrawScreenImage                  %s",
-                 oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "draws"));
+    "IT8.7/4 4 sets 18 channels CMYK                       " );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyDrawScreenImage                                  " );
+    "IT8.7/4 %d sets %d channels                           ",
+    oyImage_GetWidth( image ), oyImage_GetPixelLayout( image, oyCHANS ) );
   }
+  oyProfile_Release( &p );
 
+  if(testCGATSValue_( image, 1, 0 ) == 1.0 &&
+     fabs(testCGATSValue_( image, 1, 9 ) - -52.45) < 1e-9 &&
+     fabs(testCGATSValue_( image, 3, 7 ) - 12.40) < 1e-9 &&
+     fabs(testCGATSValue_( image, 0, 17 ) - 0.8791) < 1e-9)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "IT8.7/4 scaled CMYK, raw Lab and spectral values      " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "IT8.7/4 values %g %g %g %g", testCGATSValue_( image, 1, 0 ),
+    testCGATSValue_( image, 1, 9 ), testCGATSValue_( image, 3, 7 ),
+    testCGATSValue_( image, 0, 17 ) );
+  }
 
+  if(testCGATSTag_( image, "sheet_type", "IT8.7/4" ) &&
+     testCGATSTag_( image, "ORIGINATOR", "Oyranos test" ) &&
+     testCGATSTag_( image, "MEASUREMENT_SOURCE", "Illumination=D50 ObserverAngle=2 WhiteBase=Abs Filter=No" ) &&
+     testCGATSTag_( image, "SPECTRAL_BANDS", "8" ) &&
+     testCGATSTag_( image, "SAMPLE_ID", "1\n2\n3\n4" ) &&
+     testCGATSTag_( image, "channels", "CMYK_C CMYK_M CMYK_Y CMYK_K XYZ_X XYZ_Y XYZ_Z LAB_L LAB_A LAB_B SPECTRAL_NM380 SPECTRAL_NM430 SPECTRAL_NM480 SPECTRAL_NM530 SPECTRAL_NM580 SPECTRAL_NM630 SPECTRAL_NM680 SPECTRAL_NM730" ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "IT8.7/4 keywords as image tags                        " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "IT8.7/4 keywords as image tags                        " );
+  }
+  oyImage_Release( &image );
 
-  oyConversion_Release ( &cc );
-  oyPixelAccess_Release( &pixel_access );
-  oyProfile_Release( &p_rgb );
-  oyProfile_Release( &p_web );
-  oyImage_Release( &input );
-  oyImage_Release( &output );
-  free(buf_16in);
-  free(buf_16out);
+  image = testParseCGATS_( cgats_eci2002, 0, &seconds );
+  if(image && oyImage_GetWidth( image ) == 5 &&
+     oyImage_GetPixelLayout( image, oyCHANS ) == 7 &&
+     testCGATSValue_( image, 4, 3 ) == 1.0 &&
+     fabs(testCGATSValue_( image, 4, 4 ) - 5.21) < 1e-9 &&
+     fabs(testCGATSValue_( image, 2, 6 ) - -6.44) < 1e-9)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "ECI2002 5 sets 7 channels                             " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "ECI2002 %d sets %d channels                           ",
+    image ? oyImage_GetWidth( image ) : 0,
+    image ? oyImage_GetPixelLayout( image, oyCHANS ) : 0 );
+  }
+
+  if(image &&
+     testCGATSTag_( image, "sheet_type", "ECI2002" ) &&
+     testCGATSTag_( image, "LGOROWLENGTH", "33" ) &&
+     testCGATSTag_( image, "SAMPLE_NAME", "A1\nA2\nA3\nA4\nA5" ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "ECI2002 CRLF, comments and sample names               " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "ECI2002 CRLF, comments and sample names               " );
+  }
+  oyImage_Release( &image );
+
+  image = testParseCGATS_( cgats_lab, 0, &seconds );
+  p = image ? oyImage_GetProfile( image ) : NULL;
+  if(image &&
+     oyProfile_GetSignature( p, oySIGNATURE_COLOR_SPACE ) == icSigLabData &&
+     testCGATSValue_( image, 0, 0 ) == 1.0 &&
+     testCGATSValue_( image, 0, 1 ) == 0.0 &&
+     testCGATSValue_( image, 0, 2 ) == 1.0 &&
+     testCGATSValue_( image, 1, 0 ) == 0.5 &&
+     fabs(testCGATSValue_( image, 1, 1 ) - 128.0/257.0) < 1e-9)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "Lab scaled to 0.0 - 1.0                               " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "Lab not scaled: %g %g %g", image ? testCGATSValue_( image, 0, 0 ) : 0,
+    image ? testCGATSValue_( image, 0, 1 ) : 0,
+    image ? testCGATSValue_( image, 1, 1 ) : 0 );
+  }
+  oyProfile_Release( &p );
+
+  if(image &&
+     testCGATSTag_( image, "color_scale", "100 257 257" ) &&
+     testCGATSTag_( image, "color_offset", "0 128 128" ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "Lab scaling tagged                                    " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "Lab scaling tagged                                    " );
+  }
+
+  if(image &&
+     testCGATSTag_( image, "DESCRIPTOR", "Lab reference" ) &&
+     testCGATSTag_( image, "ORIGINATOR", "Oyranos test" ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "unterminated quote ends at CRLF                       " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "unterminated quote ends at CRLF                       " );
+  }
+  oyImage_Release( &image );
+
+  /* the RGB scale comes from the header, not from the values */
+  image = testParseCGATS_( cgats_rgb, 0, &seconds );
+  if(image &&
+     testCGATSValue_( image, 0, 0 ) == 1.0 &&
+     fabs(testCGATSValue_( image, 0, 2 ) - 0.2) < 1e-9 &&
+     testCGATSTag_( image, "color_scale", "255 255 255" ) &&
+     testCGATSTag_( image, "color_offset", "0 0 0" ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "RGB scaled by the RGB_SCALE keyword                   " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "RGB not scaled by RGB_SCALE: %g %g", image ? testCGATSValue_( image, 0, 0 ) : 0,
+    image ? testCGATSValue_( image, 0, 2 ) : 0 );
+  }
+  oyImage_Release( &image );
+
+  image = testParseCGATS_( cgats_rgb, 510, &seconds );
+  if(image &&
+     testCGATSValue_( image, 0, 0 ) == 0.5 &&
+     testCGATSTag_( image, "color_scale", "510 510 510" ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "RGB scaled by the rgb_scale option                    " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "RGB not scaled by rgb_scale: %g", image ? testCGATSValue_( image, 0, 0 ) : 0 );
+  }
+  oyImage_Release( &image );
+
+  /* the parse time grows linear with the sets */
+  sets = 10000;
+  text = cgatsTestCreate( sets );
+  image = testParseCGATS_( text, 0, &small );
+  free( text );
+  if(image && oyImage_GetWidth( image ) == sets &&
+     fabs(testCGATSValue_( image, sets-1, 9 ) - -((sets-1)%128 + ((sets-1)%83)/100.0)) < 1e-9)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "%d sets %.03fs                                       ", sets, small );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "%d sets not parsed                                   ", sets );
+  }
+  oyImage_Release( &image );
+
+  text = cgatsTestCreate( 4 * sets );
+  image = testParseCGATS_( text, 0, &large );
+  free( text );
+  if(image && oyImage_GetWidth( image ) == 4 * sets &&
+     (small < 0.001 || large < 10 * small))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "%d sets %.03fs %s", 4 * sets, large,
+    oyProfilingToString( 4 * sets, large, "sets" ) );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "%d sets %.03fs; %d sets %.03fs                     ", sets, small, 4 * sets, large );
+  }
+  oyImage_Release( &image );
 
   return result;
 }
@@ -7960,6 +10519,233 @@ oyTESTRESULT_e testCache()
   return result;
 }
 
+static int testStatsRun              ( int                 width,
+                                       int                 height,
+                                       int                 n )
+{
+  oyProfile_s * p_in = oyProfile_FromStd( oyEDITING_LAB, icc_profile_flags, NULL ),
+              * p_out = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, NULL );
+  uint16_t * buf = (uint16_t*) calloc( sizeof(uint16_t), width * height * 3 * 2 );
+  oyImage_s * in  = oyImage_Create( width, height, buf, OY_TYPE_123_16,
+                                    p_in, NULL ),
+            * out = oyImage_Create( width, height, buf + width * height * 3,
+                                    OY_TYPE_123_16, p_out, NULL );
+  oyConversion_s * cc = oyConversion_CreateBasicPixels( in, out, NULL, NULL );
+  int error = !cc, i;
+
+  for(i = 0; i < n && !error; ++i)
+    error = oyConversion_RunPixels( cc, NULL );
+
+  oyConversion_Release( &cc );
+  oyImage_Release( &in );
+  oyImage_Release( &out );
+  oyProfile_Release( &p_in );
+  oyProfile_Release( &p_out );
+  free( buf );
+
+  return error;
+}
+
+oyTESTRESULT_e testStats()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  double count = 0, seconds = 0, value = 0;
+  int old_flags, n = 20, error;
+
+  fprintf(stdout, "\n" );
+
+  /* warm up, so that module loading does not count for the timing */
+  testStatsRun( 64, 64, 1 );
+
+  old_flags = oyStatsSet( oySTATS_ENABLE | oySTATS_TRACE );
+  oyStatsReset();
+  oyStructList_Clear( *oyCMMCacheList_() );
+
+  error = testStatsRun( 64, 64, 1 );
+  oyStatsGet( oySTATS_TRANSFORM_BUILD, &count, &seconds, &value );
+  if(!error && count >= 1.0 && seconds > 0.0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oySTATS_TRANSFORM_BUILD: %g %gs          ", count, seconds );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oySTATS_TRANSFORM_BUILD: %g %gs          ", count, seconds );
+  }
+
+  oyStatsGet( oySTATS_PIXEL_RUN, &count, &seconds, &value );
+  if(count >= 1.0 && value == 64.0 * 64.0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oySTATS_PIXEL_RUN: %g %g pixel           ", count, value );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oySTATS_PIXEL_RUN: %g %g pixel           ", count, value );
+  }
+
+  oyStatsGet( oySTATS_CACHE_MISS, &count, &seconds, &value );
+  if(count >= 1.0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oySTATS_CACHE_MISS: %g                   ", count );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oySTATS_CACHE_MISS: %g                   ", count );
+  }
+
+  oyStatsReset();
+  testStatsRun( 64, 64, 1 );
+  oyStatsGet( oySTATS_CACHE_HIT, &count, &seconds, &value );
+  double builds = 0;
+  oyStatsGet( oySTATS_TRANSFORM_BUILD, &builds, NULL, NULL );
+  if(count >= 1.0 && builds == 0.0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oySTATS_CACHE_HIT: %g builds: %g         ", count, builds );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oySTATS_CACHE_HIT: %g builds: %g         ", count, builds );
+  }
+
+  char * text = oyStatsToText( oyAllocateFunc_ );
+  oyjl_val root = oyjlTreeParse( text, NULL, 0 );
+  oyjl_val v = oyjlTreeGetValue( root, 0, "pixel_run/value" );
+  if(OYJL_IS_NUMBER(v) &&
+     (OYJL_IS_INTEGER(v) ? OYJL_GET_INTEGER(v) : OYJL_GET_DOUBLE(v)) == 64.0 * 64.0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyStatsToText()                          " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyStatsToText() %s", oyNoEmptyString_m_(text) );
+  }
+  oyjlTreeFree( root );
+  oyFree_m_( text );
+
+  const char * trace_name = "test2_trace.json";
+  error = oyStatsTraceWrite( trace_name );
+  size_t size = 0;
+  text = oyReadFileToMem_( trace_name, &size, oyAllocateFunc_ );
+  root = oyjlTreeParse( text, NULL, 0 );
+  v = oyjlTreeGetValue( root, 0, "traceEvents/[0]/ph" );
+  if(!error && OYJL_IS_STRING(v) && strcmp(OYJL_GET_STRING(v),"X") == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyStatsTraceWrite( %s ) %d events", trace_name, oyjlValueCount( oyjlTreeGetValue( root, 0, "traceEvents" ) ) );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyStatsTraceWrite( %s )                  ", trace_name );
+  }
+  oyjlTreeFree( root );
+  if(text) oyFree_m_( text );
+  remove( trace_name );
+
+  /* switched off the probes must neither count nor cost */
+  oyStatsSet( 0 );
+  oyStatsReset();
+  double clck = oyClock();
+  testStatsRun( 64, 64, n );
+  clck = oyClock() - clck;
+  oyStatsGet( oySTATS_PIXEL_RUN, &count, NULL, NULL );
+  if(count == 0.0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "disabled probes %s", oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "runs"));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "disabled probes counted: %g              ", count );
+  }
+
+  oyStatsSet( oySTATS_ENABLE );
+  clck = oyClock();
+  testStatsRun( 64, 64, n );
+  clck = oyClock() - clck;
+  oyStatsGet( oySTATS_PIXEL_RUN, &count, NULL, NULL );
+  if(count >= n)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "enabled probes  %s", oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "runs"));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "enabled probes counted: %g               ", count );
+  }
+
+  oyStatsSet( old_flags );
+  oyStatsReset();
+
+  return result;
+}
+
+oyTESTRESULT_e testEnv()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  int i, n = 1000000, found = 0;
+
+  fprintf(stdout, "\n" );
+
+  for(i = 0; i < oyENV_MAX; ++i)
+  {
+    const char * e = getenv( oyEnvName( (oyENV_e)i ) ),
+               * v = oyEnvGetString( (oyENV_e)i );
+    if((!e && !v) || (e && v && strcmp(e,v) == 0))
+      ++found;
+  }
+  if(found == oyENV_MAX)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyEnvGetString() matches getenv() %d     ", found );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyEnvGetString() matches getenv() %d/%d  ", found, oyENV_MAX );
+  }
+
+  const char * old = oyEnvGetString( oyENV_DEBUG_WRITE );
+  char * old_copy = old ? oyStringCopy( old, oyAllocateFunc_ ) : NULL;
+  setenv( "OY_DEBUG_WRITE", "test2", 1 );
+  const char * before = oyEnvGetString( oyENV_DEBUG_WRITE );
+  oyEnvReload();
+  const char * after = oyEnvGetString( oyENV_DEBUG_WRITE );
+  if((before == old) && after && strcmp(after,"test2") == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyEnvReload() OY_DEBUG_WRITE=%s          ", after );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyEnvReload() OY_DEBUG_WRITE=%s          ", oyNoEmptyString_m_(after) );
+  }
+
+  setenv( "OY_DEBUG", "7", 1 );
+  oyEnvReload();
+  if(oyEnvGetInt( oyENV_DEBUG, 0 ) == 7 &&
+     oyEnvGetInt( oyENV_MAX, -1 ) == -1 && oyEnvName( oyENV_MAX ) == NULL)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyEnvGetInt( oyENV_DEBUG ) = 7           " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyEnvGetInt( oyENV_DEBUG ) = %d          ", oyEnvGetInt( oyENV_DEBUG, 0 ) );
+  }
+  unsetenv( "OY_DEBUG" );
+
+  if(old_copy)
+    setenv( "OY_DEBUG_WRITE", old_copy, 1 );
+  else
+    unsetenv( "OY_DEBUG_WRITE" );
+  oyEnvReload();
+  if(old_copy) oyFree_m_( old_copy );
+
+  /* the hot paths asked getenv() for each call before */
+  found = 0;
+  double clck = oyClock();
+  for(i = 0; i < n; ++i)
+    if(getenv( "OY_DEBUG_WRITE" )) ++found;
+  clck = oyClock() - clck;
+  PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "getenv()         %s", oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "calls"));
+
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+    if(oyEnvGetString( oyENV_DEBUG_WRITE )) --found;
+  clck = oyClock() - clck;
+  if(found == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyEnvGetString() %s", oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "calls"));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyEnvGetString() differs from getenv() %d ", found );
+  }
+
+  return result;
+}
+
 oyTESTRESULT_e testPaths()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
@@ -26,6 +26,12 @@
 #include <string.h>
 #include <time.h>
 #include <unistd.h> /* usleep() */
+#include <errno.h>
+#if defined(__linux__)
+# include <poll.h>
+# include <sys/inotify.h>
+# include <sys/timerfd.h>
+#endif
 
 #include "bb_100K.h"
 #include "oyranos_color.h"
@@ -45,6 +51,10 @@
 #include "oyProfiles_s.h"
 
 #include <X11/Xcm/XcmVersion.h>
+#if defined( XCM_HAVE_X11 ) && defined( HAVE_XRANDR )
+# include <X11/Xlib.h>
+# include <X11/extensions/Xrandr.h>
+#endif
 
 #define DBG_S_ if(oy_debug >= 1)DBG_S
 #define DBG1_S_ if(oy_debug >= 1)DBG1_S
@@ -57,6 +67,8 @@ double getSunHeight( double year, double month, double day, double gmt_hours, do
 int getSunriseSunset( double * rise, double * set, int dry, char ** text );
 int isNight(int dry);
 int runDaemon(int dmode);
+int runDaemonFakeClock( double hours );
+double getNextTransition( double hour, int dry );
 int setWtptMode( oySCOPE_e scope, int wtpt_mode, int dry );
 void pingNativeDisplay();
 int checkWtptState();
@@ -273,6 +285,7 @@ void myOptionsRelease                ( openiccOptions_s   ** opts )
 
 oySCOPE_e scope = oySCOPE_USER;
 double hour_ = -1.0; /* ignore this default value */
+double fake_clock_ = 0.0; /* simulated hours for a daemon schedule test */
 
 int main( int argc , char** argv )
 {
@@ -367,6 +380,7 @@ int main( int argc , char** argv )
     {"oiwi", 0, 'v', "verbose", NULL, _("verbose"), _("verbose"), NULL, NULL, openiccOPTIONTYPE_NONE, {}, openiccINT, {.i=&verbose} },
     {"oiwi", 0, 'y', "dry-run", NULL, "dry run", "dry run", NULL, NULL, openiccOPTIONTYPE_NONE, {}, openiccINT, {.i=&dry} },
     {"oiwi", 0, 'u', "hour", NULL, "hour", "hour", NULL, NULL, openiccOPTIONTYPE_DOUBLE, {.dbl.start = 0, .dbl.end = 48, .dbl.tick = 1, .dbl.d = 0}, openiccDOUBLE, {.d=&hour_} },
+    {"oiwi", 0, 'f', "fake-clock", NULL, "fake clock", "Simulate the daemon schedule", NULL, _("HOURS"), openiccOPTIONTYPE_DOUBLE, {.dbl.start = 0, .dbl.end = 8760, .dbl.tick = 1, .dbl.d = 0}, openiccDOUBLE, {.d=&fake_clock_} },
     {"oiwi", 0, 'c', "check", NULL, "check", "check", NULL, NULL, openiccOPTIONTYPE_NONE, {}, openiccINT, {.i=&check} },
     /* blind options, useful only for man page generation */
     {"oiwi", 0, '.', "man-environment_variables", NULL, "", "", NULL, NULL, openiccOPTIONTYPE_CHOICE, {.choices.list = openiccMemDup( env_vars, sizeof(env_vars) )}, openiccNONE, {.i=NULL} },
@@ -601,6 +615,12 @@ int main( int argc , char** argv )
     ++worked;
   }
 
+  if(fake_clock_ > 0.0)
+  {
+    error = runDaemonFakeClock( fake_clock_ );
+    ++worked;
+  }
+  else
   if(daemon != -1)
   {
     error = runDaemon(daemon);
@@ -1191,6 +1211,224 @@ static void oyMonitorCallbackDBus    ( double              progress_zero_till_on
 #endif /* HAVE_DBUS */
 
 
+/* upper limit for one wait; follows date, location and time zone changes */
+#define OY_WTPT_MAX_WAIT 1.0
+/* land after the transition, as the comparison in checkWtptState() is strict */
+#define OY_WTPT_MARGIN (1.0/3600.0)
+
+/* hours from hour till the next sunrise or sunset */
+double getNextTransition( double hour, int dry )
+{
+  double rise = 0.0, set = 0.0, wait = OY_WTPT_MAX_WAIT;
+
+  if( getSunriseSunset( &rise, &set, dry, NULL ) == 0 )
+  {
+    double t[2] = { rise, set };
+    int i;
+    for(i = 0; i < 2; ++i)
+    {
+      double diff = t[i] - hour;
+      while(diff <= 0.0) diff += 24.0;
+      while(diff > 24.0) diff -= 24.0;
+      if(diff < wait)
+        wait = diff;
+    }
+  }
+
+  return wait + OY_WTPT_MARGIN;
+}
+
+/* step a fake clock from schedule point to schedule point without waiting
+ * and without changing settings; report the day / night transitions */
+int runDaemonFakeClock( double hours )
+{
+  double elapsed = 0.0;
+  int wakeups = 0, transitions = 0, night,
+      gmt_diff_second = 0;
+
+  if(hour_ == -1.0)
+    hour_ = oyGetCurrentGMTHour( &gmt_diff_second );
+  else
+    oyGetCurrentGMTHour( &gmt_diff_second );
+  night = isNight( 1 );
+
+  while(elapsed < hours)
+  {
+    int hour, minute, second, n;
+    double wait = getNextTransition( hour_, 1 );
+
+    elapsed += wait;
+    hour_ = oyNormaliseHour( hour_ + wait );
+    ++wakeups;
+
+    n = isNight( 1 );
+    if(n == night)
+      continue;
+
+    night = n;
+    ++transitions;
+    oySplitHour( oyGetCurrentLocalHour( hour_, gmt_diff_second ), &hour, &minute, &second );
+    fprintf( stdout, "%.4f h %d:%.2d:%.2d %s\n", elapsed, hour, minute, second,
+             night == 1 ? "night" : night == 0 ? "day" : "----" );
+    checkWtptState( 1 );
+  }
+
+  fprintf( stdout, "%d transitions %d wakeups in %g hours\n",
+           transitions, wakeups, hours );
+
+  return 0;
+}
+
+#if defined(__linux__)
+#ifndef TFD_TIMER_CANCEL_ON_SET
+# define TFD_TIMER_CANCEL_ON_SET (1 << 1)
+#endif
+#define OY_WTPT_DB_FILE "openicc.json"
+/* watch the directory to catch atomic replacements of the DB file */
+static int oyWtptWatchDB_            ( int                 fd,
+                                       oySCOPE_e           scope_ )
+{
+  char * path = oyGetInstallPath( oyPATH_POLICY, scope_, oyAllocateFunc_ );
+  int wd = -1;
+
+  if(path)
+  {
+    wd = inotify_add_watch( fd, path, IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE );
+    if(wd < 0)
+      DBG_S_( path );
+    oyFree_m_( path );
+  }
+
+  return wd;
+}
+
+/* drain all pending events; 1 - the DB file changed */
+static int oyWtptReadDBEvents_       ( int                 fd )
+{
+  char buf[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+  int changed = 0;
+  ssize_t len;
+
+  while((len = read( fd, buf, sizeof(buf) )) > 0)
+  {
+    char * ptr;
+    for(ptr = buf; ptr < buf + len;
+        ptr += sizeof(struct inotify_event) + ((struct inotify_event*)ptr)->len)
+    {
+      const struct inotify_event * event = (const struct inotify_event *) ptr;
+      if(event->len && strcmp( event->name, OY_WTPT_DB_FILE ) == 0)
+        changed = 1;
+    }
+  }
+
+  return changed;
+}
+
+/* wait for the next transition, settings DB changes and monitor changes;
+ * returns only on error */
+static int runEventLoop              ( void )
+{
+  int tfd, ifd, n = 2, watches = 0;
+  struct pollfd fds[3];
+#if defined( XCM_HAVE_X11 ) && defined( HAVE_XRANDR )
+  Display * dpy = NULL;
+  int rr_event_base = 0, rr_error_base = 0;
+#endif
+
+  tfd = timerfd_create( CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC );
+  ifd = inotify_init1( IN_NONBLOCK | IN_CLOEXEC );
+  if(ifd >= 0)
+  {
+    if(oyWtptWatchDB_( ifd, oySCOPE_USER ) >= 0) ++watches;
+    if(oyWtptWatchDB_( ifd, oySCOPE_SYSTEM ) >= 0) ++watches;
+  }
+  if(tfd < 0 || ifd < 0 || !watches)
+  {
+    fprintf( stderr, "%s: %s\n", _("Can not watch settings DB"), strerror(errno) );
+    if(tfd >= 0) close( tfd );
+    if(ifd >= 0) close( ifd );
+    return -1;
+  }
+
+  memset( fds, 0, sizeof(fds) );
+  fds[0].fd = tfd;
+  fds[0].events = POLLIN;
+  fds[1].fd = ifd;
+  fds[1].events = POLLIN;
+
+#if defined( XCM_HAVE_X11 ) && defined( HAVE_XRANDR )
+  dpy = XOpenDisplay( NULL );
+  if(dpy && XRRQueryExtension( dpy, &rr_event_base, &rr_error_base ))
+  {
+    XRRSelectInput( dpy, DefaultRootWindow( dpy ), RRScreenChangeNotifyMask );
+    fds[2].fd = ConnectionNumber( dpy );
+    fds[2].events = POLLIN;
+    ++n;
+  }
+#endif
+
+  while(1)
+  {
+    struct itimerspec its;
+    double wait = getNextTransition( oyGetCurrentGMTHour_(0), 0 );
+    int check = 0, outputs = 0, r;
+
+    /* absolute wall clock time fires after suspend and is canceled on clock
+     * changes */
+    memset( &its, 0, sizeof(its) );
+    its.it_value.tv_sec = time(NULL) + (time_t)(wait * 3600.0 + 0.5);
+    if(timerfd_settime( tfd, TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET, &its, NULL ) != 0)
+      break;
+    if(oy_debug)
+      fprintf( stderr, "%s next check in %.0f s\n", oyPrintTime(), wait * 3600.0 );
+
+    r = poll( fds, n, -1 );
+    if(r < 0)
+    {
+      if(errno == EINTR)
+        continue;
+      break;
+    }
+
+    if(fds[0].revents & POLLIN)
+    {
+      uint64_t expirations = 0;
+      /* ECANCELED after a clock change; recheck anyway */
+      if(read( tfd, &expirations, sizeof(expirations) ) < 0 && errno != ECANCELED)
+        DBG_S_( strerror(errno) );
+      check = 1;
+    }
+    if(fds[1].revents & POLLIN)
+      check = outputs = oyWtptReadDBEvents_( ifd );
+#if defined( XCM_HAVE_X11 ) && defined( HAVE_XRANDR )
+    if(n > 2 && fds[2].revents & POLLIN)
+      while(XPending( dpy ))
+      {
+        XEvent event;
+        XNextEvent( dpy, &event );
+        XRRUpdateConfiguration( &event );
+        if(event.type == rr_event_base + RRScreenChangeNotify)
+          outputs = 1;
+      }
+#endif
+
+    if(check)
+      checkWtptState( 0 );
+    if(outputs)
+      updateVCGT();
+  }
+
+  fprintf( stderr, "%s: %s\n", _("Event loop failed"), strerror(errno) );
+#if defined( XCM_HAVE_X11 ) && defined( HAVE_XRANDR )
+  if(dpy) XCloseDisplay( dpy );
+#endif
+  close( tfd );
+  close( ifd );
+
+  return -1;
+}
+#endif /* __linux__ */
+
 int runDaemon(int dmode)
 {
   int error = 0, id, active = 1;
@@ -1222,6 +1460,12 @@ int runDaemon(int dmode)
   if(active)
     checkWtptState( 0 );
 
+#if defined(__linux__)
+  /* the settings DB file changes cover the DBus messages */
+  if(runEventLoop() == -1)
+    fprintf( stderr, "%s\n", _("falling back to polling") );
+#endif
+
 #ifdef HAVE_DBUS
   oyStartDBusObserver( oyWatchDBus, oyFinishDBus, oyMonitorCallbackDBus, OY_STD, NULL )
   if(id)
@@ -1237,9 +1481,9 @@ int runDaemon(int dmode)
     /* delay next polling */
     oySleep( 0.25 );
   }
+#endif /* HAVE_DBUS */
 
   return error;
-#endif /* HAVE_DBUS */
 }
 
 